@@ -79,6 +79,16 @@ typedef struct otMessageSettings
     uint8_t mPriority;            ///< Priority level (MUST be a `OT_MESSAGE_PRIORITY_*` from `otMessagePriority`).
 } otMessageSettings;
 
+/**
+ * This structure represents a contiguous chunk of the bytes of a message.
+ *
+ */
+typedef struct otMessageChunk
+{
+    uint8_t *mData;   ///< A pointer to the bytes.
+    uint16_t mLength; ///< The number of bytes.
+} otMessageChunk;
+
 /**
  * Free an allocated message buffer.
  *
@@ -262,6 +272,30 @@ uint16_t otMessageRead(const otMessage *aMessage, uint16_t aOffset, void *aBuf,
  */
 int otMessageWrite(otMessage *aMessage, uint16_t aOffset, const void *aBuf, uint16_t aLength);
 
+/**
+ * Get the contiguous chunks of the message buffers holding the bytes of a message from a given offset.
+ *
+ * The chunks allow reading or writing the message bytes in place, e.g., by passing them as an I/O vector to
+ * `readv()` or `writev()` instead of copying the message through an intermediate buffer. To receive data in place,
+ * set the message length to the maximum expected length first, then set it to the received length.
+ *
+ * The chunks remain valid until the length of the message is changed or the message is freed.
+ *
+ * @param[in]     aMessage    A pointer to a message buffer.
+ * @param[in]     aOffset     An offset in bytes.
+ * @param[out]    aChunks     A pointer to an array to output the chunks.
+ * @param[in,out] aNumChunks  On input, the number of entries in @p aChunks. On output, the number of chunks.
+ *
+ * @returns The number of message bytes in the chunks, which is less than the number of bytes from @p aOffset to the
+ *          end of the message if @p aChunks is too small.
+ *
+ * @sa otMessageRead
+ * @sa otMessageWrite
+ * @sa otMessageSetLength
+ *
+ */
+uint16_t otMessageGetChunks(otMessage *aMessage, uint16_t aOffset, otMessageChunk *aChunks, uint16_t *aNumChunks);
+
 /**
  * This structure represents an OpenThread message queue.
  */
@@ -289,6 +323,8 @@ typedef struct otBufferInfo
 {
     uint16_t           mTotalBuffers;         ///< The total number of buffers in the messages pool (0xffff if unknown).
     uint16_t           mFreeBuffers;          ///< The number of free buffers (0xffff if unknown).
+    uint16_t           mMaxUsedBuffers;       ///< The maximum number of buffers used at the same time.
+    uint32_t           mAllocFailures[4];     ///< The number of failed buffer allocations, per message priority.
     otMessageQueueInfo m6loSendQueue;         ///< Info about 6LoWPAN send queue.
     otMessageQueueInfo m6loReassemblyQueue;   ///< Info about 6LoWPAN reassembly queue.
     otMessageQueueInfo mIp6Queue;             ///< Info about IPv6 send queue.
@@ -369,6 +405,15 @@ otMessage *otMessageQueueGetNext(otMessageQueue *aQueue, const otMessage *aMessa
  */
 void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo);
 
+/**
+ * Reset the maximum number of used buffers and the buffer allocation failure counters of the Message Buffer
+ * information.
+ *
+ * @param[in]   aInstance    A pointer to the OpenThread instance.
+ *
+ */
+void otMessageResetBufferInfo(otInstance *aInstance);
+
 /**
  * @}
  *
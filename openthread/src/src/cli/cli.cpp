@@ -1562,6 +1562,8 @@ exit:
  * bufferinfo
  * total: 40
  * free: 40
+ * max used: 5
+ * alloc failures: 0 0 0 0
  * 6lo send: 0 0 0
  * 6lo reas: 0 0 0
  * ip6: 0 0 0
@@ -1576,6 +1578,9 @@ exit:
  * Gets the current message buffer information.
  * *   `total` displays the total number of message buffers in pool.
  * *   `free` displays the number of free message buffers.
+ * *   `max used` displays the maximum number of message buffers used at the same time.
+ * *   `alloc failures` displays the number of failed message buffer allocations, for the low, normal, high and
+ *     network control message priorities.
  * @par
  * Next, the CLI displays info about different queues used by the OpenThread stack,
  * for example `6lo send`. Each line after the queue represents info about a queue:
@@ -1586,8 +1591,6 @@ exit:
  */
 template <> otError Interpreter::Process<Cmd("bufferinfo")>(Arg aArgs[])
 {
-    OT_UNUSED_VARIABLE(aArgs);
-
     struct BufferInfoName
     {
         const otMessageQueueInfo otBufferInfo::*mQueuePtr;
@@ -1605,12 +1608,36 @@ template <> otError Interpreter::Process<Cmd("bufferinfo")>(Arg aArgs[])
         {&otBufferInfo::mApplicationCoapQueue, "application coap"},
     };
 
+    otError      error = OT_ERROR_NONE;
     otBufferInfo bufferInfo;
 
+    /**
+     * @cli bufferinfo reset
+     * @code
+     * bufferinfo reset
+     * Done
+     * @endcode
+     * @par
+     * Resets the `max used` and `alloc failures` message buffer information.
+     * @sa otMessageResetBufferInfo
+     */
+    if (aArgs[0] == "reset")
+    {
+        VerifyOrExit(aArgs[1].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+        otMessageResetBufferInfo(GetInstancePtr());
+        ExitNow();
+    }
+
+    VerifyOrExit(aArgs[0].IsEmpty(), error = OT_ERROR_INVALID_COMMAND);
+
     otMessageGetBufferInfo(GetInstancePtr(), &bufferInfo);
 
     OutputLine("total: %u", bufferInfo.mTotalBuffers);
     OutputLine("free: %u", bufferInfo.mFreeBuffers);
+    OutputLine("max used: %u", bufferInfo.mMaxUsedBuffers);
+    OutputLine("alloc failures: %lu %lu %lu %lu", ToUlong(bufferInfo.mAllocFailures[0]),
+               ToUlong(bufferInfo.mAllocFailures[1]), ToUlong(bufferInfo.mAllocFailures[2]),
+               ToUlong(bufferInfo.mAllocFailures[3]));
 
     for (const BufferInfoName &info : kBufferInfoNames)
     {
@@ -1618,7 +1645,8 @@ template <> otError Interpreter::Process<Cmd("bufferinfo")>(Arg aArgs[])
                    (bufferInfo.*info.mQueuePtr).mNumBuffers, ToUlong((bufferInfo.*info.mQueuePtr).mTotalBytes));
     }
 
-    return OT_ERROR_NONE;
+exit:
+    return error;
 }
 
 /**
@@ -89,6 +89,14 @@ int otMessageWrite(otMessage *aMessage, uint16_t aOffset, const void *aBuf, uint
     return aLength;
 }
 
+uint16_t otMessageGetChunks(otMessage *aMessage, uint16_t aOffset, otMessageChunk *aChunks, uint16_t *aNumChunks)
+{
+    AssertPointerIsNotNull(aChunks);
+    AssertPointerIsNotNull(aNumChunks);
+
+    return AsCoreType(aMessage).GetChunks(aOffset, aChunks, *aNumChunks);
+}
+
 void otMessageQueueInit(otMessageQueue *aQueue)
 {
     AssertPointerIsNotNull(aQueue);
@@ -131,4 +139,6 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
 {
     AsCoreType(aInstance).GetBufferInfo(AsCoreType(aBufferInfo));
 }
+
+void otMessageResetBufferInfo(otInstance *aInstance) { AsCoreType(aInstance).Get<MessagePool>().ResetCounters(); }
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
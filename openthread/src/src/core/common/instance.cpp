@@ -389,6 +389,17 @@ void Instance::GetBufferInfo(BufferInfo &aInfo)
     aInfo.mTotalBuffers = Get<MessagePool>().GetTotalBufferCount();
     aInfo.mFreeBuffers  = Get<MessagePool>().GetFreeBufferCount();
 
+    aInfo.mMaxUsedBuffers = Get<MessagePool>().GetMaxUsedBufferCount();
+
+    static_assert(OT_ARRAY_LENGTH(aInfo.mAllocFailures) == Message::kNumPriorities,
+                  "mAllocFailures does not match the number of message priorities");
+
+    for (uint8_t priority = 0; priority < Message::kNumPriorities; priority++)
+    {
+        aInfo.mAllocFailures[priority] =
+            Get<MessagePool>().GetAllocFailureCount(static_cast<Message::Priority>(priority));
+    }
+
     Get<MeshForwarder>().GetSendQueue().GetInfo(aInfo.m6loSendQueue);
     Get<MeshForwarder>().GetReassemblyQueue().GetInfo(aInfo.m6loReassemblyQueue);
     Get<Ip6::Ip6>().GetSendQueue().GetInfo(aInfo.mIp6Queue);
@@ -64,15 +64,33 @@ RegisterLogModule("Message");
 
 MessagePool::MessagePool(Instance &aInstance)
     : InstanceLocator(aInstance)
-#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
-    , mNumFreeBuffers(kNumBuffers)
+    , mNumUsedBuffers(0)
+    , mMaxUsedBuffers(0)
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+    , mSlabs(nullptr)
+    , mNumSlabBuffers(0)
 #endif
 {
+    memset(mAllocFailures, 0, sizeof(mAllocFailures));
+
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
     otPlatMessagePoolInit(&GetInstance(), kNumBuffers, sizeof(Buffer));
 #endif
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+MessagePool::~MessagePool(void)
+{
+    while (mSlabs != nullptr)
+    {
+        Slab *next = mSlabs->mNext;
+
+        Heap::Free(mSlabs);
+        mSlabs = next;
+    }
+}
+#endif
+
 Message *MessagePool::Allocate(Message::Type aType, uint16_t aReserveHeader, const Message::Settings &aSettings)
 {
     Error    error = kErrorNone;
@@ -115,6 +133,8 @@ Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
                buffer = static_cast<Buffer *>(Heap::CAlloc(1, sizeof(Buffer)))
 #elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
                buffer = static_cast<Buffer *>(otPlatMessagePoolNew(&GetInstance()))
+#elif OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+               buffer = AllocateElasticBuffer(aPriority)
 #else
                buffer = mBufferPool.Allocate()
 #endif
@@ -123,15 +143,15 @@ Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
         SuccessOrExit(ReclaimBuffers(aPriority));
     }
 
-#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
-    mNumFreeBuffers--;
-#endif
+    mNumUsedBuffers++;
+    mMaxUsedBuffers = Max(mMaxUsedBuffers, mNumUsedBuffers);
 
     buffer->SetNextBuffer(nullptr);
 
 exit:
     if (buffer == nullptr)
     {
+        mAllocFailures[aPriority]++;
         LogInfo("No available message buffer");
     }
 
@@ -147,16 +167,99 @@ void MessagePool::FreeBuffers(Buffer *aBuffer)
         Heap::Free(aBuffer);
 #elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
         otPlatMessagePoolFree(&GetInstance(), aBuffer);
+#elif OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+        FreeElasticBuffer(*aBuffer);
 #else
         mBufferPool.Free(*aBuffer);
-        mNumFreeBuffers++;
 #endif
+        mNumUsedBuffers--;
         aBuffer = next;
     }
 }
 
 Error MessagePool::ReclaimBuffers(Message::Priority aPriority) { return Get<MeshForwarder>().EvictMessage(aPriority); }
 
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+
+uint16_t MessagePool::GetReservedBufferCount(Message::Priority aPriority)
+{
+    // Returns the number of buffers kept for the messages with a
+    // priority higher than `aPriority`.
+
+    uint16_t reserved = 0;
+
+    switch (aPriority)
+    {
+    case Message::kPriorityLow:
+        reserved += OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_RESERVED_NORMAL_BUFFERS;
+        OT_FALL_THROUGH;
+    case Message::kPriorityNormal:
+        reserved += OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_RESERVED_HIGH_BUFFERS;
+        OT_FALL_THROUGH;
+    case Message::kPriorityHigh:
+        reserved += OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_RESERVED_NET_BUFFERS;
+        break;
+    case Message::kPriorityNet:
+        break;
+    }
+
+    return reserved;
+}
+
+Buffer *MessagePool::AllocateElasticBuffer(Message::Priority aPriority)
+{
+    Buffer *buffer = nullptr;
+
+    // A buffer is allocated only if the buffers reserved for the higher
+    // priorities remain available. Otherwise `nullptr` is returned and
+    // `NewBuffer()` tries to evict a lower priority message.
+
+    VerifyOrExit(mNumUsedBuffers + GetReservedBufferCount(aPriority) < kMaxBuffers);
+
+    if (mFreeBuffers.IsEmpty())
+    {
+        SuccessOrExit(AddSlab());
+    }
+
+    buffer = mFreeBuffers.Pop();
+
+exit:
+    return buffer;
+}
+
+Error MessagePool::AddSlab(void)
+{
+    Error error = kErrorNone;
+    Slab *slab;
+
+    VerifyOrExit(mNumSlabBuffers < kMaxBuffers, error = kErrorNoBufs);
+
+    slab = static_cast<Slab *>(Heap::CAlloc(1, sizeof(Slab)));
+    VerifyOrExit(slab != nullptr, error = kErrorNoBufs);
+
+    slab->mNext = mSlabs;
+    mSlabs      = slab;
+    mNumSlabBuffers += kSlabBuffers;
+
+    for (Buffer &buffer : slab->mBuffers)
+    {
+        mFreeBuffers.Push(buffer);
+    }
+
+    LogInfo("Grew message pool to %u buffers", mNumSlabBuffers);
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+
+void MessagePool::ResetCounters(void)
+{
+    mMaxUsedBuffers = mNumUsedBuffers;
+    memset(mAllocFailures, 0, sizeof(mAllocFailures));
+}
+
 uint16_t MessagePool::GetFreeBufferCount(void) const
 {
     uint16_t rval;
@@ -170,7 +273,7 @@ uint16_t MessagePool::GetFreeBufferCount(void) const
 #elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
     rval = otPlatMessagePoolNumFreeBuffers(&GetInstance());
 #else
-    rval = mNumFreeBuffers;
+    rval = GetTotalBufferCount() - mNumUsedBuffers;
 #endif
 
     return rval;
@@ -186,6 +289,8 @@ uint16_t MessagePool::GetTotalBufferCount(void) const
 #else
     rval = NumericLimits<uint16_t>::kMax;
 #endif
+#elif OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+    rval = kMaxBuffers;
 #else
     rval = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS;
 #endif
@@ -643,6 +748,30 @@ uint16_t Message::ReadBytes(uint16_t aOffset, void *aBuf, uint16_t aLength) cons
     return static_cast<uint16_t>(bufPtr - reinterpret_cast<uint8_t *>(aBuf));
 }
 
+uint16_t Message::GetChunks(uint16_t aOffset, otMessageChunk *aChunks, uint16_t &aNumChunks)
+{
+    uint16_t     length    = GetLength();
+    uint16_t     numChunks = 0;
+    uint16_t     numBytes  = 0;
+    MutableChunk chunk;
+
+    GetFirstChunk(aOffset, length, chunk);
+
+    while ((chunk.GetLength() > 0) && (numChunks < aNumChunks))
+    {
+        aChunks[numChunks].mData   = chunk.GetBytes();
+        aChunks[numChunks].mLength = chunk.GetLength();
+        numBytes += chunk.GetLength();
+        numChunks++;
+
+        GetNextChunk(length, chunk);
+    }
+
+    aNumChunks = numChunks;
+
+    return numBytes;
+}
+
 Error Message::Read(uint16_t aOffset, void *aBuf, uint16_t aLength) const
 {
     return (ReadBytes(aOffset, aBuf, aLength) == aLength) ? kErrorNone : kErrorParse;
@@ -59,6 +59,11 @@
 #include "thread/child_mask.hpp"
 #include "thread/link_quality.hpp"
 
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE &&                                   \
+    (OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE || OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT)
+#error "OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE conflicts with heap or platform message management."
+#endif
+
 /**
  * This struct represents an opaque (and empty) type for an OpenThread message buffer.
  *
@@ -730,6 +735,22 @@ public:
      */
     uint16_t ReadBytes(uint16_t aOffset, void *aBuf, uint16_t aLength) const;
 
+    /**
+     * This method gets the contiguous chunks of the message buffers holding the message bytes from a given offset.
+     *
+     * The chunks can be used to read or write the message bytes in place, e.g., as an I/O vector for `readv()` or
+     * `writev()`. They remain valid until the length of the message is changed or the message is freed.
+     *
+     * @param[in]     aOffset     Byte offset within the message of the first chunk.
+     * @param[out]    aChunks     A pointer to an array to output the chunks.
+     * @param[in,out] aNumChunks  On input, the number of entries in @p aChunks. On output, the number of chunks.
+     *
+     * @returns The number of message bytes in the chunks, which is less than the number of bytes from @p aOffset to
+     *          the end of the message if @p aChunks is too small.
+     *
+     */
+    uint16_t GetChunks(uint16_t aOffset, otMessageChunk *aChunks, uint16_t &aNumChunks);
+
     /**
      * This method reads a given number of bytes from the message.
      *
@@ -1729,18 +1750,79 @@ public:
     /**
      * This method returns the total number of buffers.
      *
+     * With the elastic message pool, this is the maximum number of buffers the pool can grow to.
+     *
      * @returns The total number of buffers, or 0xffff (UINT16_MAX) if number is unknown.
      *
      */
     uint16_t GetTotalBufferCount(void) const;
 
+    /**
+     * This method returns the maximum number of buffers in use at the same time.
+     *
+     * @returns The maximum number of buffers in use since the pool was initialized or `ResetCounters()` was called.
+     *
+     */
+    uint16_t GetMaxUsedBufferCount(void) const { return mMaxUsedBuffers; }
+
+    /**
+     * This method returns the number of failed buffer allocations for a message priority.
+     *
+     * @param[in]  aPriority  The message priority.
+     *
+     * @returns The number of failed buffer allocations since the pool was initialized or `ResetCounters()` was called.
+     *
+     */
+    uint32_t GetAllocFailureCount(Message::Priority aPriority) const { return mAllocFailures[aPriority]; }
+
+    /**
+     * This method resets the maximum number of used buffers and the allocation failure counters.
+     *
+     */
+    void ResetCounters(void);
+
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+    /**
+     * This destructor frees the slabs of the elastic message pool.
+     *
+     */
+    ~MessagePool(void);
+#endif
+
 private:
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+    static constexpr uint16_t kSlabBuffers = OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_SLAB_BUFFERS;
+    static constexpr uint16_t kMaxBuffers  = OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_MAX_BUFFERS;
+
+    static_assert(kSlabBuffers > 0 && (kMaxBuffers % kSlabBuffers) == 0,
+                  "ELASTIC_MAX_BUFFERS must be a multiple of ELASTIC_SLAB_BUFFERS");
+
+    struct Slab
+    {
+        Slab  *mNext;
+        Buffer mBuffers[kSlabBuffers];
+    };
+
+    Buffer *AllocateElasticBuffer(Message::Priority aPriority);
+    void    FreeElasticBuffer(Buffer &aBuffer) { mFreeBuffers.Push(aBuffer); }
+    Error   AddSlab(void);
+
+    static uint16_t GetReservedBufferCount(Message::Priority aPriority);
+#endif
+
     Buffer *NewBuffer(Message::Priority aPriority);
     void    FreeBuffers(Buffer *aBuffer);
     Error   ReclaimBuffers(Message::Priority aPriority);
 
-#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
-    uint16_t                  mNumFreeBuffers;
+    uint16_t mNumUsedBuffers;
+    uint16_t mMaxUsedBuffers;
+    uint32_t mAllocFailures[Message::kNumPriorities];
+
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+    Slab              *mSlabs;
+    uint16_t           mNumSlabBuffers;
+    LinkedList<Buffer> mFreeBuffers;
+#elif !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
     Pool<Buffer, kNumBuffers> mBufferPool;
 #endif
 };
@@ -202,4 +202,16 @@
 #define OPENTHREAD_CONFIG_IP6_BR_COUNTERS_ENABLE OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_IP6_CHECKSUM_SIMD_ENABLE
+ *
+ * Define as 1 to sum the checksum of large buffers with SSE2 or NEON instructions when the target supports them.
+ *
+ * The checksum is otherwise summed a 64-bit word at a time.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_CHECKSUM_SIMD_ENABLE
+#define OPENTHREAD_CONFIG_IP6_CHECKSUM_SIMD_ENABLE 1
+#endif
+
 #endif // CONFIG_IP6_H_
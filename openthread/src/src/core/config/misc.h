@@ -170,6 +170,77 @@
 #define OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS 44
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+ *
+ * Define to 1 to allocate the message buffers from the heap in slabs, as they are needed, up to
+ * `OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_MAX_BUFFERS` buffers. Allocated slabs are kept until the instance is
+ * finalized.
+ *
+ * The slabs are allocated with `otPlatCAlloc()` when `OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE` is set, which is
+ * recommended on platforms with a host heap (e.g. posix), and from the OpenThread heap otherwise.
+ *
+ * @note If this is set, OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS is ignored.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_SLAB_BUFFERS
+ *
+ * The number of message buffers in a slab of the elastic message pool.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_SLAB_BUFFERS
+#define OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_SLAB_BUFFERS 32
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_MAX_BUFFERS
+ *
+ * The maximum number of message buffers of the elastic message pool. It MUST be a multiple of
+ * `OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_SLAB_BUFFERS`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_MAX_BUFFERS
+#define OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_MAX_BUFFERS 2048
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_RESERVED_NET_BUFFERS
+ *
+ * The number of message buffers of the elastic message pool that only messages with network control priority (e.g.
+ * MLE) can use.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_RESERVED_NET_BUFFERS
+#define OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_RESERVED_NET_BUFFERS 32
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_RESERVED_HIGH_BUFFERS
+ *
+ * The number of message buffers of the elastic message pool that only messages with high priority or above can use,
+ * in addition to the buffers reserved for network control priority.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_RESERVED_HIGH_BUFFERS
+#define OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_RESERVED_HIGH_BUFFERS 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_RESERVED_NORMAL_BUFFERS
+ *
+ * The number of message buffers of the elastic message pool that only messages with normal priority or above can
+ * use, in addition to the buffers reserved for higher priorities.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_RESERVED_NORMAL_BUFFERS
+#define OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_RESERVED_NORMAL_BUFFERS 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE
  *
@@ -45,6 +45,20 @@
 #define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES 32
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+ *
+ * Define as 1 to index the EID-to-RLOC cache entries by EID with an open-addressed hash table.
+ *
+ * The index keeps the cost of looking up an EID (done for every forwarded message) and of moving an entry between the
+ * cache lists independent of the number of entries. It is intended for hosts (e.g., a posix Border Router) configured
+ * with a large `OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES`, and uses a few more bytes of RAM per entry.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_MAX_SNOOP_ENTRIES
  *
@@ -33,6 +33,16 @@
 
 #include "checksum.hpp"
 
+#include <string.h>
+
+#if OPENTHREAD_CONFIG_IP6_CHECKSUM_SIMD_ENABLE && defined(__SSE2__)
+#include <emmintrin.h>
+#define OT_CHECKSUM_USE_SSE2 1
+#elif OPENTHREAD_CONFIG_IP6_CHECKSUM_SIMD_ENABLE && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define OT_CHECKSUM_USE_NEON 1
+#endif
+
 #include "common/code_utils.hpp"
 #include "common/message.hpp"
 #include "net/icmp6.hpp"
@@ -70,10 +80,100 @@ void Checksum::AddUint16(uint16_t aUint16)
 
 void Checksum::AddData(const uint8_t *aBuffer, uint16_t aLength)
 {
-    for (uint16_t i = 0; i < aLength; i++)
+    uint16_t sum;
+    uint16_t newValue;
+
+    VerifyOrExit(aLength > 0);
+
+    // The one's complement sum does not depend on the byte order of the
+    // words, as long as the result is swapped back. Data starting at an
+    // odd index adds its words with their bytes swapped.
+
+    sum = Encoding::BigEndian::HostSwap16(Sum(aBuffer, aLength));
+
+    if (mAtOddIndex)
+    {
+        sum = Encoding::Swap16(sum);
+    }
+
+    newValue = mValue + sum;
+
+    if (newValue < mValue)
+    {
+        newValue++;
+    }
+
+    mValue      = newValue;
+    mAtOddIndex = (mAtOddIndex != ((aLength & 1) != 0));
+
+exit:
+    return;
+}
+
+uint16_t Checksum::Sum(const uint8_t *aBuffer, uint16_t aLength)
+{
+    // Adds the 64-bit words of the buffer in host byte order with end-around
+    // carry (2^64 is congruent to 1 modulo 0xffff), then folds the sum.
+
+    uint64_t sum = 0;
+    uint64_t word;
+
+#if OT_CHECKSUM_USE_SSE2
+    {
+        // Each 32-bit lane is widened to 64 bits, the lanes cannot overflow
+        // within the maximum length of a buffer.
+        const __m128i zero = _mm_setzero_si128();
+        __m128i       acc  = zero;
+        uint64_t      lanes[2];
+
+        for (; aLength >= sizeof(__m128i); aBuffer += sizeof(__m128i), aLength -= sizeof(__m128i))
+        {
+            __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(aBuffer));
+
+            acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(data, zero));
+            acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(data, zero));
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), acc);
+        sum = lanes[0] + lanes[1];
+        sum += (sum < lanes[1]);
+    }
+#elif OT_CHECKSUM_USE_NEON
+    {
+        uint64x2_t acc = vdupq_n_u64(0);
+
+        for (; aLength >= sizeof(uint32x4_t); aBuffer += sizeof(uint32x4_t), aLength -= sizeof(uint32x4_t))
+        {
+            acc = vpadalq_u32(acc, vreinterpretq_u32_u8(vld1q_u8(aBuffer)));
+        }
+
+        sum = vgetq_lane_u64(acc, 0) + vgetq_lane_u64(acc, 1);
+        sum += (sum < vgetq_lane_u64(acc, 1));
+    }
+#endif
+
+    for (; aLength >= sizeof(word); aBuffer += sizeof(word), aLength -= sizeof(word))
     {
-        AddUint8(aBuffer[i]);
+        memcpy(&word, aBuffer, sizeof(word));
+        sum += word;
+        sum += (sum < word);
     }
+
+    if (aLength > 0)
+    {
+        // A trailing odd byte is padded with zero, as the MSB of the last word.
+        word = 0;
+        memcpy(&word, aBuffer, aLength);
+        sum += word;
+        sum += (sum < word);
+    }
+
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+
+    return static_cast<uint16_t>(sum);
 }
 
 void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
@@ -130,6 +130,8 @@ private:
                        uint8_t             aIpProto,
                        const Message      &aMessage);
 
+    static uint16_t Sum(const uint8_t *aBuffer, uint16_t aLength);
+
     static constexpr uint16_t kValidRxChecksum = 0xffff;
 
     uint16_t mValue;
@@ -33,6 +33,8 @@
 
 #include "address_resolver.hpp"
 
+#include <string.h>
+
 #include "coap/coap_message.hpp"
 #include "common/as_core_type.hpp"
 #include "common/code_utils.hpp"
@@ -56,6 +58,9 @@ AddressResolver::AddressResolver(Instance &aInstance)
     : InstanceLocator(aInstance)
 #if OPENTHREAD_FTD
     , mCacheEntryPool(aInstance)
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    , mCacheEntryIndex(aInstance)
+#endif
     , mIcmpHandler(&AddressResolver::HandleIcmpReceive, this)
 #endif
 {
@@ -84,6 +89,10 @@ void AddressResolver::Clear(void)
             mCacheEntryPool.Free(*entry);
         }
     }
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    mCacheEntryIndex.Clear();
+#endif
 }
 
 Error AddressResolver::GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const
@@ -207,6 +216,14 @@ AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address
                                                              CacheEntryList    *&aList,
                                                              CacheEntry        *&aPrevEntry)
 {
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    CacheEntry *entry = mCacheEntryIndex.Find(aEid);
+
+    VerifyOrExit(entry != nullptr);
+
+    aList      = entry->GetList();
+    aPrevEntry = aList->GetPrevOf(*entry);
+#else
     CacheEntry     *entry   = nullptr;
     CacheEntryList *lists[] = {&mCachedList, &mSnoopedList, &mQueryList, &mQueryRetryList};
 
@@ -216,6 +233,7 @@ AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address
         entry = aList->FindMatching(aEid, aPrevEntry);
         VerifyOrExit(entry == nullptr);
     }
+#endif
 
 exit:
     return entry;
@@ -312,6 +330,10 @@ void AddressResolver::RemoveCacheEntry(CacheEntry     &aEntry,
 {
     aList.PopAfter(aPrevEntry);
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    mCacheEntryIndex.Remove(aEntry);
+#endif
+
     if (&aList == &mQueryList)
     {
         Get<MeshForwarder>().HandleResolved(aEntry.GetTarget(), kErrorDrop);
@@ -401,6 +423,10 @@ void AddressResolver::UpdateSnoopedCacheEntry(const Ip6::Address &aEid,
     entry->SetTarget(aEid);
     entry->SetRloc16(aRloc16);
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    mCacheEntryIndex.Add(*entry);
+#endif
+
     if (numNonEvictable < kMaxNonEvictableSnoopedEntries)
     {
         entry->SetCanEvict(false);
@@ -445,6 +471,9 @@ void AddressResolver::RestartAddressQueries(void)
 
     for (CacheEntry &entry : mQueryList)
     {
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+        entry.SetList(&mQueryList);
+#endif
         IgnoreError(SendAddressQuery(entry.GetTarget()));
 
         entry.SetTimeout(kAddressQueryTimeout);
@@ -491,6 +520,10 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
         entry->SetRetryDelay(kAddressQueryInitialRetryDelay);
         entry->SetCanEvict(false);
         list = nullptr;
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+        mCacheEntryIndex.Add(*entry);
+#endif
     }
 
     if ((list == &mCachedList) || (list == &mSnoopedList))
@@ -536,7 +569,15 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
     entry->SetTimeout(kAddressQueryTimeout);
 
     error = SendAddressQuery(aEid);
-    VerifyOrExit(error == kErrorNone, mCacheEntryPool.Free(*entry));
+
+    if (error != kErrorNone)
+    {
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+        mCacheEntryIndex.Remove(*entry);
+#endif
+        mCacheEntryPool.Free(*entry);
+        ExitNow();
+    }
 
     if (list == nullptr)
     {
@@ -1093,10 +1134,134 @@ void AddressResolver::CacheEntry::SetNext(CacheEntry *aEntry)
     VerifyOrExit(aEntry != nullptr, mNextIndex = kNoNextIndex);
     mNextIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*aEntry);
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    // An entry is always linked after its previous entry by a call
+    // to `SetNext()` (only the list head is set directly), so this
+    // keeps `mPrevIndex` of all the non-head entries up to date.
+    aEntry->mPrevIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*this);
+#endif
+
 exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+
+AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetPrev(void)
+{
+    return &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mPrevIndex);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// AddressResolver::CacheEntryIndex
+
+AddressResolver::CacheEntryIndex::CacheEntryIndex(Instance &aInstance)
+    : InstanceLocator(aInstance)
+{
+    Clear();
+}
+
+void AddressResolver::CacheEntryIndex::Clear(void)
+{
+    for (uint16_t &slot : mSlots)
+    {
+        slot = kEmptySlot;
+    }
+}
+
+uint16_t AddressResolver::CacheEntryIndex::GetHomeSlot(const Ip6::Address &aEid)
+{
+    // Mixes the four 32-bit words of the address (EIDs often share
+    // the same prefix and only differ in their IID).
+
+    uint32_t hash = 0;
+
+    for (uint8_t i = 0; i < sizeof(Ip6::Address); i += sizeof(uint32_t))
+    {
+        uint32_t word;
+
+        memcpy(&word, aEid.GetBytes() + i, sizeof(word));
+        hash = (hash ^ word) * 0x9e3779b1;
+    }
+
+    hash ^= (hash >> 16);
+
+    return static_cast<uint16_t>(hash % kNumSlots);
+}
+
+AddressResolver::CacheEntry &AddressResolver::CacheEntryIndex::GetEntryAt(uint16_t aSlot)
+{
+    return Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mSlots[aSlot]);
+}
+
+AddressResolver::CacheEntry *AddressResolver::CacheEntryIndex::Find(const Ip6::Address &aEid)
+{
+    CacheEntry *entry = nullptr;
+
+    for (uint16_t slot = GetHomeSlot(aEid); mSlots[slot] != kEmptySlot; slot = GetNextSlot(slot))
+    {
+        if (GetEntryAt(slot).Matches(aEid))
+        {
+            entry = &GetEntryAt(slot);
+            break;
+        }
+    }
+
+    return entry;
+}
+
+void AddressResolver::CacheEntryIndex::Add(CacheEntry &aEntry)
+{
+    uint16_t slot = GetHomeSlot(aEntry.GetTarget());
+
+    // There are more slots than cache entries, so an empty slot is
+    // always found.
+
+    while (mSlots[slot] != kEmptySlot)
+    {
+        slot = GetNextSlot(slot);
+    }
+
+    mSlots[slot] = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(aEntry);
+}
+
+void AddressResolver::CacheEntryIndex::Remove(const CacheEntry &aEntry)
+{
+    uint16_t index = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(aEntry);
+    uint16_t slot  = GetHomeSlot(aEntry.GetTarget());
+    uint16_t next;
+
+    while (mSlots[slot] != index)
+    {
+        VerifyOrExit(mSlots[slot] != kEmptySlot);
+        slot = GetNextSlot(slot);
+    }
+
+    // Backward shift deletion: move up the following entries of the
+    // probe sequence whose home slot is not between the freed slot
+    // and their current slot, so that no entry becomes unreachable
+    // (this avoids the need for tombstones).
+
+    for (next = GetNextSlot(slot); mSlots[next] != kEmptySlot; next = GetNextSlot(next))
+    {
+        uint16_t home = GetHomeSlot(GetEntryAt(next).GetTarget());
+        bool     stay = (slot <= next) ? ((slot < home) && (home <= next)) : ((slot < home) || (home <= next));
+
+        if (!stay)
+        {
+            mSlots[slot] = mSlots[next];
+            slot         = next;
+        }
+    }
+
+    mSlots[slot] = kEmptySlot;
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+
 #endif // OPENTHREAD_FTD
 
 } // namespace ot
@@ -51,6 +51,8 @@
 
 namespace ot {
 
+class UnitTester;
+
 /**
  * @addtogroup core-arp
  *
@@ -68,6 +70,7 @@ class AddressResolver : public InstanceLocator, private NonCopyable
 {
     friend class TimeTicker;
     friend class Tmf::Agent;
+    friend class ot::UnitTester;
 
     class CacheEntry;
     class CacheEntryList;
@@ -278,6 +281,12 @@ private:
 
         bool Matches(const Ip6::Address &aEid) const { return GetTarget() == aEid; }
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+        CacheEntry     *GetPrev(void);
+        CacheEntryList *GetList(void) { return mList; }
+        void            SetList(CacheEntryList *aList) { mList = aList; }
+#endif
+
     private:
         static constexpr uint16_t kNoNextIndex          = 0xffff;     // `mNextIndex` value when at end of list.
         static constexpr uint32_t kInvalidLastTransTime = 0xffffffff; // Value when `mLastTransactionTime` is invalid.
@@ -285,6 +294,10 @@ private:
         Ip6::Address      mTarget;
         Mac::ShortAddress mRloc16;
         uint16_t          mNextIndex;
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+        uint16_t        mPrevIndex; // Index of the previous entry, valid unless the entry is at the head of `mList`.
+        CacheEntryList *mList;
+#endif
 
         union
         {
@@ -308,7 +321,53 @@ private:
 
     class CacheEntryList : public LinkedList<CacheEntry>
     {
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    public:
+        void Push(CacheEntry &aEntry)
+        {
+            LinkedList<CacheEntry>::Push(aEntry);
+            aEntry.SetList(this);
+        }
+
+        CacheEntry *GetPrevOf(CacheEntry &aEntry) { return (GetHead() == &aEntry) ? nullptr : aEntry.GetPrev(); }
+#endif
+    };
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    // Open-addressed (linear probing) hash table mapping an EID to
+    // its cache entry. There are about twice as many slots as cache
+    // entries, so probe sequences stay short even when all the
+    // entries are in use.
+
+    class CacheEntryIndex : public InstanceLocator
+    {
+        friend class ot::UnitTester;
+
+    public:
+        explicit CacheEntryIndex(Instance &aInstance);
+
+        CacheEntry *Find(const Ip6::Address &aEid);
+        void        Add(CacheEntry &aEntry);
+        void        Remove(const CacheEntry &aEntry);
+        void        Clear(void);
+
+    private:
+        static constexpr uint16_t kEmptySlot = 0xffff;
+        static constexpr uint16_t kNumSlots  = 2 * kCacheEntries + 1;
+
+        static_assert(kCacheEntries < 0x7fff, "OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES is too large");
+
+        static uint16_t GetHomeSlot(const Ip6::Address &aEid);
+        static uint16_t GetNextSlot(uint16_t aSlot)
+        {
+            return (aSlot + 1 < kNumSlots) ? static_cast<uint16_t>(aSlot + 1) : 0;
+        }
+
+        CacheEntry &GetEntryAt(uint16_t aSlot);
+
+        uint16_t mSlots[kNumSlots];
     };
+#endif
 
     enum EntryChange : uint8_t
     {
@@ -373,6 +432,9 @@ private:
     CacheEntryList     mSnoopedList;
     CacheEntryList     mQueryList;
     CacheEntryList     mQueryRetryList;
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    CacheEntryIndex mCacheEntryIndex;
+#endif
     Ip6::Icmp::Handler mIcmpHandler;
 
 #endif // OPENTHREAD_FTD
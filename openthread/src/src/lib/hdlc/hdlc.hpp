@@ -44,6 +44,18 @@
 #include "common/debug.hpp"
 #include "common/encoding.hpp"
 
+/**
+ * @def OPENTHREAD_LIB_HDLC_FCS_SLICING_ENABLE
+ *
+ * Define as 1 to compute the FCS of blocks of data eight bytes at a time (slicing-by-8).
+ *
+ * This requires 3.5 KB of additional lookup tables.
+ *
+ */
+#ifndef OPENTHREAD_LIB_HDLC_FCS_SLICING_ENABLE
+#define OPENTHREAD_LIB_HDLC_FCS_SLICING_ENABLE 1
+#endif
+
 namespace ot {
 
 /**
@@ -99,6 +111,23 @@ public:
                                          : OT_ERROR_NO_BUFS;
     }
 
+    /**
+     * This method writes a block of bytes into the buffer and updates the write pointer (if space is available).
+     *
+     * @param[in]  aData    A pointer to the bytes to write.
+     * @param[in]  aLength  The number of bytes to write.
+     *
+     * @retval OT_ERROR_NONE     Successfully wrote the bytes and updated the pointer.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffer space to write the bytes, nothing was written.
+     *
+     */
+    otError WriteBytes(const uint8_t *aData, uint16_t aLength)
+    {
+        return CanWrite(aLength) ? (memcpy(mWritePointer, aData, aLength), mWritePointer += aLength,
+                                    mRemainingLength -= aLength, OT_ERROR_NONE)
+                                 : OT_ERROR_NO_BUFS;
+    }
+
     /**
      * This method undoes the last @p aUndoLength writes, removing them from frame.
      *
@@ -581,6 +610,8 @@ private:
         kStateEscaped,
     };
 
+    void DecodeByte(uint8_t aByte);
+
     State              mState;
     FrameWritePointer &mWritePointer;
     FrameHandler       mFrameHandler;
@@ -34,7 +34,12 @@
 
 #include "firewall.hpp"
 
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 #include <openthread/logging.h>
 #include <openthread/netdata.h>
@@ -51,33 +56,120 @@ namespace Posix {
 #error Configurations 'OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE' and 'OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE' are required.
 #endif
 
-static const char kIpsetCommand[]             = OPENTHREAD_POSIX_CONFIG_IPSET_BINARY;
+static const char kIpsetRestoreCommand[]      = OPENTHREAD_POSIX_CONFIG_IPSET_BINARY " restore";
 static const char kIngressDenySrcIpSet[]      = "otbr-ingress-deny-src";
 static const char kIngressDenySrcSwapIpSet[]  = "otbr-ingress-deny-src-swap";
 static const char kIngressAllowDstIpSet[]     = "otbr-ingress-allow-dst";
 static const char kIngressAllowDstSwapIpSet[] = "otbr-ingress-allow-dst-swap";
 
+/**
+ * This class batches ipset commands and applies them with a single `ipset restore` process.
+ *
+ * `ipset restore` is not transactional: it applies the commands as it reads them and stops at the first failing
+ * one. The flushes and additions only touch the swap sets, so a failure before the trailing swaps leaves the active
+ * sets untouched, but a failure of a later swap leaves the earlier swaps applied.
+ *
+ */
 class IpSetManager
 {
 public:
-    otError FlushIpSet(const char *aName);
-    otError AddToIpSet(const char *aSetName, const char *aAddress);
-    otError SwapIpSets(const char *aSetName1, const char *aSetName2);
+    IpSetManager(void)
+        : mFile(nullptr)
+        , mSigPipePending(false)
+    {
+    }
+
+    otError Begin(void);
+    void    FlushIpSet(const char *aName);
+    void    AddToIpSet(const char *aSetName, const char *aAddress);
+    void    SwapIpSets(const char *aSetName1, const char *aSetName2);
+    otError Commit(void);
+
+private:
+    void BlockSigPipe(void);
+    void UnblockSigPipe(void);
+
+    FILE    *mFile;
+    sigset_t mSigMask;
+    bool     mSigPipePending;
 };
 
-inline otError IpSetManager::FlushIpSet(const char *aName)
+void IpSetManager::BlockSigPipe(void)
 {
-    return ExecuteCommand("%s flush %s", kIpsetCommand, aName);
+    sigset_t sigPipe;
+    sigset_t pending;
+
+    // Writing to the pipe must not kill the process when `ipset` exits early. SIGPIPE is raised in the writing
+    // thread, so it is only blocked in this thread and the process-wide disposition is left untouched.
+    sigemptyset(&sigPipe);
+    sigaddset(&sigPipe, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &sigPipe, &mSigMask);
+
+    sigpending(&pending);
+    mSigPipePending = sigismember(&pending, SIGPIPE);
 }
 
-inline otError IpSetManager::AddToIpSet(const char *aSetName, const char *aAddress)
+void IpSetManager::UnblockSigPipe(void)
 {
-    return ExecuteCommand("%s add %s %s -exist", kIpsetCommand, aSetName, aAddress);
+    sigset_t        sigPipe;
+    struct timespec timeout = {0, 0};
+
+    sigemptyset(&sigPipe);
+    sigaddset(&sigPipe, SIGPIPE);
+
+    // Discards the SIGPIPE raised by the writes to the pipe, unless one was already pending before.
+    if (!mSigPipePending)
+    {
+        while (sigtimedwait(&sigPipe, nullptr, &timeout) == -1 && errno == EINTR)
+        {
+        }
+    }
+
+    pthread_sigmask(SIG_SETMASK, &mSigMask, nullptr);
 }
 
-inline otError IpSetManager::SwapIpSets(const char *aSetName1, const char *aSetName2)
+otError IpSetManager::Begin(void)
 {
-    return ExecuteCommand("%s swap %s %s", kIpsetCommand, aSetName1, aSetName2);
+    otError error = OT_ERROR_NONE;
+
+    BlockSigPipe();
+    mFile = popen(kIpsetRestoreCommand, "w");
+    VerifyOrExit(mFile != nullptr, error = OT_ERROR_FAILED);
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        UnblockSigPipe();
+    }
+    return error;
+}
+
+inline void IpSetManager::FlushIpSet(const char *aName) { fprintf(mFile, "flush %s\n", aName); }
+
+inline void IpSetManager::AddToIpSet(const char *aSetName, const char *aAddress)
+{
+    fprintf(mFile, "add %s %s -exist\n", aSetName, aAddress);
+}
+
+inline void IpSetManager::SwapIpSets(const char *aSetName1, const char *aSetName2)
+{
+    fprintf(mFile, "swap %s %s\n", aSetName1, aSetName2);
+}
+
+otError IpSetManager::Commit(void)
+{
+    otError error = OT_ERROR_NONE;
+    int     exitCode;
+
+    VerifyOrExit(mFile != nullptr, error = OT_ERROR_INVALID_STATE);
+    exitCode = pclose(mFile);
+    mFile    = nullptr;
+    UnblockSigPipe();
+    otLogInfoPlat("Execute command `%s` = %d", kIpsetRestoreCommand, exitCode);
+    VerifyOrExit(exitCode == 0, error = OT_ERROR_FAILED);
+
+exit:
+    return error;
 }
 
 void UpdateIpSets(otInstance *aInstance)
@@ -89,9 +181,11 @@ void UpdateIpSets(otInstance *aInstance)
     char                  prefixBuf[OT_IP6_PREFIX_STRING_SIZE];
     IpSetManager          ipSetManager;
 
+    SuccessOrExit(error = ipSetManager.Begin());
+
     // 1. Flush the '*-swap' ipsets
-    SuccessOrExit(error = ipSetManager.FlushIpSet(kIngressAllowDstSwapIpSet));
-    SuccessOrExit(error = ipSetManager.FlushIpSet(kIngressDenySrcSwapIpSet));
+    ipSetManager.FlushIpSet(kIngressAllowDstSwapIpSet);
+    ipSetManager.FlushIpSet(kIngressDenySrcSwapIpSet);
 
     // 2. Update otbr-deny-src-swap
     while (otNetDataGetNextOnMeshPrefix(aInstance, &iterator, &config) == OT_ERROR_NONE)
@@ -101,25 +195,28 @@ void UpdateIpSets(otInstance *aInstance)
             continue;
         }
         otIp6PrefixToString(&config.mPrefix, prefixBuf, sizeof(prefixBuf));
-        SuccessOrExit(error = ipSetManager.AddToIpSet(kIngressDenySrcSwapIpSet, prefixBuf));
+        ipSetManager.AddToIpSet(kIngressDenySrcSwapIpSet, prefixBuf);
     }
     memcpy(prefix.mPrefix.mFields.m8, otThreadGetMeshLocalPrefix(aInstance)->m8,
            sizeof(otThreadGetMeshLocalPrefix(aInstance)->m8));
     prefix.mLength = OT_IP6_PREFIX_BITSIZE;
     otIp6PrefixToString(&prefix, prefixBuf, sizeof(prefixBuf));
-    SuccessOrExit(error = ipSetManager.AddToIpSet(kIngressDenySrcSwapIpSet, prefixBuf));
+    ipSetManager.AddToIpSet(kIngressDenySrcSwapIpSet, prefixBuf);
 
     // 3. Update otbr-allow-dst-swap
     iterator = OT_NETWORK_DATA_ITERATOR_INIT;
     while (otNetDataGetNextOnMeshPrefix(aInstance, &iterator, &config) == OT_ERROR_NONE)
     {
         otIp6PrefixToString(&config.mPrefix, prefixBuf, sizeof(prefixBuf));
-        SuccessOrExit(error = ipSetManager.AddToIpSet(kIngressAllowDstSwapIpSet, prefixBuf));
+        ipSetManager.AddToIpSet(kIngressAllowDstSwapIpSet, prefixBuf);
     }
 
     // 4. Swap ipsets to let them take effect
-    SuccessOrExit(error = ipSetManager.SwapIpSets(kIngressDenySrcSwapIpSet, kIngressDenySrcIpSet));
-    SuccessOrExit(error = ipSetManager.SwapIpSets(kIngressAllowDstSwapIpSet, kIngressAllowDstIpSet));
+    ipSetManager.SwapIpSets(kIngressDenySrcSwapIpSet, kIngressDenySrcIpSet);
+    ipSetManager.SwapIpSets(kIngressAllowDstSwapIpSet, kIngressAllowDstIpSet);
+
+    // 5. Apply all the commands with a single process
+    SuccessOrExit(error = ipSetManager.Commit());
 
 exit:
     if (error != OT_ERROR_NONE)
@@ -86,6 +86,7 @@
 #include <sys/socket.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
@@ -274,7 +275,12 @@ enum
 };
 #endif
 
-static constexpr size_t kMaxIp6Size = OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH;
+static constexpr size_t   kMaxIp6Size              = OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH;
+static constexpr uint16_t kMaxTunPacketsPerProcess = OPENTHREAD_POSIX_CONFIG_TUN_MAX_PACKETS_PER_PROCESS;
+
+// The maximum number of message chunks of an IPv6 packet, every message buffer but the first one holds more than
+// half of `OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE` bytes.
+static constexpr uint16_t kMaxIp6Chunks = kMaxIp6Size / (OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE / 2) + 2;
 #if defined(RTM_NEWLINK) && defined(RTM_DELLINK)
 static bool sIsSyncingState = false;
 #endif
@@ -941,14 +947,21 @@ static void processReceive(otMessage *aMessage, void *aContext)
 {
     OT_UNUSED_VARIABLE(aContext);
 
-    char     packet[kMaxIp6Size + 4];
-    otError  error     = OT_ERROR_NONE;
-    uint16_t length    = otMessageGetLength(aMessage);
-    size_t   offset    = 0;
-    uint16_t maxLength = sizeof(packet) - 4;
+    otMessageChunk chunks[kMaxIp6Chunks];
+    struct iovec   iov[kMaxIp6Chunks + 1];
+    otError        error     = OT_ERROR_NONE;
+    uint16_t       length    = otMessageGetLength(aMessage);
+    uint16_t       numChunks = kMaxIp6Chunks;
+    int            iovCount  = 0;
+    ssize_t        total     = length;
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
     // BSD tunnel drivers use (for legacy reasons) a 4-byte header to determine the address family of the packet
-    offset += 4;
+    uint8_t header[4] = {0, 0, (PF_INET6 << 8) & 0xFF, (PF_INET6 << 0) & 0xFF};
+
+    iov[iovCount].iov_base = header;
+    iov[iovCount].iov_len  = sizeof(header);
+    iovCount++;
+    total += sizeof(header);
 #endif
 
     assert(gInstance == aContext);
@@ -956,22 +969,25 @@ static void processReceive(otMessage *aMessage, void *aContext)
 
     VerifyOrExit(sTunFd > 0);
 
-    VerifyOrExit(otMessageRead(aMessage, 0, &packet[offset], maxLength) == length, error = OT_ERROR_NO_BUFS);
+    // The packet is written from the message buffers, without copying it.
+    VerifyOrExit(otMessageGetChunks(aMessage, 0, chunks, &numChunks) == length, error = OT_ERROR_NO_BUFS);
 
 #if OPENTHREAD_POSIX_LOG_TUN_PACKETS
     otLogInfoPlat("[netif] Packet from NCP (%u bytes)", static_cast<uint16_t>(length));
-    otDumpInfoPlat("", &packet[offset], length);
 #endif
 
-#if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
-    packet[0] = 0;
-    packet[1] = 0;
-    packet[2] = (PF_INET6 << 8) & 0xFF;
-    packet[3] = (PF_INET6 << 0) & 0xFF;
-    length += 4;
+    for (uint16_t i = 0; i < numChunks; i++)
+    {
+        iov[iovCount].iov_base = chunks[i].mData;
+        iov[iovCount].iov_len  = chunks[i].mLength;
+        iovCount++;
+
+#if OPENTHREAD_POSIX_LOG_TUN_PACKETS
+        otDumpInfoPlat("", chunks[i].mData, chunks[i].mLength);
 #endif
+    }
 
-    VerifyOrExit(write(sTunFd, packet, length) == length, perror("write"); error = OT_ERROR_FAILED);
+    VerifyOrExit(writev(sTunFd, iov, iovCount) == total, perror("writev"); error = OT_ERROR_FAILED);
 
 exit:
     otMessageFree(aMessage);
@@ -982,52 +998,130 @@ exit:
     }
 }
 
-static void processTransmit(otInstance *aInstance)
+#ifdef __linux__
+static otMessage *newTunMessage(otInstance *aInstance, const otMessageSettings &aSettings)
+{
+    // Allocate the message buffers for an IPv6 packet of the maximum size,
+    // so that the packet can be read in place. The unused buffers are freed
+    // once the length of the packet is known.
+    otMessage *message = otIp6NewMessage(aInstance, &aSettings);
+
+    if (message != nullptr && otMessageSetLength(message, kMaxIp6Size) != OT_ERROR_NONE)
+    {
+        otMessageFree(message);
+        message = nullptr;
+    }
+
+    return message;
+}
+
+static ssize_t readTunMessage(otMessage *aMessage)
+{
+    otMessageChunk chunks[kMaxIp6Chunks];
+    struct iovec   iov[kMaxIp6Chunks];
+    uint16_t       numChunks = kMaxIp6Chunks;
+    uint16_t       length;
+
+    length = otMessageGetChunks(aMessage, 0, chunks, &numChunks);
+    assert(length == kMaxIp6Size);
+    OT_UNUSED_VARIABLE(length);
+
+    for (uint16_t i = 0; i < numChunks; i++)
+    {
+        iov[i].iov_base = chunks[i].mData;
+        iov[i].iov_len  = chunks[i].mLength;
+    }
+
+    return readv(sTunFd, iov, numChunks);
+}
+#endif // __linux__
+
+static otError transmitPacket(otInstance *aInstance, char *aPacket)
 {
-    otMessage *message = nullptr;
-    ssize_t    rval;
-    char       packet[kMaxIp6Size];
-    otError    error  = OT_ERROR_NONE;
-    size_t     offset = 0;
+    otMessage        *message = nullptr;
+    otMessageSettings settings;
+    ssize_t           rval;
+    otError           error  = OT_ERROR_NONE;
+    size_t            offset = 0;
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE && OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
     bool isIp4 = false;
 #endif
 
-    assert(gInstance == aInstance);
+    settings.mLinkSecurityEnabled = (otThreadGetDeviceRole(aInstance) != OT_DEVICE_ROLE_DISABLED);
+    settings.mPriority            = OT_MESSAGE_PRIORITY_LOW;
+
+#ifdef __linux__
+    // Read the packet directly into the message buffers when there are
+    // enough free buffers, otherwise read it into the packet buffer.
+    message = newTunMessage(aInstance, settings);
+
+    if (message != nullptr)
+    {
+        rval = readTunMessage(message);
+    }
+    else
+#endif
+    {
+        rval = read(sTunFd, aPacket, kMaxIp6Size);
+    }
+
+    if (rval < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+        // All the pending packets have been read.
+        ExitNow(error = OT_ERROR_ALREADY);
+    }
 
-    rval = read(sTunFd, packet, sizeof(packet));
     VerifyOrExit(rval > 0, error = OT_ERROR_FAILED);
 
+    if (message != nullptr)
+    {
+        // Shrinking the message frees the unused buffers and cannot fail.
+        IgnoreError(otMessageSetLength(message, static_cast<uint16_t>(rval)));
+
+#if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
+        {
+            uint8_t version;
+
+            // IPv4 packets are sent from an IPv4 message, copy them into
+            // the packet buffer.
+            if (otMessageRead(message, 0, &version, sizeof(version)) == sizeof(version) && (version & 0xf0) == 0x40)
+            {
+                otMessageRead(message, 0, aPacket, static_cast<uint16_t>(rval));
+                otMessageFree(message);
+                message = nullptr;
+            }
+        }
+#endif
+    }
+
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
     // BSD tunnel drivers have (for legacy reasons), may have a 4-byte header on them
-    if ((rval >= 4) && (packet[0] == 0) && (packet[1] == 0))
+    if ((rval >= 4) && (aPacket[0] == 0) && (aPacket[1] == 0))
     {
         rval -= 4;
         offset = 4;
     }
 #endif
 
+    if (message == nullptr)
     {
-        otMessageSettings settings;
-
-        settings.mLinkSecurityEnabled = (otThreadGetDeviceRole(aInstance) != OT_DEVICE_ROLE_DISABLED);
-        settings.mPriority            = OT_MESSAGE_PRIORITY_LOW;
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
-        isIp4   = (packet[offset] & 0xf0) == 0x40;
+        isIp4   = (aPacket[offset] & 0xf0) == 0x40;
         message = isIp4 ? otIp4NewMessage(aInstance, &settings) : otIp6NewMessage(aInstance, &settings);
 #else
         message = otIp6NewMessage(aInstance, &settings);
 #endif
         VerifyOrExit(message != nullptr, error = OT_ERROR_NO_BUFS);
+
+        SuccessOrExit(error = otMessageAppend(message, &aPacket[offset], static_cast<uint16_t>(rval)));
     }
 
 #if OPENTHREAD_POSIX_LOG_TUN_PACKETS
+    otMessageRead(message, 0, &aPacket[offset], static_cast<uint16_t>(rval));
     otLogInfoPlat("[netif] Packet to NCP (%hu bytes)", static_cast<uint16_t>(rval));
-    otDumpInfoPlat("", &packet[offset], static_cast<size_t>(rval));
+    otDumpInfoPlat("", &aPacket[offset], static_cast<size_t>(rval));
 #endif
 
-    SuccessOrExit(error = otMessageAppend(message, &packet[offset], static_cast<uint16_t>(rval)));
-
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
     error = isIp4 ? otNat64Send(aInstance, message) : otIp6Send(aInstance, message);
 #else
@@ -1041,15 +1135,35 @@ exit:
         otMessageFree(message);
     }
 
-    if (error != OT_ERROR_NONE)
+    if (error == OT_ERROR_DROP)
     {
-        if (error == OT_ERROR_DROP)
-        {
-            otLogInfoPlat("[netif] Message dropped by Thread");
-        }
-        else
+        otLogInfoPlat("[netif] Message dropped by Thread");
+    }
+    else if (error != OT_ERROR_NONE && error != OT_ERROR_ALREADY)
+    {
+        otLogWarnPlat("[netif] Failed to transmit, error:%s", otThreadErrorToString(error));
+    }
+
+    return error;
+}
+
+static void processTransmit(otInstance *aInstance)
+{
+    char packet[kMaxIp6Size];
+
+    assert(gInstance == aInstance);
+
+    // Drain the packets queued on the tun device, so that a burst from the
+    // host costs one mainloop iteration instead of one per packet. Stop early
+    // once the message pool is exhausted and leave the remaining packets in
+    // the kernel queue until buffers are released by the next iterations.
+    for (uint16_t i = 0; i < kMaxTunPacketsPerProcess; i++)
+    {
+        otError error = transmitPacket(aInstance, packet);
+
+        if (error == OT_ERROR_ALREADY || error == OT_ERROR_FAILED || error == OT_ERROR_NO_BUFS)
         {
-            otLogWarnPlat("[netif] Failed to transmit, error:%s", otThreadErrorToString(error));
+            break;
         }
     }
 }
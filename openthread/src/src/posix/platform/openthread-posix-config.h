@@ -136,6 +136,17 @@
 #define OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_SETTINGS_COMPACTION_THRESHOLD
+ *
+ * The settings file is an append-only log of changes. It is compacted when the stale records take more than this
+ * number of bytes and more than the live records.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_SETTINGS_COMPACTION_THRESHOLD
+#define OPENTHREAD_POSIX_CONFIG_SETTINGS_COMPACTION_THRESHOLD 4096
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_NETIF_PREFIX_ROUTE_METRIC
  *
@@ -149,6 +160,17 @@
 #define OPENTHREAD_POSIX_CONFIG_NETIF_PREFIX_ROUTE_METRIC 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_TUN_MAX_PACKETS_PER_PROCESS
+ *
+ * This setting configures the maximum number of packets read from the Thread network interface in one mainloop
+ * iteration. Define as 1 to read a single packet per iteration.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_TUN_MAX_PACKETS_PER_PROCESS
+#define OPENTHREAD_POSIX_CONFIG_TUN_MAX_PACKETS_PER_PROCESS 32
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_INSTALL_OMR_ROUTES_ENABLE
  *
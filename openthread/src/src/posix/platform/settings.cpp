@@ -41,7 +41,9 @@
 #include <stddef.h>
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <openthread/logging.h>
@@ -60,7 +62,65 @@
 
 static const size_t kMaxFileNameSize = sizeof(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH) + 32;
 
-static int sSettingsFd = -1;
+/*
+ * The settings file is an append-only log of the changes to the settings. A change is persisted by appending a
+ * record, and the values are kept in memory so that reading a setting does not touch the file. The log is compacted
+ * into a new file, which replaces the log, when the stale records take more space than the live ones.
+ *
+ * Each record is protected by a CRC, a torn write at the end of the log is discarded when it is replayed.
+ *
+ */
+
+static const uint32_t kLogMagic          = 0x4c53544f; // "OTSL"
+static const uint16_t kLogVersion        = 1;
+static const uint16_t kKeyTableSize      = 64;
+static const off_t    kCompactionMinSize = OPENTHREAD_POSIX_CONFIG_SETTINGS_COMPACTION_THRESHOLD;
+
+enum : uint8_t
+{
+    kOperationAdd    = 1, // Add a value to the key.
+    kOperationSet    = 2, // Replace all the values of the key by a value.
+    kOperationDelete = 3, // Delete the value at `mIndex`, or all values if `mIndex` is -1.
+};
+
+OT_TOOL_PACKED_BEGIN
+struct LogHeader
+{
+    uint32_t mMagic;
+    uint16_t mVersion;
+    uint16_t mReserved;
+} OT_TOOL_PACKED_END;
+
+OT_TOOL_PACKED_BEGIN
+struct LogRecord
+{
+    uint16_t mKey;
+    uint16_t mLength;
+    uint8_t  mOperation;
+    uint8_t  mReserved[3];
+    int32_t  mIndex;
+    uint32_t mCrc; // CRC32 of the record, with `mCrc` set to zero, followed by the value.
+} OT_TOOL_PACKED_END;
+
+struct SettingsValue
+{
+    uint16_t mLength;
+    uint8_t  mData[1];
+};
+
+struct SettingsKey
+{
+    SettingsKey    *mNext;
+    SettingsValue **mValues;
+    uint16_t        mKey;
+    uint16_t        mNumValues;
+    uint16_t        mCapacity;
+};
+
+static int          sSettingsFd = -1;
+static SettingsKey *sKeyTable[kKeyTableSize];
+static off_t        sLogSize  = 0; // Size of the settings file.
+static off_t        sLiveSize = 0; // Size of the settings file once compacted.
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
 static const uint16_t *sSensitiveKeys       = nullptr;
@@ -82,6 +142,164 @@ exit:
 }
 #endif
 
+static uint32_t crc32Update(uint32_t aCrc, const uint8_t *aData, size_t aLength)
+{
+    // CRC-32 (IEEE 802.3), processed one nibble at a time.
+    static const uint32_t kTable[16] = {
+        0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+        0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c,
+    };
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        aCrc ^= aData[i];
+        aCrc = (aCrc >> 4) ^ kTable[aCrc & 0x0f];
+        aCrc = (aCrc >> 4) ^ kTable[aCrc & 0x0f];
+    }
+
+    return aCrc;
+}
+
+static uint32_t calculateRecordCrc(const LogRecord &aRecord, const uint8_t *aValue)
+{
+    LogRecord record = aRecord;
+    uint32_t  crc    = 0xffffffff;
+
+    record.mCrc = 0;
+    crc         = crc32Update(crc, reinterpret_cast<const uint8_t *>(&record), sizeof(record));
+    crc         = crc32Update(crc, aValue, aRecord.mLength);
+
+    return ~crc;
+}
+
+static off_t getRecordSize(uint16_t aValueLength) { return static_cast<off_t>(sizeof(LogRecord) + aValueLength); }
+
+static SettingsKey *findKey(uint16_t aKey)
+{
+    SettingsKey *entry = sKeyTable[aKey % kKeyTableSize];
+
+    while (entry != nullptr && entry->mKey != aKey)
+    {
+        entry = entry->mNext;
+    }
+
+    return entry;
+}
+
+static void addValue(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    SettingsKey   *entry = findKey(aKey);
+    SettingsValue *value;
+
+    if (entry == nullptr)
+    {
+        entry = static_cast<SettingsKey *>(calloc(1, sizeof(SettingsKey)));
+        VerifyOrDie(entry != nullptr, OT_EXIT_FAILURE);
+
+        entry->mKey                       = aKey;
+        entry->mNext                      = sKeyTable[aKey % kKeyTableSize];
+        sKeyTable[aKey % kKeyTableSize] = entry;
+    }
+
+    if (entry->mNumValues == entry->mCapacity)
+    {
+        uint16_t        capacity = (entry->mCapacity == 0) ? 4 : entry->mCapacity * 2;
+        SettingsValue **values =
+            static_cast<SettingsValue **>(realloc(entry->mValues, capacity * sizeof(SettingsValue *)));
+
+        VerifyOrDie(values != nullptr, OT_EXIT_FAILURE);
+        entry->mValues   = values;
+        entry->mCapacity = capacity;
+    }
+
+    value = static_cast<SettingsValue *>(malloc(offsetof(SettingsValue, mData) + aValueLength));
+    VerifyOrDie(value != nullptr, OT_EXIT_FAILURE);
+
+    value->mLength = aValueLength;
+
+    if (aValueLength > 0)
+    {
+        memcpy(value->mData, aValue, aValueLength);
+    }
+
+    entry->mValues[entry->mNumValues++] = value;
+    sLiveSize += getRecordSize(aValueLength);
+}
+
+static otError deleteValue(uint16_t aKey, int aIndex)
+{
+    otError      error = OT_ERROR_NONE;
+    SettingsKey *entry = findKey(aKey);
+
+    VerifyOrExit(entry != nullptr && entry->mNumValues > 0, error = OT_ERROR_NOT_FOUND);
+    VerifyOrExit(aIndex >= -1 && aIndex < static_cast<int>(entry->mNumValues), error = OT_ERROR_NOT_FOUND);
+
+    {
+        uint16_t first = (aIndex == -1) ? 0 : static_cast<uint16_t>(aIndex);
+        uint16_t last  = (aIndex == -1) ? entry->mNumValues : first + 1;
+
+        for (uint16_t i = first; i < last; i++)
+        {
+            sLiveSize -= getRecordSize(entry->mValues[i]->mLength);
+            free(entry->mValues[i]);
+        }
+
+        memmove(&entry->mValues[first], &entry->mValues[last], (entry->mNumValues - last) * sizeof(SettingsValue *));
+        entry->mNumValues -= last - first;
+    }
+
+exit:
+    return error;
+}
+
+static void clearValues(void)
+{
+    for (SettingsKey *&head : sKeyTable)
+    {
+        while (head != nullptr)
+        {
+            SettingsKey *next = head->mNext;
+
+            for (uint16_t i = 0; i < head->mNumValues; i++)
+            {
+                free(head->mValues[i]);
+            }
+
+            free(head->mValues);
+            free(head);
+            head = next;
+        }
+    }
+
+    sLiveSize = sizeof(LogHeader);
+}
+
+static otError applyRecord(const LogRecord &aRecord, const uint8_t *aValue)
+{
+    otError error = OT_ERROR_NONE;
+
+    switch (aRecord.mOperation)
+    {
+    case kOperationSet:
+        IgnoreError(deleteValue(aRecord.mKey, -1));
+        OT_FALL_THROUGH;
+
+    case kOperationAdd:
+        addValue(aRecord.mKey, aValue, aRecord.mLength);
+        break;
+
+    case kOperationDelete:
+        error = deleteValue(aRecord.mKey, aRecord.mIndex);
+        break;
+
+    default:
+        error = OT_ERROR_PARSE;
+        break;
+    }
+
+    return error;
+}
+
 static void getSettingsFileName(otInstance *aInstance, char aFileName[kMaxFileNameSize], bool aSwap)
 {
     const char *offset = getenv("PORT_OFFSET");
@@ -106,56 +324,227 @@ static int swapOpen(otInstance *aInstance)
     return fd;
 }
 
+static void swapPersist(otInstance *aInstance, int aFd)
+{
+    char swapFile[kMaxFileNameSize];
+    char dataFile[kMaxFileNameSize];
+
+    getSettingsFileName(aInstance, swapFile, true);
+    getSettingsFileName(aInstance, dataFile, false);
+
+    VerifyOrDie(0 == close(sSettingsFd), OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(0 == fsync(aFd), OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(0 == rename(swapFile, dataFile), OT_EXIT_ERROR_ERRNO);
+
+    sSettingsFd = aFd;
+}
+
+static void writeHeader(int aFd)
+{
+    LogHeader header;
+
+    header.mMagic    = kLogMagic;
+    header.mVersion  = kLogVersion;
+    header.mReserved = 0;
+
+    VerifyOrDie(write(aFd, &header, sizeof(header)) == sizeof(header), OT_EXIT_FAILURE);
+}
+
+static void writeRecord(int            aFd,
+                        uint8_t        aOperation,
+                        uint16_t       aKey,
+                        int            aIndex,
+                        const uint8_t *aValue,
+                        uint16_t       aValueLength)
+{
+    LogRecord    record;
+    struct iovec iov[2];
+
+    memset(&record, 0, sizeof(record));
+    record.mKey       = aKey;
+    record.mLength    = aValueLength;
+    record.mOperation = aOperation;
+    record.mIndex     = aIndex;
+    record.mCrc       = calculateRecordCrc(record, aValue);
+
+    iov[0].iov_base = &record;
+    iov[0].iov_len  = sizeof(record);
+    iov[1].iov_base = const_cast<uint8_t *>(aValue);
+    iov[1].iov_len  = aValueLength;
+
+    VerifyOrDie(writev(aFd, iov, (aValueLength > 0) ? 2 : 1) == getRecordSize(aValueLength), OT_EXIT_FAILURE);
+}
+
 /**
- * This function reads @p aLength bytes from the data file and appends to the swap file.
+ * This function writes the live records to the swap file, and replaces the settings file with it.
  *
- * @param[in]   aFd     The file descriptor of the current swap file.
- * @param[in]   aLength Number of bytes to copy.
+ */
+static void compact(otInstance *aInstance)
+{
+    int swapFd = swapOpen(aInstance);
+
+    writeHeader(swapFd);
+
+    for (const SettingsKey *entry : sKeyTable)
+    {
+        for (; entry != nullptr; entry = entry->mNext)
+        {
+            for (uint16_t i = 0; i < entry->mNumValues; i++)
+            {
+                writeRecord(swapFd, kOperationAdd, entry->mKey, 0, entry->mValues[i]->mData,
+                            entry->mValues[i]->mLength);
+            }
+        }
+    }
+
+    swapPersist(aInstance, swapFd);
+    sLogSize = sLiveSize;
+}
+
+/**
+ * This function appends a record to the settings file and applies it to the values in memory.
  *
  */
-static void swapWrite(otInstance *aInstance, int aFd, uint16_t aLength)
+static otError appendRecord(otInstance    *aInstance,
+                            uint8_t        aOperation,
+                            uint16_t       aKey,
+                            int            aIndex,
+                            const uint8_t *aValue,
+                            uint16_t       aValueLength)
 {
-    OT_UNUSED_VARIABLE(aInstance);
+    otError   error;
+    LogRecord record;
+
+    memset(&record, 0, sizeof(record));
+
+    writeRecord(sSettingsFd, aOperation, aKey, aIndex, aValue, aValueLength);
+    VerifyOrDie(0 == fsync(sSettingsFd), OT_EXIT_ERROR_ERRNO);
+    sLogSize += getRecordSize(aValueLength);
+
+    record.mKey       = aKey;
+    record.mLength    = aValueLength;
+    record.mOperation = aOperation;
+    record.mIndex     = aIndex;
+    error             = applyRecord(record, aValue);
 
-    const size_t kBlockSize = 512;
-    uint8_t      buffer[kBlockSize];
+    if (sLogSize - sLiveSize > kCompactionMinSize && sLogSize - sLiveSize > sLiveSize)
+    {
+        compact(aInstance);
+    }
+
+    return error;
+}
+
+/**
+ * This function loads a settings file written in the log format.
+ *
+ * @returns The size of the valid part of the log.
+ *
+ */
+static off_t loadLog(const uint8_t *aData, off_t aSize)
+{
+    off_t offset = sizeof(LogHeader);
 
-    while (aLength > 0)
+    while (offset + static_cast<off_t>(sizeof(LogRecord)) <= aSize)
     {
-        uint16_t count = aLength >= sizeof(buffer) ? sizeof(buffer) : aLength;
-        ssize_t  rval  = read(sSettingsFd, buffer, count);
+        LogRecord      record;
+        const uint8_t *value = aData + offset + sizeof(LogRecord);
+
+        memcpy(&record, aData + offset, sizeof(record));
 
-        VerifyOrDie(rval > 0, OT_EXIT_FAILURE);
-        count = static_cast<uint16_t>(rval);
-        rval  = write(aFd, buffer, count);
-        assert(rval == count);
-        VerifyOrDie(rval == count, OT_EXIT_FAILURE);
-        aLength -= count;
+        VerifyOrExit(offset + getRecordSize(record.mLength) <= aSize);
+        VerifyOrExit(record.mCrc == calculateRecordCrc(record, value));
+        VerifyOrExit(applyRecord(record, value) != OT_ERROR_PARSE);
+
+        offset += getRecordSize(record.mLength);
     }
+
+exit:
+    return offset;
 }
 
-static void swapPersist(otInstance *aInstance, int aFd)
+/**
+ * This function loads a settings file written in the format used before the log format, a sequence of key, length
+ * and value.
+ *
+ */
+static otError loadLegacy(const uint8_t *aData, off_t aSize)
 {
-    char swapFile[kMaxFileNameSize];
-    char dataFile[kMaxFileNameSize];
+    otError error  = OT_ERROR_NONE;
+    off_t   offset = 0;
 
-    getSettingsFileName(aInstance, swapFile, true);
-    getSettingsFileName(aInstance, dataFile, false);
+    while (offset < aSize)
+    {
+        uint16_t key;
+        uint16_t length;
 
-    VerifyOrDie(0 == close(sSettingsFd), OT_EXIT_ERROR_ERRNO);
-    VerifyOrDie(0 == fsync(aFd), OT_EXIT_ERROR_ERRNO);
-    VerifyOrDie(0 == rename(swapFile, dataFile), OT_EXIT_ERROR_ERRNO);
+        VerifyOrExit(offset + static_cast<off_t>(sizeof(key) + sizeof(length)) <= aSize, error = OT_ERROR_PARSE);
+        memcpy(&key, aData + offset, sizeof(key));
+        memcpy(&length, aData + offset + sizeof(key), sizeof(length));
+        offset += sizeof(key) + sizeof(length);
 
-    sSettingsFd = aFd;
+        VerifyOrExit(offset + length <= aSize, error = OT_ERROR_PARSE);
+        addValue(key, aData + offset, length);
+        offset += length;
+    }
+
+exit:
+    return error;
 }
 
-static void swapDiscard(otInstance *aInstance, int aFd)
+static void loadSettings(otInstance *aInstance)
 {
-    char swapFileName[kMaxFileNameSize];
+    off_t    size = lseek(sSettingsFd, 0, SEEK_END);
+    uint8_t *data = nullptr;
+    bool     isLog;
+
+    VerifyOrDie(size >= 0 && lseek(sSettingsFd, 0, SEEK_SET) == 0, OT_EXIT_ERROR_ERRNO);
+
+    clearValues();
+
+    if (size > 0)
+    {
+        data = static_cast<uint8_t *>(malloc(static_cast<size_t>(size)));
+        VerifyOrDie(data != nullptr, OT_EXIT_FAILURE);
+        VerifyOrDie(read(sSettingsFd, data, static_cast<size_t>(size)) == size, OT_EXIT_ERROR_ERRNO);
+    }
+
+    isLog = (size >= static_cast<off_t>(sizeof(LogHeader)));
+
+    if (isLog)
+    {
+        LogHeader header;
+
+        memcpy(&header, data, sizeof(header));
+        isLog = (header.mMagic == kLogMagic && header.mVersion == kLogVersion);
+    }
 
-    VerifyOrDie(0 == close(aFd), OT_EXIT_ERROR_ERRNO);
-    getSettingsFileName(aInstance, swapFileName, true);
-    VerifyOrDie(0 == unlink(swapFileName), OT_EXIT_ERROR_ERRNO);
+    if (isLog)
+    {
+        sLogSize = loadLog(data, size);
+
+        if (sLogSize != size)
+        {
+            otLogWarnPlat("Discarded %ld bytes of invalid settings records", static_cast<long>(size - sLogSize));
+            VerifyOrDie(ftruncate(sSettingsFd, sLogSize) == 0, OT_EXIT_ERROR_ERRNO);
+        }
+
+        VerifyOrDie(lseek(sSettingsFd, sLogSize, SEEK_SET) == sLogSize, OT_EXIT_ERROR_ERRNO);
+    }
+    else
+    {
+        // The settings file is empty or in the legacy format, it is
+        // rewritten in the log format. As for a log, the values before
+        // an invalid record are kept.
+        if (loadLegacy(data, size) != OT_ERROR_NONE)
+        {
+            otLogWarnPlat("Discarded the invalid end of the legacy settings file");
+        }
+
+        compact(aInstance);
+    }
+
+    free(data);
 }
 
 void otPlatSettingsInit(otInstance *aInstance, const uint16_t *aSensitiveKeys, uint16_t aSensitiveKeysLength)
@@ -165,8 +554,6 @@ void otPlatSettingsInit(otInstance *aInstance, const uint16_t *aSensitiveKeys, u
     OT_UNUSED_VARIABLE(aSensitiveKeysLength);
 #endif
 
-    otError error = OT_ERROR_NONE;
-
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
     sSensitiveKeys       = aSensitiveKeys;
     sSensitiveKeysLength = aSensitiveKeysLength;
@@ -193,31 +580,14 @@ void otPlatSettingsInit(otInstance *aInstance, const uint16_t *aSensitiveKeys, u
 
     VerifyOrDie(sSettingsFd != -1, OT_EXIT_ERROR_ERRNO);
 
-    for (off_t size = lseek(sSettingsFd, 0, SEEK_END), offset = lseek(sSettingsFd, 0, SEEK_SET); offset < size;)
-    {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
-
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
-
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
-
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-    }
+    loadSettings(aInstance);
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
     otPosixSecureSettingsInit(aInstance);
 #endif
 
 exit:
-    if (error == OT_ERROR_PARSE)
-    {
-        VerifyOrDie(ftruncate(sSettingsFd, 0) == 0, OT_EXIT_ERROR_ERRNO);
-    }
+    return;
 }
 
 void otPlatSettingsDeinit(otInstance *aInstance)
@@ -230,8 +600,11 @@ void otPlatSettingsDeinit(otInstance *aInstance)
     otPosixSecureSettingsDeinit(aInstance);
 #endif
 
+    clearValues();
+
     VerifyOrExit(sSettingsFd != -1);
     VerifyOrDie(close(sSettingsFd) == 0, OT_EXIT_ERROR_ERRNO);
+    sSettingsFd = -1;
 
 exit:
     return;
@@ -310,7 +683,7 @@ otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
     else
 #endif
     {
-        error = ot::Posix::PlatformSettingsDelete(aInstance, aKey, aIndex, nullptr);
+        error = ot::Posix::PlatformSettingsDelete(aInstance, aKey, aIndex);
     }
 
     return error;
@@ -323,7 +696,13 @@ void otPlatSettingsWipe(otInstance *aInstance)
     otPosixSecureSettingsWipe(aInstance);
 #endif
 
+    clearValues();
+
     VerifyOrDie(0 == ftruncate(sSettingsFd, 0), OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(0 == lseek(sSettingsFd, 0, SEEK_SET), OT_EXIT_ERROR_ERRNO);
+    writeHeader(sSettingsFd);
+    VerifyOrDie(0 == fsync(sSettingsFd), OT_EXIT_ERROR_ERRNO);
+    sLogSize = sizeof(LogHeader);
 }
 
 namespace ot {
@@ -333,52 +712,21 @@ otError PlatformSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, ui
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    otError     error  = OT_ERROR_NOT_FOUND;
-    const off_t size   = lseek(sSettingsFd, 0, SEEK_END);
-    off_t       offset = lseek(sSettingsFd, 0, SEEK_SET);
+    otError              error = OT_ERROR_NONE;
+    const SettingsKey   *entry = findKey(aKey);
+    const SettingsValue *value;
 
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
+    VerifyOrExit(entry != nullptr && aIndex >= 0 && aIndex < entry->mNumValues, error = OT_ERROR_NOT_FOUND);
+    value = entry->mValues[aIndex];
 
-    while (offset < size)
+    if (aValueLength)
     {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
-
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
-
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
-
-        if (key == aKey)
+        if (aValue)
         {
-            if (aIndex == 0)
-            {
-                error = OT_ERROR_NONE;
-
-                if (aValueLength)
-                {
-                    if (aValue)
-                    {
-                        uint16_t readLength = (length <= *aValueLength ? length : *aValueLength);
-
-                        VerifyOrExit(read(sSettingsFd, aValue, readLength) == readLength, error = OT_ERROR_PARSE);
-                    }
-
-                    *aValueLength = length;
-                }
-
-                break;
-            }
-            else
-            {
-                --aIndex;
-            }
+            memcpy(aValue, value->mData, (value->mLength <= *aValueLength ? value->mLength : *aValueLength));
         }
 
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
+        *aValueLength = value->mLength;
     }
 
 exit:
@@ -387,119 +735,25 @@ exit:
 
 void PlatformSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
-    int swapFd = -1;
-
-    switch (PlatformSettingsDelete(aInstance, aKey, -1, &swapFd))
-    {
-    case OT_ERROR_NONE:
-    case OT_ERROR_NOT_FOUND:
-        break;
-
-    default:
-        assert(false);
-        break;
-    }
-
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                    write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                    write(swapFd, aValue, aValueLength) == aValueLength,
-                OT_EXIT_FAILURE);
-
-    swapPersist(aInstance, swapFd);
+    IgnoreError(appendRecord(aInstance, kOperationSet, aKey, 0, aValue, aValueLength));
 }
 
 void PlatformSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
-    off_t size   = lseek(sSettingsFd, 0, SEEK_END);
-    int   swapFd = swapOpen(aInstance);
-
-    if (size > 0)
-    {
-        VerifyOrDie(0 == lseek(sSettingsFd, 0, SEEK_SET), OT_EXIT_ERROR_ERRNO);
-        swapWrite(aInstance, swapFd, static_cast<uint16_t>(size));
-    }
-
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                    write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                    write(swapFd, aValue, aValueLength) == aValueLength,
-                OT_EXIT_FAILURE);
-
-    swapPersist(aInstance, swapFd);
+    IgnoreError(appendRecord(aInstance, kOperationAdd, aKey, 0, aValue, aValueLength));
 }
 
-otError PlatformSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex, int *aSwapFd)
+otError PlatformSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
 {
-    otError error  = OT_ERROR_NOT_FOUND;
-    off_t   size   = lseek(sSettingsFd, 0, SEEK_END);
-    off_t   offset = lseek(sSettingsFd, 0, SEEK_SET);
-    int     swapFd = swapOpen(aInstance);
+    otError            error = OT_ERROR_NONE;
+    const SettingsKey *entry = findKey(aKey);
 
-    assert(swapFd != -1);
-    assert(offset == 0);
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
+    VerifyOrExit(entry != nullptr && entry->mNumValues > 0, error = OT_ERROR_NOT_FOUND);
+    VerifyOrExit(aIndex >= -1 && aIndex < static_cast<int>(entry->mNumValues), error = OT_ERROR_NOT_FOUND);
 
-    while (offset < size)
-    {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
-
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
-
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
-
-        offset += sizeof(key) + sizeof(length) + length;
-
-        if (aKey == key)
-        {
-            if (aIndex == 0)
-            {
-                VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-                swapWrite(aInstance, swapFd, static_cast<uint16_t>(size - offset));
-                error = OT_ERROR_NONE;
-                break;
-            }
-            else if (aIndex == -1)
-            {
-                VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-                error = OT_ERROR_NONE;
-                continue;
-            }
-            else
-            {
-                --aIndex;
-            }
-        }
-
-        rval = write(swapFd, &key, sizeof(key));
-        assert(rval == sizeof(key));
-        VerifyOrDie(rval == sizeof(key), OT_EXIT_FAILURE);
-
-        rval = write(swapFd, &length, sizeof(length));
-        assert(rval == sizeof(length));
-        VerifyOrDie(rval == sizeof(length), OT_EXIT_FAILURE);
-
-        swapWrite(aInstance, swapFd, length);
-    }
+    error = appendRecord(aInstance, kOperationDelete, aKey, aIndex, nullptr, 0);
 
 exit:
-    VerifyOrDie(error != OT_ERROR_PARSE, OT_EXIT_FAILURE);
-
-    if (aSwapFd != nullptr)
-    {
-        *aSwapFd = swapFd;
-    }
-    else if (error == OT_ERROR_NONE)
-    {
-        swapPersist(aInstance, swapFd);
-    }
-    else if (error == OT_ERROR_NOT_FOUND)
-    {
-        swapDiscard(aInstance, swapFd);
-    }
-
     return error;
 }
 
@@ -527,6 +781,8 @@ void PlatformSettingsGetSensitiveKeys(otInstance *aInstance, const uint16_t **aK
 
 void otLogCritPlat(const char *aFormat, ...) { OT_UNUSED_VARIABLE(aFormat); }
 
+void otLogWarnPlat(const char *aFormat, ...) { OT_UNUSED_VARIABLE(aFormat); }
+
 const char *otExitCodeToString(uint8_t aExitCode)
 {
     OT_UNUSED_VARIABLE(aExitCode);
@@ -678,6 +934,178 @@ int main()
         assert(otPlatSettingsGet(instance, 0, 0, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
     }
     otPlatSettingsWipe(instance);
+
+    // verify the records are restored from the settings file
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data)) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data) / 2) == OT_ERROR_NONE);
+    assert(otPlatSettingsSet(instance, 1, data, sizeof(data) / 3) == OT_ERROR_NONE);
+    assert(otPlatSettingsDelete(instance, 0, 0) == OT_ERROR_NONE);
+    otPlatSettingsDeinit(instance);
+    otPlatSettingsInit(instance, nullptr, 0);
+    {
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+
+        assert(otPlatSettingsGet(instance, 0, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 0, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 1, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 3);
+        assert(0 == memcmp(value, data, length));
+    }
+
+    // verify a torn record at the end of the settings file is discarded
+    {
+        char     fileName[kMaxFileNameSize];
+        int      fd;
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+
+        getSettingsFileName(instance, fileName, false);
+        fd = open(fileName, O_WRONLY | O_APPEND);
+        assert(fd != -1);
+        assert(write(fd, data, sizeof(LogRecord) + 2) == static_cast<ssize_t>(sizeof(LogRecord) + 2));
+        close(fd);
+
+        otPlatSettingsDeinit(instance);
+        otPlatSettingsInit(instance, nullptr, 0);
+
+        assert(otPlatSettingsGet(instance, 0, 0, nullptr, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+        assert(otPlatSettingsGet(instance, 1, 0, nullptr, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 3);
+
+        assert(otPlatSettingsAdd(instance, 2, data, sizeof(data)) == OT_ERROR_NONE);
+        otPlatSettingsDeinit(instance);
+        otPlatSettingsInit(instance, nullptr, 0);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 2, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data));
+        assert(0 == memcmp(value, data, length));
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify a settings file in the legacy format is loaded
+    {
+        char     fileName[kMaxFileNameSize];
+        int      fd;
+        uint16_t key;
+        uint16_t length;
+        uint8_t  value[sizeof(data)];
+
+        otPlatSettingsDeinit(instance);
+
+        getSettingsFileName(instance, fileName, false);
+        fd = open(fileName, O_WRONLY | O_TRUNC);
+        assert(fd != -1);
+
+        for (key = 0; key < 3; key++)
+        {
+            length = sizeof(data) / (key + 1);
+            assert(write(fd, &key, sizeof(key)) == sizeof(key));
+            assert(write(fd, &length, sizeof(length)) == sizeof(length));
+            assert(write(fd, data, length) == length);
+        }
+
+        close(fd);
+        otPlatSettingsInit(instance, nullptr, 0);
+
+        for (key = 0; key < 3; key++)
+        {
+            length = sizeof(value);
+            assert(otPlatSettingsGet(instance, key, 0, value, &length) == OT_ERROR_NONE);
+            assert(length == sizeof(data) / (key + 1));
+            assert(0 == memcmp(value, data, length));
+        }
+
+        otPlatSettingsDeinit(instance);
+        otPlatSettingsInit(instance, nullptr, 0);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 2, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 3);
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify the values before a torn record of a legacy settings file are kept
+    {
+        char     fileName[kMaxFileNameSize];
+        int      fd;
+        uint16_t key;
+        uint16_t length;
+        uint8_t  value[sizeof(data)];
+
+        otPlatSettingsDeinit(instance);
+
+        getSettingsFileName(instance, fileName, false);
+        fd = open(fileName, O_WRONLY | O_TRUNC);
+        assert(fd != -1);
+
+        for (key = 0; key < 3; key++)
+        {
+            length = sizeof(data) / (key + 1);
+            assert(write(fd, &key, sizeof(key)) == sizeof(key));
+            assert(write(fd, &length, sizeof(length)) == sizeof(length));
+            // the value of the last record is cut short
+            assert(write(fd, data, length / (key == 2 ? 2 : 1)) == length / (key == 2 ? 2 : 1));
+        }
+
+        close(fd);
+        otPlatSettingsInit(instance, nullptr, 0);
+
+        for (key = 0; key < 2; key++)
+        {
+            length = sizeof(value);
+            assert(otPlatSettingsGet(instance, key, 0, value, &length) == OT_ERROR_NONE);
+            assert(length == sizeof(data) / (key + 1));
+            assert(0 == memcmp(value, data, length));
+        }
+
+        assert(otPlatSettingsGet(instance, 2, 0, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+
+        otPlatSettingsDeinit(instance);
+        otPlatSettingsInit(instance, nullptr, 0);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 1, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+        assert(otPlatSettingsGet(instance, 2, 0, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify the settings file is compacted
+    {
+        char        fileName[kMaxFileNameSize];
+        struct stat st;
+        uint8_t     value[sizeof(data)];
+        uint16_t    length = sizeof(value);
+
+        assert(otPlatSettingsAdd(instance, 0, data, sizeof(data)) == OT_ERROR_NONE);
+
+        for (uint16_t i = 0; i < 1000; i++)
+        {
+            data[0] = static_cast<uint8_t>(i);
+            assert(otPlatSettingsSet(instance, 1, data, sizeof(data)) == OT_ERROR_NONE);
+        }
+
+        getSettingsFileName(instance, fileName, false);
+        assert(stat(fileName, &st) == 0);
+        assert(st.st_size <= 2 * kCompactionMinSize);
+
+        otPlatSettingsDeinit(instance);
+        otPlatSettingsInit(instance, nullptr, 0);
+
+        assert(otPlatSettingsGet(instance, 1, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data));
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 1, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+        assert(otPlatSettingsGet(instance, 0, 0, nullptr, nullptr) == OT_ERROR_NONE);
+    }
+    otPlatSettingsWipe(instance);
     otPlatSettingsDeinit(instance);
 
     return 0;
@@ -70,22 +70,17 @@ void PlatformSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aV
 void PlatformSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength);
 
 /**
- * This function removes a setting either from swap file or persisted file.
+ * This function removes a setting from the persisted file.
  *
  * @param[in]  aInstance  The OpenThread instance structure.
  * @param[in]  aKey       The key associated with the requested setting.
  * @param[in]  aIndex     The index of the value to be removed. If set to -1, all values for this aKey will be removed.
- * @param[out] aSwapFd    A optional pointer to receive file descriptor of the generated swap file descriptor.
- *
- * @note
- *   If @p aSwapFd is null, operate deleting on the setting file.
- *   If @p aSwapFd is not null, operate on the swap file, and aSwapFd will point to the swap file descriptor.
  *
  * @retval OT_ERROR_NONE        The given key and index was found and removed successfully.
  * @retval OT_ERROR_NOT_FOUND   The given key or index was not found in the setting store.
  *
  */
-otError PlatformSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex, int *aSwapFd);
+otError PlatformSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex);
 
 /**
  * This function gets the sensitive keys that should be stored in the secure area.
@@ -0,0 +1,370 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <chrono>
+
+#include "common/instance.hpp"
+#include "common/random.hpp"
+#include "net/ip6_address.hpp"
+#include "thread/address_resolver.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+class UnitTester
+{
+public:
+    static constexpr uint16_t kCacheEntries = AddressResolver::kCacheEntries;
+
+    static void TestAddressCache(void)
+    {
+        Instance        *instance;
+        AddressResolver *resolver;
+        Ip6::Address     eid;
+        uint16_t         numEntries;
+
+        printf("\nTestAddressCache\n");
+
+        instance = static_cast<Instance *>(testInitInstance());
+        VerifyOrQuit(instance != nullptr);
+        resolver = &instance->Get<AddressResolver>();
+
+        // Fill the cache, the most recently added entry is the head of
+        // the cached list.
+
+        for (uint16_t i = 0; i < kCacheEntries; i++)
+        {
+            AddCachedEntry(*resolver, i);
+            VerifyOrQuit(GetHeadTarget(*resolver) == GetEid(i));
+        }
+
+        VerifyOrQuit(GetNumEntries(*resolver) == kCacheEntries);
+        VerifyCacheEntryIndex(*resolver);
+
+        // Look up all the entries, from the oldest one. Each entry is
+        // moved to the head of the cached list.
+
+        for (uint16_t i = 0; i < kCacheEntries; i++)
+        {
+            VerifyOrQuit(resolver->LookUp(GetEid(i)) == GetRloc16(i));
+            VerifyOrQuit(GetHeadTarget(*resolver) == GetEid(i));
+        }
+
+        VerifyCacheEntryIndex(*resolver);
+
+        // Look up unknown EIDs, they must not be added to the cache.
+
+        for (uint16_t i = kCacheEntries; i < 2 * kCacheEntries; i++)
+        {
+            VerifyOrQuit(resolver->LookUp(GetEid(i)) == Mac::kShortAddrInvalid);
+        }
+
+        VerifyOrQuit(GetNumEntries(*resolver) == kCacheEntries);
+
+        // Use entry 0 again, then add a new entry. The least recently
+        // used entry (entry 1) is evicted.
+
+        VerifyOrQuit(resolver->LookUp(GetEid(0)) == GetRloc16(0));
+        AddCachedEntry(*resolver, kCacheEntries);
+
+        VerifyOrQuit(GetNumEntries(*resolver) == kCacheEntries);
+        VerifyCacheEntryIndex(*resolver);
+        VerifyOrQuit(resolver->LookUp(GetEid(1)) == Mac::kShortAddrInvalid);
+        VerifyOrQuit(resolver->LookUp(GetEid(0)) == GetRloc16(0));
+        VerifyOrQuit(resolver->LookUp(GetEid(kCacheEntries)) == GetRloc16(kCacheEntries));
+
+        for (uint16_t i = 2; i < kCacheEntries; i++)
+        {
+            VerifyOrQuit(resolver->LookUp(GetEid(i)) == GetRloc16(i));
+        }
+
+        // Remove the even entries by EID, looking up the remaining ones
+        // in between.
+
+        numEntries = kCacheEntries;
+
+        for (uint16_t i = 2; i <= kCacheEntries; i += 2)
+        {
+            resolver->Remove(GetEid(i));
+            numEntries--;
+
+            VerifyOrQuit(resolver->LookUp(GetEid(i)) == Mac::kShortAddrInvalid);
+            VerifyOrQuit(GetNumEntries(*resolver) == numEntries);
+            VerifyCacheEntryIndex(*resolver);
+
+            eid = GetEid(Random::NonCrypto::GetUint16InRange(3, kCacheEntries) | 1);
+            VerifyOrQuit(resolver->LookUp(eid) != Mac::kShortAddrInvalid);
+        }
+
+        for (uint16_t i = 0; i <= kCacheEntries; i++)
+        {
+            bool removed = (i == 1) || (((i % 2) == 0) && (i != 0));
+
+            VerifyOrQuit((resolver->LookUp(GetEid(i)) == Mac::kShortAddrInvalid) == removed);
+        }
+
+        // Remove the entries of one router, then clear the cache.
+
+        resolver->Remove(Mle::RouterIdFromRloc16(GetRloc16(3)));
+        VerifyCacheEntryIndex(*resolver);
+
+        for (uint16_t i = 0; i <= kCacheEntries; i++)
+        {
+            if (Mle::RouterIdMatch(GetRloc16(i), GetRloc16(3)))
+            {
+                VerifyOrQuit(resolver->LookUp(GetEid(i)) == Mac::kShortAddrInvalid);
+            }
+        }
+
+        resolver->Clear();
+        VerifyOrQuit(GetNumEntries(*resolver) == 0);
+        VerifyCacheEntryIndex(*resolver);
+
+        for (uint16_t i = 0; i <= kCacheEntries; i++)
+        {
+            VerifyOrQuit(resolver->LookUp(GetEid(i)) == Mac::kShortAddrInvalid);
+        }
+
+        // Add back all the entries after the cache was cleared.
+
+        for (uint16_t i = 0; i < kCacheEntries; i++)
+        {
+            AddCachedEntry(*resolver, i);
+        }
+
+        for (uint16_t i = 0; i < kCacheEntries; i++)
+        {
+            VerifyOrQuit(resolver->LookUp(GetEid(i)) == GetRloc16(i));
+        }
+
+        VerifyCacheEntryIndex(*resolver);
+
+        // Remove all the entries in a random order, so that entries
+        // are removed from the middle of the probe sequences of the
+        // index (when enabled) and from anywhere in the cached list.
+
+        numEntries = kCacheEntries;
+
+        while (numEntries > 0)
+        {
+            uint16_t i = Random::NonCrypto::GetUint16InRange(0, kCacheEntries);
+
+            if (resolver->LookUp(GetEid(i)) == Mac::kShortAddrInvalid)
+            {
+                continue;
+            }
+
+            resolver->Remove(GetEid(i));
+            numEntries--;
+
+            VerifyOrQuit(resolver->LookUp(GetEid(i)) == Mac::kShortAddrInvalid);
+            VerifyOrQuit(GetNumEntries(*resolver) == numEntries);
+            VerifyCacheEntryIndex(*resolver);
+        }
+
+        testFreeInstance(instance);
+
+        printf("PASS\n");
+    }
+
+    static void BenchmarkLookUp(void)
+    {
+        constexpr uint32_t kIterations = 100000;
+
+        Instance        *instance;
+        AddressResolver *resolver;
+
+        printf("\nBenchmarkLookUp (%s)\n",
+               OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE ? "hash index" : "linked lists");
+
+        instance = static_cast<Instance *>(testInitInstance());
+        VerifyOrQuit(instance != nullptr);
+        resolver = &instance->Get<AddressResolver>();
+
+        for (uint16_t numEntries = 1;; numEntries = Min(static_cast<uint16_t>(numEntries * 2), kCacheEntries))
+        {
+            double   hitTime;
+            double   missTime;
+            uint16_t rloc16 = 0;
+
+            resolver->Clear();
+
+            for (uint16_t i = 0; i < numEntries; i++)
+            {
+                AddCachedEntry(*resolver, i);
+            }
+
+            hitTime = MeasureLookUp(*resolver, 0, numEntries, kIterations, rloc16);
+            VerifyOrQuit(rloc16 != Mac::kShortAddrInvalid);
+
+            missTime = MeasureLookUp(*resolver, kCacheEntries, kCacheEntries, kIterations, rloc16);
+            VerifyOrQuit(rloc16 == Mac::kShortAddrInvalid);
+
+            printf("%5u entries: hit %.1f ns, miss %.1f ns\n", numEntries, hitTime, missTime);
+
+            if (numEntries == kCacheEntries)
+            {
+                break;
+            }
+        }
+
+        testFreeInstance(instance);
+    }
+
+private:
+    static Ip6::Address GetEid(uint16_t aIndex)
+    {
+        Ip6::Address eid;
+
+        SuccessOrQuit(eid.FromString("fd00:db8::"));
+        Encoding::BigEndian::WriteUint16(0x1000 + aIndex, &eid.mFields.m8[12]);
+        Encoding::BigEndian::WriteUint16(aIndex * 7, &eid.mFields.m8[14]);
+
+        return eid;
+    }
+
+    static Mac::ShortAddress GetRloc16(uint16_t aIndex)
+    {
+        return static_cast<Mac::ShortAddress>(
+            Mle::Rloc16FromRouterId(static_cast<uint8_t>(aIndex % (Mle::kMaxRouterId + 1))) + 1);
+    }
+
+    static void AddCachedEntry(AddressResolver &aResolver, uint16_t aIndex)
+    {
+        AddressResolver::CacheEntry *entry = aResolver.NewCacheEntry(/* aSnoopedEntry */ false);
+
+        VerifyOrQuit(entry != nullptr);
+
+        entry->SetTarget(GetEid(aIndex));
+        entry->SetRloc16(GetRloc16(aIndex));
+        entry->MarkLastTransactionTimeAsInvalid();
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+        aResolver.mCacheEntryIndex.Add(*entry);
+#endif
+        aResolver.mCachedList.Push(*entry);
+    }
+
+    static void VerifyCacheEntryIndex(AddressResolver &aResolver)
+    {
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+        // Every cached entry must be found through the index, and its
+        // `mPrevIndex` must point to the entry before it in the list.
+
+        AddressResolver::CacheEntry *prev       = nullptr;
+        uint16_t                     numEntries = 0;
+        uint16_t                     numSlots   = 0;
+
+        for (AddressResolver::CacheEntry &entry : aResolver.mCachedList)
+        {
+            VerifyOrQuit(aResolver.mCacheEntryIndex.Find(entry.GetTarget()) == &entry);
+            VerifyOrQuit(entry.GetList() == &aResolver.mCachedList);
+            VerifyOrQuit(aResolver.mCachedList.GetPrevOf(entry) == prev);
+            prev = &entry;
+            numEntries++;
+        }
+
+        for (uint16_t slot : aResolver.mCacheEntryIndex.mSlots)
+        {
+            if (slot != AddressResolver::CacheEntryIndex::kEmptySlot)
+            {
+                numSlots++;
+            }
+        }
+
+        VerifyOrQuit(numSlots == numEntries);
+#else
+        OT_UNUSED_VARIABLE(aResolver);
+#endif
+    }
+
+    static const Ip6::Address &GetHeadTarget(AddressResolver &aResolver)
+    {
+        VerifyOrQuit(!aResolver.mCachedList.IsEmpty());
+        return aResolver.mCachedList.GetHead()->GetTarget();
+    }
+
+    static uint16_t GetNumEntries(AddressResolver &aResolver)
+    {
+        AddressResolver::Iterator  iterator;
+        AddressResolver::EntryInfo info;
+        uint16_t                   numEntries = 0;
+
+        iterator.Clear();
+
+        while (aResolver.GetNextCacheEntry(info, iterator) == kErrorNone)
+        {
+            numEntries++;
+        }
+
+        return numEntries;
+    }
+
+    static double MeasureLookUp(AddressResolver   &aResolver,
+                                uint16_t           aFirstIndex,
+                                uint16_t           aNumEntries,
+                                uint32_t           aIterations,
+                                Mac::ShortAddress &aRloc16)
+    {
+        constexpr uint16_t kNumEids = 64;
+
+        Ip6::Address                          eids[kNumEids];
+        std::chrono::steady_clock::time_point start;
+
+        // Look up the EIDs in a random order, so that hits are spread
+        // over the whole cached list.
+
+        for (Ip6::Address &eid : eids)
+        {
+            eid = GetEid(aFirstIndex + Random::NonCrypto::GetUint16InRange(0, aNumEntries));
+        }
+
+        start = std::chrono::steady_clock::now();
+
+        for (uint32_t i = 0; i < aIterations; i++)
+        {
+            aRloc16 = aResolver.LookUp(eids[i % kNumEids]);
+        }
+
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() /
+               aIterations;
+    }
+};
+
+} // namespace ot
+
+int main(void)
+{
+    ot::UnitTester::TestAddressCache();
+    ot::UnitTester::BenchmarkLookUp();
+
+    printf("\nAll tests passed\n");
+    return 0;
+}
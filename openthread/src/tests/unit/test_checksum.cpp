@@ -26,6 +26,8 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
+
 #include "common/encoding.hpp"
 #include "common/instance.hpp"
 #include "common/message.hpp"
@@ -464,6 +466,111 @@ public:
         VerifyOrQuit(checksum.GetValue() == kTestVectorChecksum);
         VerifyOrQuit(checksum.GetValue() == CalculateChecksum(kTestVector, sizeof(kTestVector)), );
     }
+
+    static uint16_t AddBytes(Checksum &aChecksum, const uint8_t *aBuffer, uint16_t aLength)
+    {
+        // Reference implementation adding one byte at a time.
+        for (uint16_t i = 0; i < aLength; i++)
+        {
+            aChecksum.AddUint8(aBuffer[i]);
+        }
+
+        return aChecksum.GetValue();
+    }
+
+    static void TestAddData(void)
+    {
+        constexpr uint16_t kMaxLength = 300;
+
+        uint8_t   buffer[kMaxLength + sizeof(uint64_t)];
+        Instance *instance = static_cast<Instance *>(testInitInstance());
+
+        VerifyOrQuit(instance != nullptr);
+
+        for (uint16_t length = 0; length <= kMaxLength; length++)
+        {
+            for (uint8_t alignment = 0; alignment < sizeof(uint64_t); alignment++)
+            {
+                const uint8_t *data = &buffer[alignment];
+                uint16_t       split;
+                Checksum       checksum;
+                Checksum       splitChecksum;
+                Checksum       reference;
+
+                Random::NonCrypto::FillBuffer(buffer, sizeof(buffer));
+
+                // The content is split at a random (possibly odd) index.
+                split = Random::NonCrypto::GetUint16InRange(0, length + 1);
+
+                checksum.AddData(data, length);
+                splitChecksum.AddData(data, split);
+                splitChecksum.AddData(data + split, length - split);
+
+                VerifyOrQuit(checksum.GetValue() == AddBytes(reference, data, length));
+                VerifyOrQuit(splitChecksum.GetValue() == checksum.GetValue());
+                VerifyOrQuit(splitChecksum.mAtOddIndex == reference.mAtOddIndex);
+                VerifyOrQuit(checksum.GetValue() == CalculateChecksum(data, length) || length == 0);
+            }
+        }
+
+        // All-zero and all-one data keep their distinct one's complement representations.
+        {
+            Checksum checksum;
+
+            memset(buffer, 0, sizeof(buffer));
+            checksum.AddData(buffer, sizeof(buffer));
+            VerifyOrQuit(checksum.GetValue() == 0);
+
+            memset(buffer, 0xff, sizeof(buffer));
+            checksum.AddData(buffer, sizeof(buffer));
+            VerifyOrQuit(checksum.GetValue() == 0xffff);
+        }
+
+        testFreeInstance(instance);
+    }
+
+    static void BenchmarkAddData(void)
+    {
+        constexpr uint16_t kLength     = OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH;
+        constexpr uint32_t kIterations = 20000;
+
+        uint8_t  buffer[kLength];
+        uint16_t value = 0;
+
+        for (uint16_t i = 0; i < kLength; i++)
+        {
+            buffer[i] = static_cast<uint8_t>(i * 7 + 3);
+        }
+
+        for (uint8_t pass = 0; pass < 2; pass++)
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            double                                elapsed;
+
+            for (uint32_t i = 0; i < kIterations; i++)
+            {
+                Checksum checksum;
+
+                if (pass == 0)
+                {
+                    AddBytes(checksum, buffer, kLength);
+                }
+                else
+                {
+                    checksum.AddData(buffer, kLength);
+                }
+
+                value ^= checksum.GetValue();
+                buffer[i % kLength] ^= static_cast<uint8_t>(value);
+            }
+
+            elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+            printf("Checksum of %u bytes %s: %.1f ns (%.1f MB/s)\n", kLength,
+                   (pass == 0) ? "one byte at a time" : "with AddData()", elapsed / kIterations,
+                   static_cast<double>(kLength) * kIterations * 1000 / elapsed);
+        }
+    }
 };
 
 } // namespace ot
@@ -471,6 +578,8 @@ public:
 int main(void)
 {
     ot::ChecksumTester::TestExampleVector();
+    ot::ChecksumTester::TestAddData();
+    ot::ChecksumTester::BenchmarkAddData();
     ot::TestUdpMessageChecksum();
     ot::TestIcmp6MessageChecksum();
     ot::TestTcp4MessageChecksum();
@@ -641,6 +641,79 @@ void TestFuzzEncoderDecoder(void)
     printf(" -- PASS\n");
 }
 
+void TestBulkEncoderDecoder(void)
+{
+    uint16_t                       length;
+    uint8_t                        frame[kMaxFrameLength];
+    Hdlc::FrameBuffer<kBufferSize> encoderBuffer;
+    Hdlc::FrameBuffer<kBufferSize> byteEncoderBuffer;
+    Hdlc::FrameBuffer<kBufferSize> decoderBuffer;
+    DecoderContext                 decoderContext;
+    Hdlc::Encoder                  encoder(encoderBuffer);
+    Hdlc::Encoder                  byteEncoder(byteEncoderBuffer);
+    Hdlc::Decoder                  decoder(decoderBuffer, ProcessDecodedFrame, &decoderContext);
+
+    printf("Testing Hdlc::Encoder and Hdlc::Decoder block processing against single bytes");
+
+    for (uint32_t iter = 0; iter < kFuzzTestIteration; iter++)
+    {
+        const uint8_t *encoded;
+        uint16_t       encodedLength;
+
+        encoderBuffer.Clear();
+        byteEncoderBuffer.Clear();
+        decoderBuffer.Clear();
+
+        length = static_cast<uint16_t>(GetRandom(kMaxFrameLength)) + 1;
+
+        // Use special bytes often to exercise the boundaries of the blocks.
+        for (uint16_t i = 0; i < length; i++)
+        {
+            frame[i] = (GetRandom(8) == 0) ? sHdlcSpecials[GetRandom(sizeof(sHdlcSpecials))]
+                                           : static_cast<uint8_t>(GetRandom(256));
+        }
+
+        SuccessOrQuit(encoder.BeginFrame());
+        SuccessOrQuit(encoder.Encode(frame, length));
+        SuccessOrQuit(encoder.EndFrame());
+
+        SuccessOrQuit(byteEncoder.BeginFrame());
+
+        for (uint16_t i = 0; i < length; i++)
+        {
+            SuccessOrQuit(byteEncoder.Encode(frame[i]));
+        }
+
+        SuccessOrQuit(byteEncoder.EndFrame());
+
+        VerifyOrQuit(encoderBuffer.GetLength() == byteEncoderBuffer.GetLength());
+        VerifyOrQuit(memcmp(encoderBuffer.GetFrame(), byteEncoderBuffer.GetFrame(), encoderBuffer.GetLength()) == 0,
+                     "Encoded frame does not match frame encoded one byte at a time");
+
+        // Feed the decoder with randomly sized pieces of the encoded frame.
+        decoderContext.mWasCalled = false;
+        encoded                   = encoderBuffer.GetFrame();
+        encodedLength             = encoderBuffer.GetLength();
+
+        while (encodedLength > 0)
+        {
+            uint16_t pieceLength = static_cast<uint16_t>(GetRandom(encodedLength)) + 1;
+
+            decoder.Decode(encoded, pieceLength);
+            encoded += pieceLength;
+            encodedLength -= pieceLength;
+        }
+
+        VerifyOrQuit(decoderContext.mWasCalled);
+        VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE, "Decoder::Decode() returned incorrect error code");
+        VerifyOrQuit(decoderBuffer.GetLength() == length, "Decoded frame length does not match original frame");
+        VerifyOrQuit(memcmp(decoderBuffer.GetFrame(), frame, length) == 0,
+                     "Decoded frame content does not match original frame");
+    }
+
+    printf(" -- PASS\n");
+}
+
 } // namespace Ncp
 } // namespace ot
 
@@ -650,6 +723,7 @@ int main(void)
     ot::Ncp::TestHdlcMultiFrameBuffer();
     ot::Ncp::TestEncoderDecoder();
     ot::Ncp::TestFuzzEncoderDecoder();
+    ot::Ncp::TestBulkEncoderDecoder();
     printf("\nAll tests passed.\n");
     return 0;
 }
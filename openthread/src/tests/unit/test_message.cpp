@@ -309,6 +309,73 @@ void TestMessage(void)
     testFreeInstance(instance);
 }
 
+void TestMessageChunks(void)
+{
+    static constexpr uint16_t kMaxSize    = kBufferSize * 5 + 17;
+    static constexpr uint16_t kReserved   = 40;
+    static constexpr uint16_t kMaxChunks  = 8;
+    static constexpr uint16_t kOffsetStep = 13;
+    static constexpr uint16_t kLengthStep = 47;
+
+    Instance      *instance;
+    MessagePool   *messagePool;
+    Message       *message;
+    otMessageChunk chunks[kMaxChunks];
+    uint8_t        writeBuffer[kMaxSize];
+    uint8_t        readBuffer[kMaxSize];
+
+    printf("TestMessageChunks\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    messagePool = &instance->Get<MessagePool>();
+
+    Random::NonCrypto::FillBuffer(writeBuffer, kMaxSize);
+
+    for (uint16_t length = 1; length <= kMaxSize; length += kLengthStep)
+    {
+        VerifyOrQuit((message = messagePool->Allocate(Message::kTypeIp6, kReserved)) != nullptr);
+        SuccessOrQuit(message->SetLength(length));
+
+        for (uint16_t offset = 0; offset <= length; offset += kOffsetStep)
+        {
+            uint16_t numChunks = kMaxChunks;
+            uint16_t numBytes;
+            uint16_t position = offset;
+
+            // Write the message through the chunks, then read it back.
+
+            numBytes = message->GetChunks(offset, chunks, numChunks);
+            VerifyOrQuit(numBytes == length - offset);
+            VerifyOrQuit(numChunks <= message->GetBufferCount());
+
+            for (uint16_t i = 0; i < numChunks; i++)
+            {
+                VerifyOrQuit(chunks[i].mLength > 0);
+                memcpy(chunks[i].mData, &writeBuffer[position], chunks[i].mLength);
+                position += chunks[i].mLength;
+            }
+
+            VerifyOrQuit(position == length);
+            SuccessOrQuit(message->Read(offset, readBuffer, length - offset));
+            VerifyOrQuit(memcmp(readBuffer, &writeBuffer[offset], length - offset) == 0);
+
+            // Only as many chunks as the array can hold are output.
+
+            numChunks = 1;
+            numBytes  = message->GetChunks(offset, chunks, numChunks);
+            VerifyOrQuit(numChunks == ((offset < length) ? 1 : 0));
+            VerifyOrQuit(numBytes == ((numChunks == 1) ? chunks[0].mLength : 0));
+            VerifyOrQuit(numBytes <= length - offset);
+        }
+
+        message->Free();
+    }
+
+    testFreeInstance(instance);
+}
+
 void TestAppender(void)
 {
     const uint8_t kData1[] = {0x01, 0x02, 0x03, 0x04};
@@ -398,11 +465,92 @@ void TestAppender(void)
     testFreeInstance(instance);
 }
 
+void TestMessagePoolCounters(void)
+{
+    static constexpr uint16_t kMaxMessages = 4096;
+
+    Instance         *instance;
+    MessagePool      *messagePool;
+    Message          *messages[kMaxMessages];
+    Message          *netMessage;
+    uint16_t          numMessages = 0;
+    uint16_t          initialUsed;
+    Message::Settings lowSettings(Message::kPriorityLow);
+    Message::Settings netSettings(Message::kPriorityNet);
+
+    printf("TestMessagePoolCounters\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    messagePool = &instance->Get<MessagePool>();
+
+    messagePool->ResetCounters();
+    initialUsed = messagePool->GetTotalBufferCount() - messagePool->GetFreeBufferCount();
+    VerifyOrQuit(messagePool->GetMaxUsedBufferCount() == initialUsed);
+
+    for (uint8_t priority = 0; priority < Message::kNumPriorities; priority++)
+    {
+        VerifyOrQuit(messagePool->GetAllocFailureCount(static_cast<Message::Priority>(priority)) == 0);
+    }
+
+    // Allocate low priority messages until the pool is exhausted.
+
+    while (numMessages < kMaxMessages)
+    {
+        Message *message = messagePool->Allocate(Message::kTypeIp6, 0, lowSettings);
+
+        if (message == nullptr)
+        {
+            break;
+        }
+
+        messages[numMessages++] = message;
+    }
+
+    VerifyOrQuit(numMessages > 0 && numMessages < kMaxMessages);
+    VerifyOrQuit(messagePool->GetMaxUsedBufferCount() == initialUsed + numMessages);
+    VerifyOrQuit(messagePool->GetAllocFailureCount(Message::kPriorityLow) == 1);
+    VerifyOrQuit(messagePool->GetAllocFailureCount(Message::kPriorityNormal) == 0);
+
+    netMessage = messagePool->Allocate(Message::kTypeIp6, 0, netSettings);
+
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_ELASTIC_ENABLE
+    // The buffers reserved for the higher priorities are still available.
+    VerifyOrQuit(netMessage != nullptr);
+    VerifyOrQuit(messagePool->GetAllocFailureCount(Message::kPriorityNet) == 0);
+    VerifyOrQuit(messagePool->GetMaxUsedBufferCount() == initialUsed + numMessages + 1);
+    netMessage->Free();
+#else
+    VerifyOrQuit(netMessage == nullptr);
+    VerifyOrQuit(messagePool->GetAllocFailureCount(Message::kPriorityNet) == 1);
+#endif
+
+    for (uint16_t i = 0; i < numMessages; i++)
+    {
+        messages[i]->Free();
+    }
+
+    // The maximum is kept until the counters are reset.
+
+    VerifyOrQuit(messagePool->GetTotalBufferCount() - messagePool->GetFreeBufferCount() == initialUsed);
+    VerifyOrQuit(messagePool->GetMaxUsedBufferCount() >= initialUsed + numMessages);
+
+    messagePool->ResetCounters();
+    VerifyOrQuit(messagePool->GetMaxUsedBufferCount() == initialUsed);
+    VerifyOrQuit(messagePool->GetAllocFailureCount(Message::kPriorityLow) == 0);
+    VerifyOrQuit(messagePool->GetAllocFailureCount(Message::kPriorityNet) == 0);
+
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestMessage();
+    ot::TestMessageChunks();
+    ot::TestMessagePoolCounters();
     ot::TestAppender();
     printf("All tests passed\n");
     return 0;
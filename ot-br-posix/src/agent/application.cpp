@@ -51,8 +51,7 @@ Application::Application(const std::string               &aInterfaceName,
                          const std::vector<const char *> &aBackboneInterfaceNames,
                          const std::vector<const char *> &aRadioUrls,
                          bool                             aEnableAutoAttach,
-                         const std::string               &aRestListenAddress,
-                         otMessageQueue                  *aMudQueue)
+                         const std::string               &aRestListenAddress)
     : mInterfaceName(aInterfaceName)
 #if __linux__
     , mInfraLinkSelector(aBackboneInterfaceNames)
@@ -60,10 +59,14 @@ Application::Application(const std::string               &aInterfaceName,
 #else
     , mBackboneInterfaceName(aBackboneInterfaceNames.empty() ? "" : aBackboneInterfaceNames.front())
 #endif
-// #if OTBR_ENABLE_MUD_MANAGER
-//     , mMudManager()
-// #endif
-    , mNcp(mInterfaceName.c_str(), aRadioUrls, mBackboneInterfaceName, /* aDryRun */ false, aEnableAutoAttach, aMudQueue)
+    , mNcp(mInterfaceName.c_str(),
+           aRadioUrls,
+           mBackboneInterfaceName,
+           /* aDryRun */ false,
+           aEnableAutoAttach)
+#if OTBR_ENABLE_REST_SERVER || OTBR_ENABLE_DBUS_SERVER
+    , mDiagCollector(mNcp)
+#endif
 #if OTBR_ENABLE_BORDER_AGENT
     , mBorderAgent(mNcp)
 #endif
@@ -84,12 +87,29 @@ Application::Application(const std::string               &aInterfaceName,
 #endif
 {
     OTBR_UNUSED_VARIABLE(aRestListenAddress);
+
+#if OTBR_ENABLE_REST_SERVER
+    mRestWebServer.SetDiagCollector(mDiagCollector);
+#endif
+#if OTBR_ENABLE_DBUS_SERVER
+    mDBusAgent.SetDiagCollector(mDiagCollector);
+#endif
+
+#if OTBR_ENABLE_MUD_MANAGER && OTBR_ENABLE_REST_SERVER
+    mRestWebServer.SetMudManager(mMudManager);
+#endif
+#if OTBR_ENABLE_MUD_MANAGER && OTBR_ENABLE_DBUS_SERVER
+    mDBusAgent.SetMudManager(mMudManager);
+#endif
 }
 
 void Application::Init(void)
 {
     mNcp.Init();
 
+#if OTBR_ENABLE_REST_SERVER || OTBR_ENABLE_DBUS_SERVER
+    mDiagCollector.Init();
+#endif
 #if OTBR_ENABLE_BORDER_AGENT
     mBorderAgent.Init();
 #endif
@@ -109,7 +129,7 @@ void Application::Init(void)
     mVendorServer.Init();
 #endif
 #if OTBR_ENABLE_MUD_MANAGER
-    mMudManager.Init();
+    mMudManager.Init(mNcp);
 #endif
 }
 
@@ -171,8 +191,7 @@ otbrError Application::Run(void)
 
         MainloopManager::GetInstance().Update(mainloop);
 
-        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
-                      &mainloop.mTimeout);
+        rval = MainloopManager::GetInstance().Poll(mainloop);
 
         if (rval >= 0)
         {
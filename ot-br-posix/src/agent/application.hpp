@@ -61,6 +61,9 @@
 #if OTBR_ENABLE_VENDOR_SERVER
 #include "agent/vendor.hpp"
 #endif
+#if OTBR_ENABLE_REST_SERVER || OTBR_ENABLE_DBUS_SERVER
+#include "utils/diag_collector.hpp"
+#endif
 #include "utils/infra_link_selector.hpp"
 
 namespace otbr {
@@ -94,8 +97,7 @@ public:
                          const std::vector<const char *> &aBackboneInterfaceNames,
                          const std::vector<const char *> &aRadioUrls,
                          bool                             aEnableAutoAttach,
-                         const std::string               &aRestListenAddress,
-                         otMessageQueue                  *aMudQueue);
+                         const std::string               &aRestListenAddress);
 
     /**
      * This method initializes the Application instance.
@@ -133,6 +135,9 @@ private:
     MUD::MudManager mMudManager;
 #endif
     Ncp::ControllerOpenThread mNcp;
+#if OTBR_ENABLE_REST_SERVER || OTBR_ENABLE_DBUS_SERVER
+    agent::DiagCollector mDiagCollector;
+#endif
 #if OTBR_ENABLE_BORDER_AGENT
     BorderAgent mBorderAgent;
 #endif
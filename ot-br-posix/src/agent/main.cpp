@@ -56,7 +56,6 @@
 #include "common/logging.hpp"
 #include "common/mainloop.hpp"
 #include "common/types.hpp"
-#include "mud_manager/mud_manager.hpp"
 #include "ncp/ncp_openthread.hpp"
 
 static const char kSyslogIdent[]          = "otbr-agent";
@@ -169,7 +168,7 @@ static otbrLogLevel GetDefaultLogLevel(void)
 static void PrintRadioVersionAndExit(const std::vector<const char *> &aRadioUrls)
 {
     otbr::Ncp::ControllerOpenThread ncpOpenThread{/* aInterfaceName */ "", aRadioUrls, /* aBackboneInterfaceName */ "",
-                                                  /* aDryRun */ true, /* aEnableAutoAttach */ false, nullptr};
+                                                  /* aDryRun */ true, /* aEnableAutoAttach */ false};
     const char                     *radioVersion;
 
     ncpOpenThread.Init();
@@ -281,8 +280,7 @@ static int realmain(int argc, char *argv[])
     }
 
     {
-        otbr::MUD::MudManager m = otbr::MUD::MudManager();
-        otbr::Application app(interfaceName, backboneInterfaceNames, radioUrls, enableAutoAttach, restListenAddress, m.GetMessageQueue());
+        otbr::Application app(interfaceName, backboneInterfaceNames, radioUrls, enableAutoAttach, restListenAddress);
 
         gApp = &app;
         app.Init();
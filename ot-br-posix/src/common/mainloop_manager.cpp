@@ -25,12 +25,52 @@
  *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
  *    POSSIBILITY OF SUCH DAMAGE.
  */
+
+#define OTBR_LOG_TAG "MAINLOOP"
+
+#include <algorithm>
+
 #include <assert.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/select.h>
 
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
+
+#include "common/logging.hpp"
 #include "common/mainloop_manager.hpp"
 
 namespace otbr {
 
+#ifdef __linux__
+// The maximum number of events returned by one `epoll_wait()`, any
+// other pending event is returned at the next iteration.
+static constexpr int kMaxEpollEvents = 64;
+#endif
+
+MainloopManager::MainloopManager(void)
+    : mNextGeneration(0)
+{
+#ifdef __linux__
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrDie(mEpollFd != -1, strerror(errno));
+#endif
+}
+
+MainloopManager::~MainloopManager(void)
+{
+#ifdef __linux__
+    if (mEpollFd != -1)
+    {
+        close(mEpollFd);
+        mEpollFd = -1;
+    }
+#endif
+}
+
 void MainloopManager::AddMainloopProcessor(MainloopProcessor *aMainloopProcessor)
 {
     assert(aMainloopProcessor != nullptr);
@@ -56,5 +96,250 @@ void MainloopManager::Process(const MainloopContext &aMainloop)
     {
         mainloopProcessor->Process(aMainloop);
     }
+
+    ProcessFdEvents();
+    mTimerWheel.Process(Clock::now());
+    mRemovedFdWatchers.clear();
+}
+
+int MainloopManager::Poll(MainloopContext &aMainloop)
+{
+    int          rval;
+    Milliseconds timeout = mTimerWheel.GetTimeout(Clock::now());
+
+    // `Milliseconds::max()` would overflow once converted to microseconds.
+    if (timeout != Milliseconds::max() && timeout < FromTimeval<Microseconds>(aMainloop.mTimeout))
+    {
+        aMainloop.mTimeout = ToTimeval(timeout);
+    }
+
+    mFdEvents.clear();
+
+#ifdef __linux__
+    // The watched file descriptors stay registered in the epoll
+    // instance, which is readable while any of them has events.
+    FD_SET(mEpollFd, &aMainloop.mReadFdSet);
+    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mEpollFd);
+#else
+    for (const auto &entry : mFdWatchers)
+    {
+        if (entry.second->mEvents & kEventReadable)
+        {
+            FD_SET(entry.first, &aMainloop.mReadFdSet);
+        }
+
+        if (entry.second->mEvents & kEventWritable)
+        {
+            FD_SET(entry.first, &aMainloop.mWriteFdSet);
+        }
+
+        if (entry.second->mEvents != 0)
+        {
+            FD_SET(entry.first, &aMainloop.mErrorFdSet);
+            aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, entry.first);
+        }
+    }
+#endif
+
+    rval = select(aMainloop.mMaxFd + 1, &aMainloop.mReadFdSet, &aMainloop.mWriteFdSet, &aMainloop.mErrorFdSet,
+                  &aMainloop.mTimeout);
+    VerifyOrExit(rval > 0);
+
+#ifdef __linux__
+    if (FD_ISSET(mEpollFd, &aMainloop.mReadFdSet))
+    {
+        struct epoll_event events[kMaxEpollEvents];
+        int                count = epoll_wait(mEpollFd, events, kMaxEpollEvents, 0);
+
+        for (int i = 0; i < count; i++)
+        {
+            FdEvent fdEvent;
+
+            fdEvent.mFd         = static_cast<int>(events[i].data.u64 & 0xffffffff);
+            fdEvent.mGeneration = static_cast<uint32_t>(events[i].data.u64 >> 32);
+            fdEvent.mEvents     = 0;
+
+            if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+            {
+                fdEvent.mEvents |= kEventReadable;
+            }
+
+            if (events[i].events & (EPOLLOUT | EPOLLERR))
+            {
+                fdEvent.mEvents |= kEventWritable;
+            }
+
+            if (events[i].events & EPOLLERR)
+            {
+                fdEvent.mEvents |= kEventError;
+            }
+
+            mFdEvents.push_back(fdEvent);
+        }
+    }
+#else
+    for (const auto &entry : mFdWatchers)
+    {
+        FdEvent fdEvent;
+
+        fdEvent.mFd         = entry.first;
+        fdEvent.mGeneration = entry.second->mGeneration;
+        fdEvent.mEvents     = 0;
+
+        if (FD_ISSET(entry.first, &aMainloop.mReadFdSet))
+        {
+            fdEvent.mEvents |= kEventReadable;
+        }
+
+        if (FD_ISSET(entry.first, &aMainloop.mWriteFdSet))
+        {
+            fdEvent.mEvents |= kEventWritable;
+        }
+
+        if (FD_ISSET(entry.first, &aMainloop.mErrorFdSet))
+        {
+            fdEvent.mEvents |= kEventError;
+        }
+
+        if (fdEvent.mEvents != 0)
+        {
+            mFdEvents.push_back(fdEvent);
+        }
+    }
+#endif
+
+exit:
+    return rval;
+}
+
+void MainloopManager::ProcessFdEvents(void)
+{
+    for (const FdEvent &fdEvent : mFdEvents)
+    {
+        auto     it = mFdWatchers.find(fdEvent.mFd);
+        uint32_t events;
+
+        // Skip the events of a file descriptor removed (and maybe
+        // reused) by the handler of a previous event.
+        if (it == mFdWatchers.end() || it->second->mGeneration != fdEvent.mGeneration)
+        {
+            continue;
+        }
+
+        events = fdEvent.mEvents & (it->second->mEvents | kEventError);
+
+        if (events != 0)
+        {
+            it->second->mHandler(events);
+        }
+    }
+
+    mFdEvents.clear();
+}
+
+otbrError MainloopManager::AddFd(int aFd, uint32_t aEvents, FdHandler aHandler)
+{
+    otbrError                  error   = OTBR_ERROR_NONE;
+    std::unique_ptr<FdWatcher> watcher = std::unique_ptr<FdWatcher>(new FdWatcher());
+
+    assert(aFd >= 0 && mFdWatchers.find(aFd) == mFdWatchers.end());
+
+    watcher->mEvents     = 0;
+    watcher->mGeneration = mNextGeneration++;
+    watcher->mRegistered = false;
+    watcher->mHandler    = std::move(aHandler);
+
+    SuccessOrExit(error = Register(aFd, *watcher, aEvents));
+    mFdWatchers.emplace(aFd, std::move(watcher));
+
+exit:
+    return error;
+}
+
+otbrError MainloopManager::UpdateFd(int aFd, uint32_t aEvents)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    auto      it    = mFdWatchers.find(aFd);
+
+    VerifyOrExit(it != mFdWatchers.end(), error = OTBR_ERROR_NOT_FOUND);
+    VerifyOrExit(it->second->mEvents != aEvents);
+
+    error = Register(aFd, *it->second, aEvents);
+
+exit:
+    return error;
+}
+
+void MainloopManager::RemoveFd(int aFd)
+{
+    auto it = mFdWatchers.find(aFd);
+
+    VerifyOrExit(it != mFdWatchers.end());
+
+#ifdef __linux__
+    if (it->second->mRegistered && epoll_ctl(mEpollFd, EPOLL_CTL_DEL, aFd, nullptr) != 0)
+    {
+        otbrLogWarning("Failed to stop watching fd %d: %s", aFd, strerror(errno));
+    }
+#endif
+
+    mRemovedFdWatchers.push_back(std::move(it->second));
+    mFdWatchers.erase(it);
+
+exit:
+    return;
+}
+
+otbrError MainloopManager::Register(int aFd, FdWatcher &aWatcher, uint32_t aEvents)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+#ifdef __linux__
+    struct epoll_event event;
+    int                op;
+
+    // Errors and hang-ups are always reported by epoll, a file
+    // descriptor without any event to watch is removed from the
+    // epoll instance so that it does not wake up the mainloop.
+    if (aEvents == 0)
+    {
+        VerifyOrExit(aWatcher.mRegistered);
+        VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_DEL, aFd, nullptr) == 0, error = OTBR_ERROR_ERRNO);
+        aWatcher.mRegistered = false;
+        ExitNow();
+    }
+
+    memset(&event, 0, sizeof(event));
+    event.data.u64 = (static_cast<uint64_t>(aWatcher.mGeneration) << 32) | static_cast<uint32_t>(aFd);
+    event.events   = 0;
+    op             = aWatcher.mRegistered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+
+    if (aEvents & kEventReadable)
+    {
+        event.events |= EPOLLIN;
+    }
+
+    if (aEvents & kEventWritable)
+    {
+        event.events |= EPOLLOUT;
+    }
+
+    VerifyOrExit(epoll_ctl(mEpollFd, op, aFd, &event) == 0, error = OTBR_ERROR_ERRNO);
+    aWatcher.mRegistered = true;
+#else
+    OTBR_UNUSED_VARIABLE(aFd);
+#endif
+
+exit:
+    if (error == OTBR_ERROR_NONE)
+    {
+        aWatcher.mEvents = aEvents;
+    }
+    else
+    {
+        otbrLogWarning("Failed to watch fd %d: %s", aFd, strerror(errno));
+    }
+
+    return error;
 }
 } // namespace otbr
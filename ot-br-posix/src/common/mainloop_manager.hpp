@@ -38,10 +38,17 @@
 
 #include <openthread/openthread-system.h>
 
+#include <functional>
 #include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/time.hpp"
+#include "common/timer_wheel.hpp"
+#include "common/types.hpp"
 #include "ncp/ncp_openthread.hpp"
 
 namespace otbr {
@@ -49,15 +56,45 @@ namespace otbr {
 /**
  * This class implements the mainloop manager.
  *
+ * Besides the mainloop processors, which add their file descriptors to the mainloop context at every iteration,
+ * the mainloop manager watches file descriptors registered once with `AddFd()`. On Linux, these are kept in an
+ * epoll instance, so their number does not add to the cost of an iteration and is not limited by `FD_SETSIZE`.
+ * The mainloop manager also runs timers on a `TimerWheel`.
+ *
+ * The file descriptor and timer methods must only be called on the mainloop.
+ *
  */
 class MainloopManager : private NonCopyable
 {
 public:
+    /**
+     * The events of a file descriptor watched by the mainloop manager.
+     *
+     */
+    enum : uint32_t
+    {
+        kEventReadable = 1 << 0, ///< The file descriptor is readable.
+        kEventWritable = 1 << 1, ///< The file descriptor is writable.
+        kEventError    = 1 << 2, ///< An error occurred on the file descriptor, always reported.
+    };
+
+    /**
+     * This type represents the handler of the events of a file descriptor.
+     *
+     */
+    typedef std::function<void(uint32_t aEvents)> FdHandler;
+
     /**
      * The constructor to initialize the mainloop manager.
      *
      */
-    MainloopManager() = default;
+    MainloopManager(void);
+
+    /**
+     * The destructor to free the resources of the mainloop manager.
+     *
+     */
+    ~MainloopManager(void);
 
     /**
      * This method returns the singleton instance of the mainloop manager.
@@ -101,8 +138,111 @@ public:
      */
     void Process(const MainloopContext &aMainloop);
 
+    /**
+     * This method waits for the file descriptors of the mainloop context, the watched file descriptors and the timers.
+     *
+     * This method is used in place of `select()` between `Update()` and `Process()`.
+     *
+     * @param[in,out] aMainloop  A reference to the mainloop context.
+     *
+     * @returns The value returned by `select()`.
+     *
+     */
+    int Poll(MainloopContext &aMainloop);
+
+    /**
+     * This method starts watching a file descriptor.
+     *
+     * The handler is called from `Process()` while any of the events is pending on the file descriptor. The file
+     * descriptor must be removed with `RemoveFd()` before it is closed.
+     *
+     * @param[in] aFd       The file descriptor.
+     * @param[in] aEvents   The events to watch, a combination of `kEventReadable` and `kEventWritable`.
+     * @param[in] aHandler  The handler of the events.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully started watching the file descriptor.
+     * @retval OTBR_ERROR_ERRNO  Failed to watch the file descriptor, `errno` tells the reason.
+     *
+     */
+    otbrError AddFd(int aFd, uint32_t aEvents, FdHandler aHandler);
+
+    /**
+     * This method changes the events watched on a file descriptor.
+     *
+     * @param[in] aFd      The file descriptor.
+     * @param[in] aEvents  The events to watch, zero to stop watching until the next change.
+     *
+     * @retval OTBR_ERROR_NONE       Successfully changed the events.
+     * @retval OTBR_ERROR_NOT_FOUND  The file descriptor is not watched.
+     * @retval OTBR_ERROR_ERRNO      Failed to change the events, `errno` tells the reason.
+     *
+     */
+    otbrError UpdateFd(int aFd, uint32_t aEvents);
+
+    /**
+     * This method stops watching a file descriptor.
+     *
+     * The handler is not called anymore, even for the events already polled.
+     *
+     * @param[in] aFd  The file descriptor.
+     *
+     */
+    void RemoveFd(int aFd);
+
+    /**
+     * This method starts a timer.
+     *
+     * @param[in] aDelay    The delay before calling the handler.
+     * @param[in] aHandler  The handler to be called from `Process()`.
+     *
+     * @returns  The unique ID of the timer.
+     *
+     */
+    TimerWheel::TimerId AddTimer(Milliseconds aDelay, TimerWheel::Handler aHandler)
+    {
+        return mTimerWheel.Add(aDelay, std::move(aHandler));
+    }
+
+    /**
+     * This method cancels a timer.
+     *
+     * @param[in] aTimerId  The ID of the timer.
+     *
+     */
+    void CancelTimer(TimerWheel::TimerId aTimerId) { mTimerWheel.Cancel(aTimerId); }
+
 private:
+    struct FdWatcher
+    {
+        uint32_t  mEvents;
+        uint32_t  mGeneration;
+        bool      mRegistered;
+        FdHandler mHandler;
+    };
+
+    struct FdEvent
+    {
+        int      mFd;
+        uint32_t mGeneration;
+        uint32_t mEvents;
+    };
+
+    otbrError Register(int aFd, FdWatcher &aWatcher, uint32_t aEvents);
+    void      ProcessFdEvents(void);
+
     std::list<MainloopProcessor *> mMainloopProcessorList;
+
+#ifdef __linux__
+    int mEpollFd;
+#endif
+
+    // The watchers are only freed after the events polled for them are processed.
+    std::unordered_map<int, std::unique_ptr<FdWatcher>> mFdWatchers;
+    std::vector<std::unique_ptr<FdWatcher>>              mRemovedFdWatchers;
+    std::vector<FdEvent>                                 mFdEvents;
+    uint32_t                                             mNextGeneration;
+
+    TimerWheel mTimerWheel;
 };
 } // namespace otbr
 #endif // OTBR_COMMON_MAINLOOP_MANAGER_HPP_
@@ -0,0 +1,146 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the timer wheel that runs timers on the mainloop.
+ */
+
+#include "common/timer_wheel.hpp"
+
+#include <algorithm>
+
+namespace otbr {
+
+constexpr Milliseconds TimerWheel::kTick;
+
+TimerWheel::TimerWheel(void)
+    : mStartTime(Clock::now())
+    , mCurrentTick(0)
+    , mNextTimerId(1)
+    , mSlots(kNumSlots)
+{
+}
+
+uint64_t TimerWheel::GetTick(Timepoint aTime) const
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<Milliseconds>(aTime - mStartTime).count() /
+                                 kTick.count());
+}
+
+TimerWheel::TimerId TimerWheel::Add(Milliseconds aDelay, Handler aHandler)
+{
+    TimerId  timerId = mNextTimerId++;
+    auto     expire  = std::chrono::duration_cast<Milliseconds>(Clock::now() - mStartTime) + aDelay;
+    uint64_t tick    = static_cast<uint64_t>((expire.count() + kTick.count() - 1) / kTick.count());
+
+    // A timer never expires in a tick that has already been processed.
+    tick = std::max(tick, mCurrentTick + 1);
+
+    mTimers.emplace(timerId, Timer{tick, std::move(aHandler)});
+    mSlots[tick % kNumSlots].push_back(timerId);
+
+    return timerId;
+}
+
+void TimerWheel::Cancel(TimerId aTimerId)
+{
+    mTimers.erase(aTimerId);
+}
+
+Milliseconds TimerWheel::GetTimeout(Timepoint aNow) const
+{
+    Milliseconds timeout = Milliseconds::max();
+
+    VerifyOrExit(!mTimers.empty());
+
+    // The slot of the earliest timer is within one turn of the wheel. Timers of later
+    // turns sharing the slot only cause an early wake up.
+    for (uint64_t tick = mCurrentTick + 1; tick <= mCurrentTick + kNumSlots; tick++)
+    {
+        if (!mSlots[tick % kNumSlots].empty())
+        {
+            Timepoint expire = mStartTime + Milliseconds(static_cast<Milliseconds::rep>(tick) * kTick.count());
+
+            timeout = (expire > aNow) ? std::chrono::duration_cast<Milliseconds>(expire - aNow) : Milliseconds::zero();
+            break;
+        }
+    }
+
+exit:
+    return timeout;
+}
+
+void TimerWheel::Process(Timepoint aNow)
+{
+    uint64_t targetTick = GetTick(aNow);
+    uint64_t lastTick;
+
+    VerifyOrExit(targetTick > mCurrentTick);
+
+    // Visiting every slot once is enough to find all the expired timers.
+    lastTick = std::min(targetTick, mCurrentTick + kNumSlots);
+
+    while (mCurrentTick < lastTick)
+    {
+        std::vector<TimerId> timerIds;
+
+        mCurrentTick++;
+
+        // Handlers may add timers to the slot being processed.
+        timerIds.swap(mSlots[mCurrentTick % kNumSlots]);
+
+        for (TimerId timerId : timerIds)
+        {
+            auto    it = mTimers.find(timerId);
+            Handler handler;
+
+            if (it == mTimers.end())
+            {
+                continue;
+            }
+
+            if (it->second.mExpireTick > targetTick)
+            {
+                mSlots[mCurrentTick % kNumSlots].push_back(timerId);
+                continue;
+            }
+
+            handler = std::move(it->second.mHandler);
+            mTimers.erase(it);
+            handler();
+        }
+    }
+
+    mCurrentTick = targetTick;
+
+exit:
+    return;
+}
+
+} // namespace otbr
@@ -0,0 +1,156 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the timer wheel that runs timers on the mainloop.
+ */
+
+#ifndef OTBR_COMMON_TIMER_WHEEL_HPP_
+#define OTBR_COMMON_TIMER_WHEEL_HPP_
+
+#include <openthread-br/config.h>
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a hashed timer wheel.
+ *
+ * Timers are hashed by their expiration tick into a fixed number of slots, so adding, cancelling and
+ * expiring a timer takes constant time regardless of the number of timers. This suits the many short
+ * lived timeouts of sockets (e.g. REST connections) which are mostly cancelled before they expire.
+ *
+ * Unlike the `TaskRunner`, this class is not thread-safe and must only be used on the mainloop.
+ *
+ */
+class TimerWheel : private NonCopyable
+{
+public:
+    /**
+     * This type represents the handler of a timer.
+     *
+     */
+    typedef std::function<void(void)> Handler;
+
+    /**
+     * This type represents a unique ID to a timer.
+     *
+     * Note: A valid timer ID is never zero.
+     *
+     */
+    typedef uint64_t TimerId;
+
+    /**
+     * The resolution of the timers.
+     *
+     */
+    static constexpr Milliseconds kTick = Milliseconds(10);
+
+    /**
+     * This constructor initializes the timer wheel.
+     *
+     */
+    TimerWheel(void);
+
+    /**
+     * This method starts a timer.
+     *
+     * The handler is called on the mainloop, no earlier than `aDelay` from now and no later than `kTick` after.
+     *
+     * @param[in] aDelay    The delay before calling the handler.
+     * @param[in] aHandler  The handler to be called.
+     *
+     * @returns  The unique ID of the timer.
+     *
+     */
+    TimerId Add(Milliseconds aDelay, Handler aHandler);
+
+    /**
+     * This method cancels a timer.
+     *
+     * Cancelling a timer which has already fired or been cancelled has no effect.
+     *
+     * @param[in] aTimerId  The ID of the timer.
+     *
+     */
+    void Cancel(TimerId aTimerId);
+
+    /**
+     * This method returns the time until the next timer expires.
+     *
+     * @param[in] aNow  The current time.
+     *
+     * @returns  The time until the next timer expires, or `Milliseconds::max()` if there is no timer.
+     *
+     */
+    Milliseconds GetTimeout(Timepoint aNow) const;
+
+    /**
+     * This method calls the handlers of the expired timers.
+     *
+     * Handlers may start and cancel timers.
+     *
+     * @param[in] aNow  The current time.
+     *
+     */
+    void Process(Timepoint aNow);
+
+private:
+    static constexpr uint32_t kNumSlots = 512;
+
+    struct Timer
+    {
+        uint64_t mExpireTick;
+        Handler  mHandler;
+    };
+
+    uint64_t GetTick(Timepoint aTime) const;
+
+    Timepoint mStartTime;
+    uint64_t  mCurrentTick;
+    TimerId   mNextTimerId;
+
+    // The IDs of the timers expiring at the tick, hashed by tick. IDs of cancelled
+    // timers are left in place and skipped when their slot is processed.
+    std::vector<std::vector<TimerId>> mSlots;
+
+    std::unordered_map<TimerId, Timer> mTimers;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_TIMER_WHEEL_HPP_
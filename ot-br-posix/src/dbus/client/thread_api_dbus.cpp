@@ -678,6 +678,26 @@ ClientError ThreadApiDBus::GetNat64ErrorCounters(Nat64ErrorCounters &aCounters)
     return GetProperty(OTBR_DBUS_PROPERTY_NAT64_ERROR_COUNTERS, aCounters);
 }
 
+ClientError ThreadApiDBus::GetMudDeviceCounters(std::vector<MudDeviceCounters> &aCounters)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_MUD_DEVICE_COUNTERS, aCounters);
+}
+
+ClientError ThreadApiDBus::GetMudAceCounters(std::vector<MudAceCounters> &aCounters)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_MUD_ACE_COUNTERS, aCounters);
+}
+
+ClientError ThreadApiDBus::GetMudHistograms(MudHistograms &aHistograms)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_MUD_HISTOGRAMS, aHistograms);
+}
+
+ClientError ThreadApiDBus::GetNetworkDiagnostics(std::vector<NetworkDiagnostic> &aDiagnostics)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_NETWORK_DIAGNOSTICS, aDiagnostics);
+}
+
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
 ClientError ThreadApiDBus::GetDnssdCounters(DnssdCounters &aDnssdCounters)
 {
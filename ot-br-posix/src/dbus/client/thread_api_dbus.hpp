@@ -856,6 +856,54 @@ public:
      */
     ClientError GetNat64ErrorCounters(Nat64ErrorCounters &aCounters);
 
+    /**
+     * This method gets the traffic counters of the devices attached to a MUD policy.
+     *
+     * @param[out] aCounters  The traffic counters of the MUD devices.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetMudDeviceCounters(std::vector<MudDeviceCounters> &aCounters);
+
+    /**
+     * This method gets the traffic counters of the ACEs of the installed MUD policies.
+     *
+     * @param[out] aCounters  The traffic counters of the MUD ACEs.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetMudAceCounters(std::vector<MudAceCounters> &aCounters);
+
+    /**
+     * This method gets the latency and queue depth histograms of the MUD Manager.
+     *
+     * @param[out] aHistograms  The histograms of the MUD Manager.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetMudHistograms(MudHistograms &aHistograms);
+
+    /**
+     * This method gets the latest network diagnostics of the nodes of the Thread network.
+     *
+     * @param[out] aDiagnostics  The network diagnostics of the nodes.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetNetworkDiagnostics(std::vector<NetworkDiagnostic> &aDiagnostics);
+
 private:
     ClientError CallDBusMethodSync(const std::string &aMethodName);
     ClientError CallDBusMethodAsync(const std::string &aMethodName, DBusPendingCallNotifyFunction aFunction);
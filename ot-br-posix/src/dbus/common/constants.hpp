@@ -112,6 +112,10 @@
 #define OTBR_DBUS_PROPERTY_NAT64_PROTOCOL_COUNTERS "Nat64ProtocolCounters"
 #define OTBR_DBUS_PROPERTY_NAT64_ERROR_COUNTERS "Nat64ErrorCounters"
 #define OTBR_DBUS_PROPERTY_INFRA_LINK_INFO "InfraLinkInfo"
+#define OTBR_DBUS_PROPERTY_MUD_DEVICE_COUNTERS "MudDeviceCounters"
+#define OTBR_DBUS_PROPERTY_MUD_ACE_COUNTERS "MudAceCounters"
+#define OTBR_DBUS_PROPERTY_MUD_HISTOGRAMS "MudHistograms"
+#define OTBR_DBUS_PROPERTY_NETWORK_DIAGNOSTICS "NetworkDiagnostics"
 
 #define OTBR_ROLE_NAME_DISABLED "disabled"
 #define OTBR_ROLE_NAME_DETACHED "detached"
@@ -113,6 +113,18 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const Nat64ErrorCounters &aC
 otbrError DBusMessageExtract(DBusMessageIter *aIter, Nat64ErrorCounters &aCounters);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const InfraLinkInfo &aInfraLinkInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, InfraLinkInfo &aInfraLinkInfo);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MudTrafficCounters &aCounters);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MudTrafficCounters &aCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MudDeviceCounters &aCounters);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MudDeviceCounters &aCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MudAceCounters &aCounters);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MudAceCounters &aCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MudHistogram &aHistogram);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MudHistogram &aHistogram);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MudHistograms &aHistograms);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MudHistograms &aHistograms);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const NetworkDiagnostic &aDiagnostic);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, NetworkDiagnostic &aDiagnostic);
 
 template <typename T> struct DBusTypeTrait;
 
@@ -386,6 +398,64 @@ template <> struct DBusTypeTrait<InfraLinkInfo>
     static constexpr const char *TYPE_AS_STRING = "(sbbbuuu)";
 };
 
+template <> struct DBusTypeTrait<MudTrafficCounters>
+{
+    // struct of { uint64, uint64 }
+    static constexpr const char *TYPE_AS_STRING = "(tt)";
+};
+
+template <> struct DBusTypeTrait<MudDeviceCounters>
+{
+    // struct of { string, string, string, struct of { uint64, uint64 } }
+    static constexpr const char *TYPE_AS_STRING = "(sss(tt))";
+};
+
+template <> struct DBusTypeTrait<std::vector<MudDeviceCounters>>
+{
+    // array of struct of { string, string, string, struct of { uint64, uint64 } }
+    static constexpr const char *TYPE_AS_STRING = "a(sss(tt))";
+};
+
+template <> struct DBusTypeTrait<MudAceCounters>
+{
+    // struct of { string, string, string, bool, struct of { uint64, uint64 } }
+    static constexpr const char *TYPE_AS_STRING = "(sssb(tt))";
+};
+
+template <> struct DBusTypeTrait<std::vector<MudAceCounters>>
+{
+    // array of struct of { string, string, string, bool, struct of { uint64, uint64 } }
+    static constexpr const char *TYPE_AS_STRING = "a(sssb(tt))";
+};
+
+template <> struct DBusTypeTrait<MudHistogram>
+{
+    // struct of { uint64, uint64, uint64, array of uint64 }
+    static constexpr const char *TYPE_AS_STRING = "(tttat)";
+};
+
+template <> struct DBusTypeTrait<MudHistograms>
+{
+    // struct of { struct of { uint64, uint64, uint64, array of uint64 }
+    //             struct of { uint64, uint64, uint64, array of uint64 }
+    //             struct of { uint64, uint64, uint64, array of uint64 }
+    //             struct of { uint64, uint64, uint64, array of uint64 }
+    //             struct of { uint64, uint64, uint64, array of uint64 } }
+    static constexpr const char *TYPE_AS_STRING = "((tttat)(tttat)(tttat)(tttat)(tttat))";
+};
+
+template <> struct DBusTypeTrait<NetworkDiagnostic>
+{
+    // struct of { uint16, uint32, array of uint8 }
+    static constexpr const char *TYPE_AS_STRING = "(quay)";
+};
+
+template <> struct DBusTypeTrait<std::vector<NetworkDiagnostic>>
+{
+    // array of struct of { uint16, uint32, array of uint8 }
+    static constexpr const char *TYPE_AS_STRING = "a(quay)";
+};
+
 template <> struct DBusTypeTrait<int8_t>
 {
     static constexpr int         TYPE           = DBUS_TYPE_BYTE;
@@ -1195,5 +1195,207 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MudTrafficCounters &aCounters)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aCounters.mPackets));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aCounters.mBytes));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MudTrafficCounters &aCounters)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    dbus_message_iter_recurse(aIter, &sub);
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aCounters.mPackets));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aCounters.mBytes));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MudDeviceCounters &aCounters)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aCounters.mExtAddress));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aCounters.mPolicyName));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aCounters.mUrl));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aCounters.mCounters));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MudDeviceCounters &aCounters)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    dbus_message_iter_recurse(aIter, &sub);
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aCounters.mExtAddress));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aCounters.mPolicyName));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aCounters.mUrl));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aCounters.mCounters));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MudAceCounters &aCounters)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aCounters.mPolicyName));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aCounters.mAclName));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aCounters.mAceName));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aCounters.mToDevice));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aCounters.mCounters));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MudAceCounters &aCounters)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    dbus_message_iter_recurse(aIter, &sub);
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aCounters.mPolicyName));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aCounters.mAclName));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aCounters.mAceName));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aCounters.mToDevice));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aCounters.mCounters));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MudHistogram &aHistogram)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHistogram.mCount));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHistogram.mSum));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHistogram.mMax));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHistogram.mBuckets));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MudHistogram &aHistogram)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    dbus_message_iter_recurse(aIter, &sub);
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHistogram.mCount));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHistogram.mSum));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHistogram.mMax));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHistogram.mBuckets));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MudHistograms &aHistograms)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHistograms.mFetchLatency));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHistograms.mParseLatency));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHistograms.mCompileLatency));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHistograms.mInstallLatency));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHistograms.mQueueDepth));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MudHistograms &aHistograms)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    dbus_message_iter_recurse(aIter, &sub);
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHistograms.mFetchLatency));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHistograms.mParseLatency));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHistograms.mCompileLatency));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHistograms.mInstallLatency));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHistograms.mQueueDepth));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const NetworkDiagnostic &aDiagnostic)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aDiagnostic.mRloc16));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aDiagnostic.mAge));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aDiagnostic.mTlvs));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, NetworkDiagnostic &aDiagnostic)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    dbus_message_iter_recurse(aIter, &sub);
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aDiagnostic.mRloc16));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aDiagnostic.mAge));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aDiagnostic.mTlvs));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
 } // namespace DBus
 } // namespace otbr
@@ -701,6 +701,53 @@ struct InfraLinkInfo
     uint32_t    mGlobalUnicastAddresses; ///< The number of global unicast addresses on the infra network interface.
 };
 
+struct MudTrafficCounters
+{
+    uint64_t mPackets; ///< The number of packets.
+    uint64_t mBytes;   ///< The number of bytes.
+};
+
+struct MudDeviceCounters
+{
+    std::string        mExtAddress; ///< The extended address of the device, in hex.
+    std::string        mPolicyName; ///< The name of the policy the device is attached to.
+    std::string        mUrl;        ///< The MUD URL of the policy.
+    MudTrafficCounters mCounters;   ///< The traffic forwarded from and to the device.
+};
+
+struct MudAceCounters
+{
+    std::string        mPolicyName; ///< The name of the policy.
+    std::string        mAclName;    ///< The name of the ACL.
+    std::string        mAceName;    ///< The name of the ACE.
+    bool               mToDevice;   ///< Whether the ACE applies to the traffic to the device, or from it.
+    MudTrafficCounters mCounters;   ///< The traffic accepted by the ACE.
+};
+
+struct MudHistogram
+{
+    uint64_t              mCount;   ///< The number of recorded values.
+    uint64_t              mSum;     ///< The sum of the recorded values.
+    uint64_t              mMax;     ///< The largest recorded value.
+    std::vector<uint64_t> mBuckets; ///< Bucket 0 counts the zero values, bucket i the values in [2^(i-1), 2^i).
+};
+
+struct MudHistograms
+{
+    MudHistogram mFetchLatency;   ///< The time to download a MUD file, in microseconds.
+    MudHistogram mParseLatency;   ///< The time to parse a MUD file, in microseconds.
+    MudHistogram mCompileLatency; ///< The time to compile a MUD file into a policy, in microseconds.
+    MudHistogram mInstallLatency; ///< The time to install a policy in the firewall, in microseconds.
+    MudHistogram mQueueDepth;     ///< The number of tasks waiting for the MUD worker thread.
+};
+
+struct NetworkDiagnostic
+{
+    uint16_t             mRloc16; ///< The RLOC16 of the node.
+    uint32_t             mAge;    ///< The time since the diagnostics were received, in milliseconds.
+    std::vector<uint8_t> mTlvs;   ///< The diagnostic TLVs as received from the node.
+};
+
 } // namespace DBus
 } // namespace otbr
 
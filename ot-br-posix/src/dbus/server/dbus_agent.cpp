@@ -48,6 +48,8 @@ DBusAgent::DBusAgent(otbr::Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPu
     : mInterfaceName(aNcp.GetInterfaceName())
     , mNcp(aNcp)
     , mPublisher(aPublisher)
+    , mMudManager(nullptr)
+    , mDiagCollector(nullptr)
 {
 }
 
@@ -65,8 +67,8 @@ void DBusAgent::Init(void)
 
     VerifyOrDie(mConnection != nullptr, "Failed to get DBus connection");
 
-    mThreadObject =
-        std::unique_ptr<DBusThreadObject>(new DBusThreadObject(mConnection.get(), mInterfaceName, &mNcp, &mPublisher));
+    mThreadObject = std::unique_ptr<DBusThreadObject>(new DBusThreadObject(mConnection.get(), mInterfaceName, &mNcp,
+                                                                           &mPublisher, mMudManager, mDiagCollector));
     error = mThreadObject->Init();
     VerifyOrDie(error == OTBR_ERROR_NONE, "Failed to initialize DBus Agent");
 }
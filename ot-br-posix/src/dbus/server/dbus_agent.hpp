@@ -68,6 +68,26 @@ public:
      */
     void Init(void);
 
+    /**
+     * This method sets the MUD Manager whose statistics are exposed.
+     *
+     * This method must be called before `Init()`.
+     *
+     * @param[in] aMudManager  A reference to the MUD Manager.
+     *
+     */
+    void SetMudManager(MUD::MudManager &aMudManager) { mMudManager = &aMudManager; }
+
+    /**
+     * This method sets the collector whose network diagnostics are exposed.
+     *
+     * This method must be called before `Init()`.
+     *
+     * @param[in] aDiagCollector  A reference to the diagnostics collector.
+     *
+     */
+    void SetDiagCollector(agent::DiagCollector &aDiagCollector) { mDiagCollector = &aDiagCollector; }
+
     void Update(MainloopContext &aMainloop) override;
     void Process(const MainloopContext &aMainloop) override;
 
@@ -88,6 +108,8 @@ private:
     UniqueDBusConnection              mConnection;
     otbr::Ncp::ControllerOpenThread  &mNcp;
     Mdns::Publisher                  &mPublisher;
+    MUD::MudManager                  *mMudManager;
+    agent::DiagCollector             *mDiagCollector;
 
     /**
      * This map is used to track DBusWatch-es.
@@ -48,6 +48,9 @@
 #include "dbus/common/constants.hpp"
 #include "dbus/server/dbus_agent.hpp"
 #include "dbus/server/dbus_thread_object.hpp"
+#if OTBR_ENABLE_MUD_MANAGER
+#include "mud_manager/mud_manager.hpp"
+#endif
 #if OTBR_ENABLE_FEATURE_FLAGS
 #include "proto/feature_flag.pb.h"
 #endif
@@ -123,10 +126,14 @@ namespace DBus {
 DBusThreadObject::DBusThreadObject(DBusConnection                  *aConnection,
                                    const std::string               &aInterfaceName,
                                    otbr::Ncp::ControllerOpenThread *aNcp,
-                                   Mdns::Publisher                 *aPublisher)
+                                   Mdns::Publisher                 *aPublisher,
+                                   MUD::MudManager                 *aMudManager,
+                                   agent::DiagCollector            *aDiagCollector)
     : DBusObject(aConnection, OTBR_DBUS_OBJECT_PREFIX + aInterfaceName)
     , mNcp(aNcp)
     , mPublisher(aPublisher)
+    , mMudManager(aMudManager)
+    , mDiagCollector(aDiagCollector)
 {
 }
 
@@ -291,6 +298,14 @@ otbrError DBusThreadObject::Init(void)
                                std::bind(&DBusThreadObject::GetNat64ErrorCounters, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_INFRA_LINK_INFO,
                                std::bind(&DBusThreadObject::GetInfraLinkInfo, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MUD_DEVICE_COUNTERS,
+                               std::bind(&DBusThreadObject::GetMudDeviceCounters, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MUD_ACE_COUNTERS,
+                               std::bind(&DBusThreadObject::GetMudAceCounters, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MUD_HISTOGRAMS,
+                               std::bind(&DBusThreadObject::GetMudHistograms, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NETWORK_DIAGNOSTICS,
+                               std::bind(&DBusThreadObject::GetNetworkDiagnostics, this, _1));
 
     SuccessOrExit(error = Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SIGNAL_READY, std::make_tuple()));
 
@@ -1845,6 +1860,152 @@ exit:
 #endif
 }
 
+#if OTBR_ENABLE_MUD_MANAGER
+static MudTrafficCounters GetMudTrafficCounters(const MUD::TrafficCounters &aCounters)
+{
+    MudTrafficCounters counters;
+
+    counters.mPackets = aCounters.mPackets;
+    counters.mBytes   = aCounters.mBytes;
+
+    return counters;
+}
+
+static MudHistogram GetMudHistogram(const MUD::Histogram &aHistogram)
+{
+    MudHistogram histogram;
+
+    histogram.mCount = aHistogram.GetCount();
+    histogram.mSum   = aHistogram.GetSum();
+    histogram.mMax   = aHistogram.GetMax();
+
+    for (uint8_t i = 0; i < MUD::Histogram::kNumBuckets; i++)
+    {
+        histogram.mBuckets.push_back(aHistogram.GetBucket(i));
+    }
+
+    return histogram;
+}
+
+otError DBusThreadObject::GetMudDeviceCounters(DBusMessageIter &aIter)
+{
+    otError                        error = OT_ERROR_NONE;
+    MUD::MudStatistics             statistics;
+    std::vector<MudDeviceCounters> devices;
+
+    VerifyOrExit(mMudManager != nullptr, error = OT_ERROR_NOT_IMPLEMENTED);
+    mMudManager->GetStatistics(statistics);
+
+    for (const MUD::MudStatistics::Device &device : statistics.mDevices)
+    {
+        MudDeviceCounters counters;
+
+        counters.mExtAddress = device.mExtAddress;
+        counters.mPolicyName = device.mPolicyName;
+        counters.mUrl        = device.mUrl;
+        counters.mCounters   = GetMudTrafficCounters(device.mCounters);
+        devices.push_back(counters);
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, devices) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetMudAceCounters(DBusMessageIter &aIter)
+{
+    otError                     error = OT_ERROR_NONE;
+    MUD::MudStatistics          statistics;
+    std::vector<MudAceCounters> aces;
+
+    VerifyOrExit(mMudManager != nullptr, error = OT_ERROR_NOT_IMPLEMENTED);
+    mMudManager->GetStatistics(statistics);
+
+    for (const MUD::MudStatistics::Rule &rule : statistics.mRules)
+    {
+        MudAceCounters counters;
+
+        counters.mPolicyName = rule.mPolicyName;
+        counters.mAclName    = rule.mAclName;
+        counters.mAceName    = rule.mAceName;
+        counters.mToDevice   = (rule.mDirection == MUD::PolicyRule::kToDevice);
+        counters.mCounters   = GetMudTrafficCounters(rule.mCounters);
+        aces.push_back(counters);
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, aces) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetMudHistograms(DBusMessageIter &aIter)
+{
+    otError            error = OT_ERROR_NONE;
+    MUD::MudStatistics statistics;
+    MudHistograms      histograms;
+
+    VerifyOrExit(mMudManager != nullptr, error = OT_ERROR_NOT_IMPLEMENTED);
+    mMudManager->GetStatistics(statistics);
+
+    histograms.mFetchLatency   = GetMudHistogram(statistics.mFetchLatency);
+    histograms.mParseLatency   = GetMudHistogram(statistics.mParseLatency);
+    histograms.mCompileLatency = GetMudHistogram(statistics.mCompileLatency);
+    histograms.mInstallLatency = GetMudHistogram(statistics.mInstallLatency);
+    histograms.mQueueDepth     = GetMudHistogram(statistics.mQueueDepth);
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, histograms) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+#else  // OTBR_ENABLE_MUD_MANAGER
+otError DBusThreadObject::GetMudDeviceCounters(DBusMessageIter &aIter)
+{
+    OTBR_UNUSED_VARIABLE(aIter);
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+otError DBusThreadObject::GetMudAceCounters(DBusMessageIter &aIter)
+{
+    OTBR_UNUSED_VARIABLE(aIter);
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+otError DBusThreadObject::GetMudHistograms(DBusMessageIter &aIter)
+{
+    OTBR_UNUSED_VARIABLE(aIter);
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+#endif // OTBR_ENABLE_MUD_MANAGER
+
+otError DBusThreadObject::GetNetworkDiagnostics(DBusMessageIter &aIter)
+{
+    otError                        error = OT_ERROR_NONE;
+    auto                           now   = std::chrono::steady_clock::now();
+    std::vector<NetworkDiagnostic> diagnostics;
+
+    VerifyOrExit(mDiagCollector != nullptr, error = OT_ERROR_NOT_IMPLEMENTED);
+    mDiagCollector->NotifyRead();
+
+    for (const auto &nodeDiag : mDiagCollector->GetNodeDiags())
+    {
+        NetworkDiagnostic diagnostic;
+
+        diagnostic.mRloc16 = nodeDiag.first;
+        diagnostic.mAge    = static_cast<uint32_t>(
+            std::chrono::duration_cast<Milliseconds>(now - nodeDiag.second.mUpdateTime).count());
+        diagnostic.mTlvs   = nodeDiag.second.mRawTlvs;
+        diagnostics.push_back(diagnostic);
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, diagnostics) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
 static_assert(OTBR_SRP_SERVER_STATE_DISABLED == static_cast<uint8_t>(OT_SRP_SERVER_STATE_DISABLED),
               "OTBR_SRP_SERVER_STATE_DISABLED value is incorrect");
 static_assert(OTBR_SRP_SERVER_STATE_RUNNING == static_cast<uint8_t>(OT_SRP_SERVER_STATE_RUNNING),
@@ -41,8 +41,14 @@
 #include "dbus/server/dbus_object.hpp"
 #include "mdns/mdns.hpp"
 #include "ncp/ncp_openthread.hpp"
+#include "utils/diag_collector.hpp"
 
 namespace otbr {
+
+namespace MUD {
+class MudManager;
+}
+
 namespace DBus {
 
 /**
@@ -68,12 +74,16 @@ public:
      * @param[in] aInterfaceName  The dbus interface name.
      * @param[in] aNcp            The ncp controller
      * @param[in] aPublisher      The Mdns::Publisher
+     * @param[in] aMudManager     The MUD Manager, nullptr if not enabled
+     * @param[in] aDiagCollector  The network diagnostics collector, nullptr if not available
      *
      */
     DBusThreadObject(DBusConnection                  *aConnection,
                      const std::string               &aInterfaceName,
                      otbr::Ncp::ControllerOpenThread *aNcp,
-                     Mdns::Publisher                 *aPublisher);
+                     Mdns::Publisher                 *aPublisher,
+                     MUD::MudManager                 *aMudManager    = nullptr,
+                     agent::DiagCollector            *aDiagCollector = nullptr);
 
     otbrError Init(void) override;
 
@@ -163,6 +173,10 @@ private:
     otError GetNat64ProtocolCounters(DBusMessageIter &aIter);
     otError GetNat64ErrorCounters(DBusMessageIter &aIter);
     otError GetInfraLinkInfo(DBusMessageIter &aIter);
+    otError GetMudDeviceCounters(DBusMessageIter &aIter);
+    otError GetMudAceCounters(DBusMessageIter &aIter);
+    otError GetMudHistograms(DBusMessageIter &aIter);
+    otError GetNetworkDiagnostics(DBusMessageIter &aIter);
 
     void ReplyScanResult(DBusRequest &aRequest, otError aError, const std::vector<otActiveScanResult> &aResult);
     void ReplyEnergyScanResult(DBusRequest &aRequest, otError aError, const std::vector<otEnergyScanResult> &aResult);
@@ -170,6 +184,8 @@ private:
     otbr::Ncp::ControllerOpenThread                     *mNcp;
     std::unordered_map<std::string, PropertyHandlerType> mGetPropertyHandlers;
     otbr::Mdns::Publisher                               *mPublisher;
+    MUD::MudManager                                     *mMudManager;
+    agent::DiagCollector                                *mDiagCollector;
 };
 
 } // namespace DBus
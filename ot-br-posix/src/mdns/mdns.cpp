@@ -81,6 +81,16 @@ void Publisher::PublishHost(const std::string             &aName,
     }
 }
 
+void Publisher::EndBatch(void)
+{
+    assert(mBatchDepth > 0);
+
+    if (--mBatchDepth == 0)
+    {
+        CommitBatch();
+    }
+}
+
 void Publisher::OnServiceResolveFailed(const std::string &aType, const std::string &aInstanceName, int32_t aErrorCode)
 {
     UpdateMdnsResponseCounters(mTelemetryInfo.mServiceResolutions, DnsErrorToOtbrError(aErrorCode));
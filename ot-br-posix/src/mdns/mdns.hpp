@@ -246,6 +246,22 @@ public:
      */
     virtual void UnpublishHost(const std::string &aName, ResultCallback &&aCallback) = 0;
 
+    /**
+     * This method starts a batch of publications.
+     *
+     * The hosts and services published until the matching `EndBatch` call may be committed to the mDNS daemon
+     * together instead of one by one. The result of each publication is still reported to its own callback. Batches
+     * may be nested, only the outermost `EndBatch` commits the publications.
+     *
+     */
+    void BeginBatch(void) { ++mBatchDepth; }
+
+    /**
+     * This method ends a batch of publications started with `BeginBatch`.
+     *
+     */
+    void EndBatch(void);
+
     /**
      * This method subscribes a given service or service instance.
      *
@@ -507,6 +523,13 @@ protected:
 
     virtual otbrError DnsErrorToOtbrError(int32_t aError) = 0;
 
+    // Commits the publications made since the outermost `BeginBatch`. Implementations which don't batch
+    // publications commit each of them right away and have nothing left to do here.
+    virtual void CommitBatch(void) {}
+
+    // Tells whether the publications are part of a batch.
+    bool IsInBatch(void) const { return mBatchDepth > 0; }
+
     void AddServiceRegistration(ServiceRegistrationPtr &&aServiceReg);
     void RemoveServiceRegistration(const std::string &aName, const std::string &aType, otbrError aError);
     ServiceRegistration *FindServiceRegistration(const std::string &aName, const std::string &aType);
@@ -551,6 +574,7 @@ protected:
     HostRegistrationMap    mHostRegistrations;
 
     uint64_t mNextSubscriberId = 1;
+    uint32_t mBatchDepth       = 0;
 
     std::map<uint64_t, std::pair<DiscoveredServiceInstanceCallback, DiscoveredHostCallback>> mDiscoveredCallbacks;
     // {instance name, service type} -> the timepoint to begin service registration
@@ -432,12 +432,12 @@ PublisherAvahi::~PublisherAvahi(void)
 
 PublisherAvahi::AvahiServiceRegistration::~AvahiServiceRegistration(void)
 {
-    ReleaseGroup(mEntryGroup);
+    static_cast<PublisherAvahi *>(mPublisher)->OnRegistrationReleased(mEntryGroup);
 }
 
 PublisherAvahi::AvahiHostRegistration::~AvahiHostRegistration(void)
 {
-    ReleaseGroup(mEntryGroup);
+    static_cast<PublisherAvahi *>(mPublisher)->OnRegistrationReleased(mEntryGroup);
 }
 
 otbrError PublisherAvahi::Start(void)
@@ -467,6 +467,8 @@ void PublisherAvahi::Stop(void)
 {
     mServiceRegistrations.clear();
     mHostRegistrations.clear();
+    mBatchGroups.clear();
+    mStaleGroups.clear();
 
     mSubscribedServices.clear();
     mSubscribedHosts.clear();
@@ -518,50 +520,138 @@ void PublisherAvahi::HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupSt
         assert(false);
         break;
     }
+
+    RebuildStaleGroups();
 }
 
 void PublisherAvahi::CallHostOrServiceCallback(AvahiEntryGroup *aGroup, otbrError aError)
 {
-    ServiceRegistration *serviceReg;
-    HostRegistration    *hostReg;
+    std::vector<std::pair<std::string, std::string>> serviceNames;
+    std::vector<std::string>                         hostNames;
 
-    if ((serviceReg = FindServiceRegistration(aGroup)) != nullptr)
+    // The registrations are looked up again by name before completing or removing them, because the callbacks
+    // may update or remove the other registrations of the group.
+    for (const auto &kv : mServiceRegistrations)
     {
+        const auto &serviceReg = static_cast<const AvahiServiceRegistration &>(*kv.second);
+
+        if (serviceReg.GetEntryGroup().get() == aGroup)
+        {
+            serviceNames.emplace_back(serviceReg.mName, serviceReg.mType);
+        }
+    }
+
+    for (const auto &kv : mHostRegistrations)
+    {
+        const auto &hostReg = static_cast<const AvahiHostRegistration &>(*kv.second);
+
+        if (hostReg.GetEntryGroup().get() == aGroup)
+        {
+            hostNames.push_back(hostReg.mName);
+        }
+    }
+
+    VerifyOrExit(!serviceNames.empty() || !hostNames.empty(),
+                 otbrLogWarning("No registered service or host matches avahi group @%p", aGroup));
+
+    for (const auto &serviceName : serviceNames)
+    {
+        auto serviceReg =
+            static_cast<AvahiServiceRegistration *>(FindServiceRegistration(serviceName.first, serviceName.second));
+
+        if (serviceReg == nullptr || serviceReg->GetEntryGroup().get() != aGroup)
+        {
+            continue;
+        }
+
         if (aError == OTBR_ERROR_NONE)
         {
             serviceReg->Complete(aError);
         }
         else
         {
-            RemoveServiceRegistration(serviceReg->mName, serviceReg->mType, aError);
+            RemoveServiceRegistration(serviceName.first, serviceName.second, aError);
         }
     }
-    else if ((hostReg = FindHostRegistration(aGroup)) != nullptr)
+
+    for (const auto &hostName : hostNames)
     {
+        auto hostReg = static_cast<AvahiHostRegistration *>(FindHostRegistration(hostName));
+
+        if (hostReg == nullptr || hostReg->GetEntryGroup().get() != aGroup)
+        {
+            continue;
+        }
+
         if (aError == OTBR_ERROR_NONE)
         {
             hostReg->Complete(aError);
         }
         else
         {
-            RemoveHostRegistration(hostReg->mName, aError);
+            RemoveHostRegistration(hostName, aError);
         }
     }
+
+exit:
+    return;
+}
+
+PublisherAvahi::EntryGroupPtr PublisherAvahi::CreateGroup(AvahiClient *aClient)
+{
+    EntryGroupPtr    group;
+    AvahiEntryGroup *entryGroup = avahi_entry_group_new(aClient, HandleGroupState, this);
+
+    if (entryGroup == nullptr)
+    {
+        otbrLogErr("Failed to create entry avahi group: %s", avahi_strerror(avahi_client_errno(aClient)));
+    }
     else
     {
-        otbrLogWarning("No registered service or host matches avahi group @%p", aGroup);
+        group = EntryGroupPtr(entryGroup, ReleaseGroup);
     }
+
+    return group;
 }
 
-AvahiEntryGroup *PublisherAvahi::CreateGroup(AvahiClient *aClient)
+PublisherAvahi::EntryGroupPtr PublisherAvahi::GetGroup(const std::string &aHostName, uint32_t aEntryCount)
 {
-    AvahiEntryGroup *group = avahi_entry_group_new(aClient, HandleGroupState, this);
+    EntryGroupPtr group;
+
+    VerifyOrExit(IsInBatch(), group = CreateGroup(mClient));
 
-    if (group == nullptr)
     {
-        otbrLogErr("Failed to create entry avahi group: %s", avahi_strerror(avahi_client_errno(aClient)));
+        // The records of a host and of its services share one entry group per batch, which is committed at the
+        // end of the batch. They are updated together by SRP, so they also succeed or fail together.
+        auto it = mBatchGroups.find(aHostName);
+
+        if (it != mBatchGroups.end() && it->second.mGroup != nullptr &&
+            it->second.mEntryCount + aEntryCount > kMaxBatchGroupEntries)
+        {
+            EntryGroupPtr fullGroup = std::move(it->second.mGroup);
+
+            mBatchGroups.erase(it);
+            if (CommitGroup(fullGroup) != OTBR_ERROR_NONE)
+            {
+                CallHostOrServiceCallback(fullGroup.get(), OTBR_ERROR_MDNS);
+            }
+        }
     }
 
+    {
+        BatchGroup &batchGroup = mBatchGroups[aHostName];
+
+        if (batchGroup.mGroup == nullptr)
+        {
+            batchGroup.mGroup      = CreateGroup(mClient);
+            batchGroup.mEntryCount = 0;
+        }
+
+        batchGroup.mEntryCount += aEntryCount;
+        group = batchGroup.mGroup;
+    }
+
+exit:
     return group;
 }
 
@@ -585,6 +675,145 @@ void PublisherAvahi::ReleaseGroup(AvahiEntryGroup *aGroup)
     }
 }
 
+otbrError PublisherAvahi::CommitGroup(const EntryGroupPtr &aGroup)
+{
+    otbrError error      = OTBR_ERROR_NONE;
+    int       avahiError = avahi_entry_group_commit(aGroup.get());
+
+    if (avahiError != AVAHI_OK)
+    {
+        otbrLogErr("Failed to commit avahi group @%p: %s!", aGroup.get(), avahi_strerror(avahiError));
+        error = OTBR_ERROR_MDNS;
+    }
+
+    return error;
+}
+
+bool PublisherAvahi::IsBatchGroup(const EntryGroupPtr &aGroup) const
+{
+    bool isBatchGroup = false;
+
+    for (const auto &kv : mBatchGroups)
+    {
+        if (kv.second.mGroup == aGroup)
+        {
+            isBatchGroup = true;
+            break;
+        }
+    }
+
+    return isBatchGroup;
+}
+
+void PublisherAvahi::CommitBatch(void)
+{
+    // Drop the records of the registrations replaced or removed during the batch before committing.
+    RebuildStaleGroups();
+
+    {
+        std::map<std::string, BatchGroup> batchGroups;
+
+        batchGroups.swap(mBatchGroups);
+
+        for (const auto &kv : batchGroups)
+        {
+            // Skip the groups whose registrations have all been removed during the batch.
+            if (kv.second.mGroup != nullptr && kv.second.mGroup.use_count() > 1)
+            {
+                otbrLogInfo("Commit avahi group of host %s with %u entries", kv.first.c_str(), kv.second.mEntryCount);
+                if (CommitGroup(kv.second.mGroup) != OTBR_ERROR_NONE)
+                {
+                    CallHostOrServiceCallback(kv.second.mGroup.get(), OTBR_ERROR_MDNS);
+                }
+            }
+        }
+    }
+
+    RebuildStaleGroups();
+}
+
+void PublisherAvahi::OnRegistrationReleased(const EntryGroupPtr &aGroup)
+{
+    // The group is released along with its last registration. Otherwise it still holds the records of the released
+    // registration and is rebuilt later, as the registration maps may be being modified right now.
+    if (aGroup.use_count() > 1)
+    {
+        mStaleGroups.push_back(aGroup);
+    }
+}
+
+void PublisherAvahi::RebuildStaleGroups(void)
+{
+    std::vector<std::weak_ptr<AvahiEntryGroup>> staleGroups;
+    std::set<AvahiEntryGroup *>                 rebuiltGroups;
+
+    staleGroups.swap(mStaleGroups);
+
+    for (const auto &staleGroup : staleGroups)
+    {
+        EntryGroupPtr group = staleGroup.lock();
+
+        if (group != nullptr && rebuiltGroups.insert(group.get()).second)
+        {
+            RebuildGroup(group);
+        }
+    }
+}
+
+void PublisherAvahi::RebuildGroup(const EntryGroupPtr &aGroup)
+{
+    otbrError error      = OTBR_ERROR_NONE;
+    int       avahiError = AVAHI_OK;
+    bool      isEmpty    = true;
+
+    otbrLogInfo("Rebuild avahi group @%p", aGroup.get());
+
+    avahiError = avahi_entry_group_reset(aGroup.get());
+    VerifyOrExit(avahiError == AVAHI_OK, error = OTBR_ERROR_MDNS);
+
+    for (const auto &kv : mServiceRegistrations)
+    {
+        const auto &serviceReg = static_cast<const AvahiServiceRegistration &>(*kv.second);
+
+        if (serviceReg.GetEntryGroup() == aGroup)
+        {
+            SuccessOrExit(error = AddServiceEntries(aGroup.get(), serviceReg.mHostName, serviceReg.mName,
+                                                    serviceReg.mType, serviceReg.mSubTypeList, serviceReg.mPort,
+                                                    serviceReg.mTxtList));
+            isEmpty = false;
+        }
+    }
+
+    for (const auto &kv : mHostRegistrations)
+    {
+        const auto &hostReg = static_cast<const AvahiHostRegistration &>(*kv.second);
+
+        if (hostReg.GetEntryGroup() == aGroup)
+        {
+            SuccessOrExit(error = AddHostEntries(aGroup.get(), hostReg.mName, hostReg.mAddresses));
+            isEmpty = false;
+        }
+    }
+
+    // The groups of the ongoing batch are committed at the end of the batch.
+    if (!isEmpty && !IsBatchGroup(aGroup))
+    {
+        avahiError = avahi_entry_group_commit(aGroup.get());
+        VerifyOrExit(avahiError == AVAHI_OK, error = OTBR_ERROR_MDNS);
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        if (avahiError != AVAHI_OK)
+        {
+            otbrLogErr("Failed to rebuild avahi group @%p: %s!", aGroup.get(), avahi_strerror(avahiError));
+        }
+
+        CallHostOrServiceCallback(aGroup.get(), error);
+    }
+}
+
 void PublisherAvahi::HandleClientState(AvahiClient *aClient, AvahiClientState aState)
 {
     otbrLogInfo("Avahi client state changed to %d", aState);
@@ -622,6 +851,8 @@ void PublisherAvahi::HandleClientState(AvahiClient *aClient, AvahiClientState aS
         // records to register until the host name is properly established.
         mServiceRegistrations.clear();
         mHostRegistrations.clear();
+        mBatchGroups.clear();
+        mStaleGroups.clear();
         break;
 
     case AVAHI_CLIENT_CONNECTING:
@@ -642,26 +873,15 @@ otbrError PublisherAvahi::PublishServiceImpl(const std::string &aHostName,
                                              const TxtList     &aTxtList,
                                              ResultCallback   &&aCallback)
 {
-    otbrError         error             = OTBR_ERROR_NONE;
-    int               avahiError        = AVAHI_OK;
-    SubTypeList       sortedSubTypeList = SortSubTypeList(aSubTypeList);
-    TxtList           sortedTxtList     = SortTxtList(aTxtList);
-    const std::string logHostName       = !aHostName.empty() ? aHostName : "localhost";
-    std::string       fullHostName;
-    std::string       serviceName = aName;
-    AvahiEntryGroup  *group       = nullptr;
-
-    // Aligned with AvahiStringList
-    AvahiStringList  txtBuffer[(kMaxSizeOfTxtRecord - 1) / sizeof(AvahiStringList) + 1];
-    AvahiStringList *txtHead = nullptr;
+    otbrError     error             = OTBR_ERROR_NONE;
+    SubTypeList   sortedSubTypeList = SortSubTypeList(aSubTypeList);
+    TxtList       sortedTxtList     = SortTxtList(aTxtList);
+    std::string   serviceName       = aName;
+    EntryGroupPtr group;
 
     VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
     VerifyOrExit(mClient != nullptr, error = OTBR_ERROR_INVALID_STATE);
 
-    if (!aHostName.empty())
-    {
-        fullHostName = MakeFullHostName(aHostName);
-    }
     if (serviceName.empty())
     {
         serviceName = avahi_client_get_host_name(mClient);
@@ -671,45 +891,36 @@ otbrError PublisherAvahi::PublishServiceImpl(const std::string &aHostName,
                                                    sortedTxtList, std::move(aCallback));
     VerifyOrExit(!aCallback.IsNull());
 
-    SuccessOrExit(error = TxtListToAvahiStringList(aTxtList, txtBuffer, sizeof(txtBuffer), txtHead));
-    VerifyOrExit((group = CreateGroup(mClient)) != nullptr, error = OTBR_ERROR_MDNS);
-    avahiError = avahi_entry_group_add_service_strlst(group, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, AvahiPublishFlags{},
-                                                      serviceName.c_str(), aType.c_str(),
-                                                      /* domain */ nullptr, fullHostName.c_str(), aPort, txtHead);
-    VerifyOrExit(avahiError == AVAHI_OK);
+    // Drop the records of an outdated registration before adding the new ones, they may share an entry group.
+    RebuildStaleGroups();
 
-    for (const std::string &subType : aSubTypeList)
+    group = GetGroup(aHostName, kServiceEntryCount + static_cast<uint32_t>(aSubTypeList.size()));
+    VerifyOrExit(group != nullptr, error = OTBR_ERROR_MDNS);
+
+    error = AddServiceEntries(group.get(), aHostName, serviceName, aType, aSubTypeList, aPort, aTxtList);
+    if (error != OTBR_ERROR_NONE && IsInBatch())
     {
-        otbrLogInfo("Add subtype %s for service %s.%s", subType.c_str(), serviceName.c_str(), aType.c_str());
-        std::string fullSubType = subType + "._sub." + aType;
-        avahiError              = avahi_entry_group_add_service_subtype(group, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC,
-                                                                        AvahiPublishFlags{}, serviceName.c_str(), aType.c_str(),
-                                                                        /* domain */ nullptr, fullSubType.c_str());
-        VerifyOrExit(avahiError == AVAHI_OK);
+        // The batched group may hold a part of the records of this service.
+        mStaleGroups.push_back(group);
     }
+    SuccessOrExit(error);
 
-    otbrLogInfo("Commit avahi service %s.%s", serviceName.c_str(), aType.c_str());
-    avahiError = avahi_entry_group_commit(group);
-    VerifyOrExit(avahiError == AVAHI_OK);
+    if (!IsInBatch())
+    {
+        otbrLogInfo("Commit avahi service %s.%s", serviceName.c_str(), aType.c_str());
+        SuccessOrExit(error = CommitGroup(group));
+    }
 
     AddServiceRegistration(std::unique_ptr<AvahiServiceRegistration>(new AvahiServiceRegistration(
         aHostName, serviceName, aType, sortedSubTypeList, aPort, sortedTxtList, std::move(aCallback), group, this)));
 
 exit:
-    if (avahiError != AVAHI_OK || error != OTBR_ERROR_NONE)
+    if (error != OTBR_ERROR_NONE)
     {
-        if (avahiError != AVAHI_OK)
-        {
-            error = OTBR_ERROR_MDNS;
-            otbrLogErr("Failed to publish service for avahi error: %s!", avahi_strerror(avahiError));
-        }
-
-        if (group != nullptr)
-        {
-            ReleaseGroup(group);
-        }
         std::move(aCallback)(error);
     }
+
+    RebuildStaleGroups();
     return error;
 }
 
@@ -719,6 +930,7 @@ void PublisherAvahi::UnpublishService(const std::string &aName, const std::strin
 
     VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
     RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
+    RebuildStaleGroups();
 
 exit:
     std::move(aCallback)(error);
@@ -728,10 +940,8 @@ otbrError PublisherAvahi::PublishHostImpl(const std::string             &aName,
                                           const std::vector<Ip6Address> &aAddresses,
                                           ResultCallback               &&aCallback)
 {
-    otbrError        error      = OTBR_ERROR_NONE;
-    int              avahiError = AVAHI_OK;
-    std::string      fullHostName;
-    AvahiEntryGroup *group = nullptr;
+    otbrError     error = OTBR_ERROR_NONE;
+    EntryGroupPtr group;
 
     VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
     VerifyOrExit(mClient != nullptr, error = OTBR_ERROR_INVALID_STATE);
@@ -740,42 +950,36 @@ otbrError PublisherAvahi::PublishHostImpl(const std::string             &aName,
     VerifyOrExit(!aCallback.IsNull());
     VerifyOrExit(!aAddresses.empty(), std::move(aCallback)(OTBR_ERROR_NONE));
 
-    VerifyOrExit((group = CreateGroup(mClient)) != nullptr, error = OTBR_ERROR_MDNS);
+    // Drop the records of an outdated registration before adding the new ones, they may share an entry group.
+    RebuildStaleGroups();
 
-    fullHostName = MakeFullHostName(aName);
-    for (const auto &address : aAddresses)
-    {
-        AvahiAddress avahiAddress;
+    group = GetGroup(aName, static_cast<uint32_t>(aAddresses.size()));
+    VerifyOrExit(group != nullptr, error = OTBR_ERROR_MDNS);
 
-        avahiAddress.proto = AVAHI_PROTO_INET6;
-        memcpy(avahiAddress.data.ipv6.address, address.m8, sizeof(address.m8));
-        avahiError = avahi_entry_group_add_address(group, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, AVAHI_PUBLISH_NO_REVERSE,
-                                                   fullHostName.c_str(), &avahiAddress);
-        VerifyOrExit(avahiError == AVAHI_OK);
+    error = AddHostEntries(group.get(), aName, aAddresses);
+    if (error != OTBR_ERROR_NONE && IsInBatch())
+    {
+        // The batched group may hold a part of the records of this host.
+        mStaleGroups.push_back(group);
     }
+    SuccessOrExit(error);
 
-    otbrLogInfo("Commit avahi host %s", aName.c_str());
-    avahiError = avahi_entry_group_commit(group);
-    VerifyOrExit(avahiError == AVAHI_OK);
+    if (!IsInBatch())
+    {
+        otbrLogInfo("Commit avahi host %s", aName.c_str());
+        SuccessOrExit(error = CommitGroup(group));
+    }
 
     AddHostRegistration(std::unique_ptr<AvahiHostRegistration>(
         new AvahiHostRegistration(aName, aAddresses, std::move(aCallback), group, this)));
 
 exit:
-    if (avahiError != AVAHI_OK || error != OTBR_ERROR_NONE)
+    if (error != OTBR_ERROR_NONE)
     {
-        if (avahiError != AVAHI_OK)
-        {
-            error = OTBR_ERROR_MDNS;
-            otbrLogErr("Failed to publish host for avahi error: %s!", avahi_strerror(avahiError));
-        }
-
-        if (group != nullptr)
-        {
-            ReleaseGroup(group);
-        }
         std::move(aCallback)(error);
     }
+
+    RebuildStaleGroups();
     return error;
 }
 
@@ -785,11 +989,84 @@ void PublisherAvahi::UnpublishHost(const std::string &aName, ResultCallback &&aC
 
     VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
     RemoveHostRegistration(aName, OTBR_ERROR_ABORTED);
+    RebuildStaleGroups();
 
 exit:
     std::move(aCallback)(error);
 }
 
+otbrError PublisherAvahi::AddServiceEntries(AvahiEntryGroup   *aGroup,
+                                            const std::string &aHostName,
+                                            const std::string &aName,
+                                            const std::string &aType,
+                                            const SubTypeList &aSubTypeList,
+                                            uint16_t           aPort,
+                                            const TxtList     &aTxtList)
+{
+    otbrError   error      = OTBR_ERROR_NONE;
+    int         avahiError = AVAHI_OK;
+    std::string fullHostName;
+
+    // Aligned with AvahiStringList
+    AvahiStringList  txtBuffer[(kMaxSizeOfTxtRecord - 1) / sizeof(AvahiStringList) + 1];
+    AvahiStringList *txtHead = nullptr;
+
+    if (!aHostName.empty())
+    {
+        fullHostName = MakeFullHostName(aHostName);
+    }
+
+    SuccessOrExit(error = TxtListToAvahiStringList(aTxtList, txtBuffer, sizeof(txtBuffer), txtHead));
+    avahiError = avahi_entry_group_add_service_strlst(aGroup, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, AvahiPublishFlags{},
+                                                      aName.c_str(), aType.c_str(),
+                                                      /* domain */ nullptr, fullHostName.c_str(), aPort, txtHead);
+    VerifyOrExit(avahiError == AVAHI_OK);
+
+    for (const std::string &subType : aSubTypeList)
+    {
+        otbrLogInfo("Add subtype %s for service %s.%s", subType.c_str(), aName.c_str(), aType.c_str());
+        std::string fullSubType = subType + "._sub." + aType;
+        avahiError              = avahi_entry_group_add_service_subtype(aGroup, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC,
+                                                                        AvahiPublishFlags{}, aName.c_str(), aType.c_str(),
+                                                                        /* domain */ nullptr, fullSubType.c_str());
+        VerifyOrExit(avahiError == AVAHI_OK);
+    }
+
+exit:
+    if (avahiError != AVAHI_OK)
+    {
+        error = OTBR_ERROR_MDNS;
+        otbrLogErr("Failed to publish service for avahi error: %s!", avahi_strerror(avahiError));
+    }
+    return error;
+}
+
+otbrError PublisherAvahi::AddHostEntries(AvahiEntryGroup *aGroup, const std::string &aName, const AddressList &aAddresses)
+{
+    otbrError   error        = OTBR_ERROR_NONE;
+    int         avahiError   = AVAHI_OK;
+    std::string fullHostName = MakeFullHostName(aName);
+
+    for (const auto &address : aAddresses)
+    {
+        AvahiAddress avahiAddress;
+
+        avahiAddress.proto = AVAHI_PROTO_INET6;
+        memcpy(avahiAddress.data.ipv6.address, address.m8, sizeof(address.m8));
+        avahiError = avahi_entry_group_add_address(aGroup, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, AVAHI_PUBLISH_NO_REVERSE,
+                                                   fullHostName.c_str(), &avahiAddress);
+        VerifyOrExit(avahiError == AVAHI_OK);
+    }
+
+exit:
+    if (avahiError != AVAHI_OK)
+    {
+        error = OTBR_ERROR_MDNS;
+        otbrLogErr("Failed to publish host for avahi error: %s!", avahi_strerror(avahiError));
+    }
+    return error;
+}
+
 otbrError PublisherAvahi::TxtListToAvahiStringList(const TxtList    &aTxtList,
                                                    AvahiStringList  *aBuffer,
                                                    size_t            aBufferSize,
@@ -829,40 +1106,6 @@ exit:
     return error;
 }
 
-Publisher::ServiceRegistration *PublisherAvahi::FindServiceRegistration(const AvahiEntryGroup *aEntryGroup)
-{
-    ServiceRegistration *result = nullptr;
-
-    for (const auto &kv : mServiceRegistrations)
-    {
-        const auto &serviceReg = static_cast<const AvahiServiceRegistration &>(*kv.second);
-        if (serviceReg.GetEntryGroup() == aEntryGroup)
-        {
-            result = kv.second.get();
-            break;
-        }
-    }
-
-    return result;
-}
-
-Publisher::HostRegistration *PublisherAvahi::FindHostRegistration(const AvahiEntryGroup *aEntryGroup)
-{
-    HostRegistration *result = nullptr;
-
-    for (const auto &kv : mHostRegistrations)
-    {
-        const auto &hostReg = static_cast<const AvahiHostRegistration &>(*kv.second);
-        if (hostReg.GetEntryGroup() == aEntryGroup)
-        {
-            result = kv.second.get();
-            break;
-        }
-    }
-
-    return result;
-}
-
 void PublisherAvahi::SubscribeService(const std::string &aType, const std::string &aInstanceName)
 {
     auto service = MakeUnique<ServiceSubscription>(*this, aType, aInstanceName);
@@ -34,6 +34,7 @@
 #ifndef OTBR_AGENT_MDNS_AVAHI_HPP_
 #define OTBR_AGENT_MDNS_AVAHI_HPP_
 
+#include <map>
 #include <memory>
 #include <set>
 #include <vector>
@@ -100,11 +101,21 @@ protected:
                                          int32_t            aErrorCode) override;
     void      OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode) override;
     otbrError DnsErrorToOtbrError(int32_t aErrorCode) override;
+    void      CommitBatch(void) override;
 
 private:
     static constexpr size_t   kMaxSizeOfTxtRecord = 1024;
     static constexpr uint32_t kDefaultTtl         = 10; // In seconds.
 
+    // The number of entries added to an entry group for a service, not counting its subtypes (one each).
+    static constexpr uint32_t kServiceEntryCount = 4;
+    // The maximum number of entries of a batched entry group (the default `entries-per-entry-group-max`
+    // of avahi-daemon).
+    static constexpr uint32_t kMaxBatchGroupEntries = 32;
+
+    // An entry group is shared by the registrations published in it and released along with the last one.
+    using EntryGroupPtr = std::shared_ptr<AvahiEntryGroup>;
+
     class AvahiServiceRegistration : public ServiceRegistration
     {
     public:
@@ -115,7 +126,7 @@ private:
                                  uint16_t           aPort,
                                  const TxtList     &aTxtList,
                                  ResultCallback   &&aCallback,
-                                 AvahiEntryGroup   *aEntryGroup,
+                                 EntryGroupPtr      aEntryGroup,
                                  PublisherAvahi    *aPublisher)
             : ServiceRegistration(aHostName,
                                   aName,
@@ -125,15 +136,15 @@ private:
                                   aTxtList,
                                   std::move(aCallback),
                                   aPublisher)
-            , mEntryGroup(aEntryGroup)
+            , mEntryGroup(std::move(aEntryGroup))
         {
         }
 
         ~AvahiServiceRegistration(void) override;
-        const AvahiEntryGroup *GetEntryGroup(void) const { return mEntryGroup; }
+        const EntryGroupPtr &GetEntryGroup(void) const { return mEntryGroup; }
 
     private:
-        AvahiEntryGroup *mEntryGroup;
+        EntryGroupPtr mEntryGroup;
     };
 
     class AvahiHostRegistration : public HostRegistration
@@ -142,18 +153,25 @@ private:
         AvahiHostRegistration(const std::string             &aName,
                               const std::vector<Ip6Address> &aAddresses,
                               ResultCallback               &&aCallback,
-                              AvahiEntryGroup               *aEntryGroup,
+                              EntryGroupPtr                  aEntryGroup,
                               PublisherAvahi                *aPublisher)
             : HostRegistration(aName, aAddresses, std::move(aCallback), aPublisher)
-            , mEntryGroup(aEntryGroup)
+            , mEntryGroup(std::move(aEntryGroup))
         {
         }
 
         ~AvahiHostRegistration(void) override;
-        const AvahiEntryGroup *GetEntryGroup(void) const { return mEntryGroup; }
+        const EntryGroupPtr &GetEntryGroup(void) const { return mEntryGroup; }
 
     private:
-        AvahiEntryGroup *mEntryGroup;
+        EntryGroupPtr mEntryGroup;
+    };
+
+    // The entry group of a host in the ongoing batch, with the number of entries added to it.
+    struct BatchGroup
+    {
+        EntryGroupPtr mGroup;
+        uint32_t      mEntryCount = 0;
     };
 
     struct Subscription : private ::NonCopyable
@@ -286,8 +304,23 @@ private:
     static void HandleClientState(AvahiClient *aClient, AvahiClientState aState, void *aContext);
     void        HandleClientState(AvahiClient *aClient, AvahiClientState aState);
 
-    AvahiEntryGroup *CreateGroup(AvahiClient *aClient);
-    static void      ReleaseGroup(AvahiEntryGroup *aGroup);
+    EntryGroupPtr CreateGroup(AvahiClient *aClient);
+    EntryGroupPtr GetGroup(const std::string &aHostName, uint32_t aEntryCount);
+    static void   ReleaseGroup(AvahiEntryGroup *aGroup);
+    otbrError     CommitGroup(const EntryGroupPtr &aGroup);
+    bool          IsBatchGroup(const EntryGroupPtr &aGroup) const;
+    void          OnRegistrationReleased(const EntryGroupPtr &aGroup);
+    void          RebuildStaleGroups(void);
+    void          RebuildGroup(const EntryGroupPtr &aGroup);
+
+    otbrError AddServiceEntries(AvahiEntryGroup   *aGroup,
+                                const std::string &aHostName,
+                                const std::string &aName,
+                                const std::string &aType,
+                                const SubTypeList &aSubTypeList,
+                                uint16_t           aPort,
+                                const TxtList     &aTxtList);
+    otbrError AddHostEntries(AvahiEntryGroup *aGroup, const std::string &aName, const AddressList &aAddresses);
 
     static void HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupState aState, void *aContext);
     void        HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupState aState);
@@ -298,9 +331,6 @@ private:
                                               size_t            aBufferSize,
                                               AvahiStringList *&aHead);
 
-    ServiceRegistration *FindServiceRegistration(const AvahiEntryGroup *aEntryGroup);
-    HostRegistration    *FindHostRegistration(const AvahiEntryGroup *aEntryGroup);
-
     AvahiClient                 *mClient;
     std::unique_ptr<AvahiPoller> mPoller;
     State                        mState;
@@ -308,6 +338,11 @@ private:
 
     ServiceSubscriptionList mSubscribedServices;
     HostSubscriptionList    mSubscribedHosts;
+
+    // The entry groups of the ongoing batch, keyed by host name.
+    std::map<std::string, BatchGroup> mBatchGroups;
+    // The entry groups which still hold the records of released registrations.
+    std::vector<std::weak_ptr<AvahiEntryGroup>> mStaleGroups;
 };
 
 } // namespace Mdns
@@ -0,0 +1,344 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the MUD file cache.
+ */
+
+#define OTBR_LOG_TAG "MudManager"
+
+#include "mud_manager/mud_cache.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include <dirent.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include <mbedtls/sha256.h>
+
+#include "common/logging.hpp"
+#include "utils/hex.hpp"
+
+namespace otbr {
+namespace MUD {
+
+static const char kContentSuffix[] = ".json";
+static const char kMetaSuffix[]    = ".meta";
+
+static bool CreateDirectory(const std::string &aPath)
+{
+    size_t pos = 0;
+
+    while ((pos = aPath.find('/', pos + 1)) != std::string::npos)
+    {
+        if (mkdir(aPath.substr(0, pos).c_str(), 0755) != 0 && errno != EEXIST)
+        {
+            return false;
+        }
+    }
+
+    return mkdir(aPath.c_str(), 0755) == 0 || errno == EEXIST;
+}
+
+static bool HasSuffix(const std::string &aString, const std::string &aSuffix)
+{
+    return aString.size() >= aSuffix.size() &&
+           aString.compare(aString.size() - aSuffix.size(), aSuffix.size(), aSuffix) == 0;
+}
+
+static bool WriteFile(const std::string &aPath, const std::string &aContent)
+{
+    std::string   tmpPath = aPath + ".tmp";
+    std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+
+    file << aContent;
+    file.close();
+
+    return !file.fail() && rename(tmpPath.c_str(), aPath.c_str()) == 0;
+}
+
+constexpr uint32_t MudCache::kDefaultValidity;
+constexpr uint32_t MudCache::kMaxValidity;
+
+MudCache::MudCache(const std::string &aDirectory)
+    : mDirectory(aDirectory)
+{
+}
+
+void MudCache::Load(void)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    DIR                        *dir;
+    struct dirent              *dirEntry;
+
+    if (!CreateDirectory(mDirectory))
+    {
+        otbrLogWarning("Failed to create MUD cache directory %s: %s", mDirectory.c_str(), strerror(errno));
+        ExitNow();
+    }
+
+    dir = opendir(mDirectory.c_str());
+    VerifyOrExit(dir != nullptr);
+
+    while ((dirEntry = readdir(dir)) != nullptr)
+    {
+        Entry       entry;
+        std::string name = dirEntry->d_name;
+
+        if (!HasSuffix(name, kMetaSuffix))
+        {
+            continue;
+        }
+
+        if (LoadEntry(mDirectory + "/" + name, entry))
+        {
+            mEntries[entry.mUrl] = std::move(entry);
+        }
+    }
+
+    closedir(dir);
+
+    otbrLogInfo("Loaded %zu cached MUD files from %s", mEntries.size(), mDirectory.c_str());
+
+exit:
+    return;
+}
+
+bool MudCache::LoadEntry(const std::string &aMetaPath, Entry &aEntry) const
+{
+    std::ifstream     metaFile(aMetaPath);
+    std::ifstream     contentFile;
+    std::stringstream content;
+    std::string       line;
+    bool              loaded = false;
+
+    aEntry              = Entry();
+    aEntry.mValidity    = kDefaultValidity;
+    aEntry.mFetchedTime = 0;
+
+    while (std::getline(metaFile, line))
+    {
+        size_t      separator = line.find('=');
+        std::string key;
+        std::string value;
+
+        if (separator == std::string::npos)
+        {
+            continue;
+        }
+
+        key   = line.substr(0, separator);
+        value = line.substr(separator + 1);
+
+        if (key == "url")
+        {
+            aEntry.mUrl = value;
+        }
+        else if (key == "content-hash")
+        {
+            aEntry.mContentHash = value;
+        }
+        else if (key == "etag")
+        {
+            aEntry.mEtag = value;
+        }
+        else if (key == "last-modified")
+        {
+            aEntry.mLastModified = value;
+        }
+        else if (key == "last-update")
+        {
+            aEntry.mLastUpdate = value;
+        }
+        else if (key == "fetched")
+        {
+            aEntry.mFetchedTime = static_cast<time_t>(strtoll(value.c_str(), nullptr, 10));
+        }
+        else if (key == "validity")
+        {
+            aEntry.mValidity = static_cast<uint32_t>(strtoul(value.c_str(), nullptr, 10));
+        }
+    }
+
+    VerifyOrExit(!aEntry.mUrl.empty());
+
+    contentFile.open(GetPath(aEntry.mUrl, kContentSuffix), std::ios::binary);
+    content << contentFile.rdbuf();
+    aEntry.mContent = content.str();
+
+    // Drop entries whose content does not match the recorded hash, e.g. after an interrupted write.
+    VerifyOrExit(ComputeHash(aEntry.mContent) == aEntry.mContentHash);
+
+    loaded = true;
+
+exit:
+    if (!loaded)
+    {
+        otbrLogWarning("Ignoring invalid cached MUD file %s", aMetaPath.c_str());
+    }
+
+    return loaded;
+}
+
+bool MudCache::Lookup(const std::string &aUrl, Entry &aEntry) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto                        it    = mEntries.find(aUrl);
+    bool                        found = (it != mEntries.end());
+
+    if (found)
+    {
+        aEntry = it->second;
+    }
+
+    return found;
+}
+
+bool MudCache::IsFresh(const Entry &aEntry)
+{
+    time_t now = time(nullptr);
+
+    return now >= aEntry.mFetchedTime &&
+           now - aEntry.mFetchedTime < static_cast<time_t>(aEntry.mValidity) * 3600;
+}
+
+void MudCache::Store(const std::string &aUrl,
+                     const std::string &aContent,
+                     const std::string &aEtag,
+                     const std::string &aLastModified,
+                     Entry             &aEntry)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    Entry                      &entry = mEntries[aUrl];
+    std::string                 hash  = ComputeHash(aContent);
+
+    if (entry.mContentHash != hash)
+    {
+        // The validity and last update of the previous content do not apply to the new content.
+        entry.mValidity   = kDefaultValidity;
+        entry.mLastUpdate = "";
+    }
+
+    entry.mUrl          = aUrl;
+    entry.mContent      = aContent;
+    entry.mContentHash  = hash;
+    entry.mEtag         = aEtag;
+    entry.mLastModified = aLastModified;
+    entry.mFetchedTime  = time(nullptr);
+
+    Save(entry);
+    aEntry = entry;
+}
+
+bool MudCache::Revalidate(const std::string &aUrl, Entry &aEntry)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto                        it    = mEntries.find(aUrl);
+    bool                        found = (it != mEntries.end());
+
+    VerifyOrExit(found);
+
+    it->second.mFetchedTime = time(nullptr);
+    Save(it->second);
+    aEntry = it->second;
+
+exit:
+    return found;
+}
+
+void MudCache::SetFileInfo(const std::string &aUrl,
+                           const std::string &aContentHash,
+                           uint32_t           aValidity,
+                           const std::string &aLastUpdate)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto                        it = mEntries.find(aUrl);
+
+    VerifyOrExit(it != mEntries.end() && it->second.mContentHash == aContentHash);
+
+    if (aValidity == 0)
+    {
+        aValidity = kDefaultValidity;
+    }
+
+    aValidity = std::min(aValidity, kMaxValidity);
+
+    VerifyOrExit(it->second.mValidity != aValidity || it->second.mLastUpdate != aLastUpdate);
+
+    it->second.mValidity   = aValidity;
+    it->second.mLastUpdate = aLastUpdate;
+    Save(it->second);
+
+exit:
+    return;
+}
+
+std::string MudCache::ComputeHash(const std::string &aData)
+{
+    uint8_t hash[32];
+    char    hex[sizeof(hash) * 2 + 1];
+
+    mbedtls_sha256(reinterpret_cast<const uint8_t *>(aData.data()), aData.size(), hash, /* is224 */ 0);
+    Utils::Bytes2Hex(hash, sizeof(hash), hex);
+
+    return hex;
+}
+
+std::string MudCache::GetPath(const std::string &aUrl, const char *aSuffix) const
+{
+    return mDirectory + "/" + ComputeHash(aUrl) + aSuffix;
+}
+
+void MudCache::Save(const Entry &aEntry) const
+{
+    std::ostringstream meta;
+
+    meta << "url=" << aEntry.mUrl << std::endl;
+    meta << "content-hash=" << aEntry.mContentHash << std::endl;
+    meta << "etag=" << aEntry.mEtag << std::endl;
+    meta << "last-modified=" << aEntry.mLastModified << std::endl;
+    meta << "last-update=" << aEntry.mLastUpdate << std::endl;
+    meta << "fetched=" << static_cast<long long>(aEntry.mFetchedTime) << std::endl;
+    meta << "validity=" << aEntry.mValidity << std::endl;
+
+    // The content is written first so that a persisted meta file always refers to a complete content file.
+    if (!WriteFile(GetPath(aEntry.mUrl, kContentSuffix), aEntry.mContent) ||
+        !WriteFile(GetPath(aEntry.mUrl, kMetaSuffix), meta.str()))
+    {
+        otbrLogWarning("Failed to persist cached MUD file %s", aEntry.mUrl.c_str());
+    }
+}
+
+} // namespace MUD
+} // namespace otbr
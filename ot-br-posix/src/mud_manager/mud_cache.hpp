@@ -0,0 +1,182 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the MUD file cache.
+ */
+
+#ifndef OTBR_MUD_CACHE_HPP_
+#define OTBR_MUD_CACHE_HPP_
+
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <stdint.h>
+#include <time.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace MUD {
+
+/**
+ * This class implements an in-memory and on-disk cache of MUD files.
+ *
+ * Entries are keyed by MUD URL and carry the SHA-256 hash of their content, so that devices sharing a MUD URL
+ * cost one download per validity period. An entry is fresh for the `cache-validity` of the MUD file (48 hours if
+ * the file does not tell), after which it is revalidated with the ETag and Last-Modified returned by the server.
+ *
+ * All methods are thread-safe.
+ *
+ */
+class MudCache : private NonCopyable
+{
+public:
+    /**
+     * This structure represents a cached MUD file.
+     *
+     */
+    struct Entry
+    {
+        std::string mUrl;          ///< The MUD URL.
+        std::string mContent;      ///< The content of the MUD file.
+        std::string mContentHash;  ///< The hex SHA-256 hash of the content.
+        std::string mEtag;         ///< The ETag returned by the server.
+        std::string mLastModified; ///< The Last-Modified date returned by the server.
+        std::string mLastUpdate;   ///< The `last-update` of the MUD file.
+        time_t      mFetchedTime;  ///< The time the content was last downloaded or revalidated.
+        uint32_t    mValidity;     ///< The `cache-validity` of the MUD file (in hours).
+    };
+
+    static constexpr uint32_t kDefaultValidity = 48;  ///< Default `cache-validity` (in hours), RFC 8520.
+    static constexpr uint32_t kMaxValidity     = 168; ///< Maximum `cache-validity` (in hours), RFC 8520.
+
+    /**
+     * This constructor initializes the cache.
+     *
+     * @param[in] aDirectory  The directory the cached files are persisted in.
+     *
+     */
+    explicit MudCache(const std::string &aDirectory);
+
+    /**
+     * This method loads the cached files persisted by a previous run.
+     *
+     */
+    void Load(void);
+
+    /**
+     * This method looks up the cached MUD file of a URL.
+     *
+     * @param[in]  aUrl    The MUD URL.
+     * @param[out] aEntry  The cached entry.
+     *
+     * @retval TRUE   The URL is cached, @p aEntry is set.
+     * @retval FALSE  The URL is not cached.
+     *
+     */
+    bool Lookup(const std::string &aUrl, Entry &aEntry) const;
+
+    /**
+     * This method indicates whether a cached entry can be used without revalidating it.
+     *
+     * @param[in] aEntry  The cached entry.
+     *
+     * @returns Whether the entry is still within its validity period.
+     *
+     */
+    static bool IsFresh(const Entry &aEntry);
+
+    /**
+     * This method stores a newly downloaded MUD file.
+     *
+     * @param[in]  aUrl           The MUD URL.
+     * @param[in]  aContent       The content of the MUD file.
+     * @param[in]  aEtag          The ETag returned by the server.
+     * @param[in]  aLastModified  The Last-Modified date returned by the server.
+     * @param[out] aEntry         The new cached entry.
+     *
+     */
+    void Store(const std::string &aUrl,
+               const std::string &aContent,
+               const std::string &aEtag,
+               const std::string &aLastModified,
+               Entry             &aEntry);
+
+    /**
+     * This method marks a cached MUD file as revalidated by the server.
+     *
+     * @param[in]  aUrl    The MUD URL.
+     * @param[out] aEntry  The revalidated entry.
+     *
+     * @retval TRUE   The URL is cached and was revalidated.
+     * @retval FALSE  The URL is not cached.
+     *
+     */
+    bool Revalidate(const std::string &aUrl, Entry &aEntry);
+
+    /**
+     * This method records the `cache-validity` and `last-update` of a parsed MUD file.
+     *
+     * @param[in] aUrl          The MUD URL.
+     * @param[in] aContentHash  The hash of the parsed content, used to ignore outdated reports.
+     * @param[in] aValidity     The `cache-validity` of the MUD file (in hours).
+     * @param[in] aLastUpdate   The `last-update` of the MUD file.
+     *
+     */
+    void SetFileInfo(const std::string &aUrl,
+                     const std::string &aContentHash,
+                     uint32_t           aValidity,
+                     const std::string &aLastUpdate);
+
+    /**
+     * This method computes the hex SHA-256 hash of a string.
+     *
+     * @param[in] aData  The data to hash.
+     *
+     * @returns The hex hash of @p aData.
+     *
+     */
+    static std::string ComputeHash(const std::string &aData);
+
+private:
+    std::string GetPath(const std::string &aUrl, const char *aSuffix) const;
+    void        Save(const Entry &aEntry) const;
+    bool        LoadEntry(const std::string &aMetaPath, Entry &aEntry) const;
+
+    std::string                  mDirectory;
+    std::map<std::string, Entry> mEntries;
+    mutable std::mutex           mMutex;
+};
+
+} // namespace MUD
+} // namespace otbr
+
+#endif // OTBR_MUD_CACHE_HPP_
@@ -0,0 +1,301 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the MUD file fetcher.
+ */
+
+#define OTBR_LOG_TAG "MudManager"
+
+#include "mud_manager/mud_fetcher.hpp"
+
+#include <algorithm>
+
+#include <curl_exception.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/time.hpp"
+#include "utils/string_utils.hpp"
+
+namespace otbr {
+namespace MUD {
+
+// The timeout to use when curl has transfers running but no socket to wait on.
+static constexpr long kNoSocketTimeoutMs = 100;
+
+MudFetcher::MudFetcher(bool aRequireHttps, size_t aMaxTransfers)
+    : mRequireHttps(aRequireHttps)
+    , mMaxTransfers(std::max<size_t>(aMaxTransfers, 1))
+{
+    mMulti.add<CURLMOPT_MAX_TOTAL_CONNECTIONS>(static_cast<long>(mMaxTransfers));
+    mMulti.add<CURLMOPT_MAX_HOST_CONNECTIONS>(OTBR_MUD_FETCH_MAX_HOST_CONNECTIONS);
+    mMulti.add<CURLMOPT_MAXCONNECTS>(static_cast<long>(mMaxTransfers));
+}
+
+void MudFetcher::Fetch(const std::string &aUrl,
+                       const std::string &aEtag,
+                       const std::string &aLastModified,
+                       FetchHandler       aHandler)
+{
+    std::unique_ptr<Transfer> transfer(new Transfer());
+
+    transfer->mUrl     = aUrl;
+    transfer->mHandler = std::move(aHandler);
+
+    if (!aEtag.empty())
+    {
+        transfer->mHeaders = curl_slist_append(transfer->mHeaders, ("If-None-Match: " + aEtag).c_str());
+    }
+
+    if (!aLastModified.empty())
+    {
+        transfer->mHeaders = curl_slist_append(transfer->mHeaders, ("If-Modified-Since: " + aLastModified).c_str());
+    }
+
+    if (mTransfers.size() < mMaxTransfers)
+    {
+        Start(std::move(transfer));
+    }
+    else
+    {
+        otbrLogInfo("Queueing download of %s, %zu transfers running", aUrl.c_str(), mTransfers.size());
+        mQueuedTransfers.push_back(std::move(transfer));
+    }
+}
+
+void MudFetcher::Clear(void)
+{
+    for (auto &transfer : mTransfers)
+    {
+        mMulti.remove(transfer.second->mEasy);
+    }
+
+    mTransfers.clear();
+    mQueuedTransfers.clear();
+}
+
+void MudFetcher::Start(std::unique_ptr<Transfer> aTransfer)
+{
+    curl::curl_easy &easy = aTransfer->mEasy;
+    std::string      url  = aTransfer->mUrl;
+    long             protocols;
+
+    otbrLogInfo("Starting download of: %s", url.c_str());
+
+    // Neither the URL nor a redirect may switch to another scheme, e.g. file://.
+    protocols = mRequireHttps ? CURLPROTO_HTTPS : (CURLPROTO_HTTP | CURLPROTO_HTTPS);
+
+    try
+    {
+        easy.add<CURLOPT_URL>(aTransfer->mUrl.c_str());
+        easy.add<CURLOPT_PROTOCOLS>(protocols);
+        easy.add<CURLOPT_REDIR_PROTOCOLS>(protocols);
+        easy.add<CURLOPT_FOLLOWLOCATION>(1L);
+        easy.add<CURLOPT_MAXREDIRS>(static_cast<long>(OTBR_MUD_FETCH_MAX_REDIRECTS));
+        easy.add<CURLOPT_MAXFILESIZE>(static_cast<long>(OTBR_MUD_FETCH_MAX_FILE_SIZE));
+        easy.add<CURLOPT_NOSIGNAL>(1L);
+        easy.add<CURLOPT_CONNECTTIMEOUT>(OTBR_MUD_FETCH_CONNECT_TIMEOUT);
+        easy.add<CURLOPT_TIMEOUT>(OTBR_MUD_FETCH_TIMEOUT);
+        easy.add<CURLOPT_WRITEFUNCTION>(HandleWrite);
+        easy.add<CURLOPT_WRITEDATA>(&aTransfer->mResult.mContent);
+        easy.add<CURLOPT_HEADERFUNCTION>(HandleHeader);
+        easy.add<CURLOPT_HEADERDATA>(&aTransfer->mResult);
+        easy.add<CURLOPT_HTTPHEADER>(aTransfer->mHeaders);
+
+        mMulti.add(easy);
+        mTransfers[easy.get_curl()] = std::move(aTransfer);
+    } catch (curl::curl_exception &error)
+    {
+        otbrLogErr("Failed to start download of %s: %s", url.c_str(), error.what());
+        aTransfer->mResult = FetchResult();
+        aTransfer->mHandler(aTransfer->mResult);
+    }
+}
+
+void MudFetcher::StartQueuedTransfers(void)
+{
+    while (!mQueuedTransfers.empty() && mTransfers.size() < mMaxTransfers)
+    {
+        std::unique_ptr<Transfer> transfer = std::move(mQueuedTransfers.front());
+
+        mQueuedTransfers.pop_front();
+        Start(std::move(transfer));
+    }
+}
+
+void MudFetcher::Update(MainloopContext &aMainloop)
+{
+    int  maxFd     = -1;
+    long timeoutMs = -1;
+
+    VerifyOrExit(!mTransfers.empty());
+
+    mMulti.set_descriptors(&aMainloop.mReadFdSet, &aMainloop.mWriteFdSet, &aMainloop.mErrorFdSet, &maxFd);
+    mMulti.timeout(&timeoutMs);
+
+    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, maxFd);
+
+    if (maxFd == -1 && (timeoutMs < 0 || timeoutMs > kNoSocketTimeoutMs))
+    {
+        timeoutMs = kNoSocketTimeoutMs;
+    }
+
+    if (timeoutMs >= 0 && Milliseconds(timeoutMs) < FromTimeval<Milliseconds>(aMainloop.mTimeout))
+    {
+        aMainloop.mTimeout = ToTimeval(Milliseconds(timeoutMs));
+    }
+
+exit:
+    return;
+}
+
+void MudFetcher::Process(void)
+{
+    std::unique_ptr<curl::curl_multi::curl_message> message;
+
+    VerifyOrExit(!mTransfers.empty());
+
+    try
+    {
+        mMulti.perform();
+    } catch (curl::curl_exception &error)
+    {
+        otbrLogErr("Failed to perform MUD file transfers: %s", error.what());
+    }
+
+    while ((message = mMulti.get_next_finished()) != nullptr)
+    {
+        Complete(message->get_handler()->get_curl(), message->get_code());
+    }
+
+    StartQueuedTransfers();
+
+exit:
+    return;
+}
+
+void MudFetcher::Complete(CURL *aEasy, CURLcode aCode)
+{
+    auto                      it = mTransfers.find(aEasy);
+    std::unique_ptr<Transfer> transfer;
+    FetchResult              *result;
+
+    VerifyOrExit(it != mTransfers.end());
+
+    transfer = std::move(it->second);
+    result   = &transfer->mResult;
+    mTransfers.erase(it);
+    mMulti.remove(transfer->mEasy);
+
+    if (aCode != CURLE_OK)
+    {
+        otbrLogErr("Download of %s failed: %s", transfer->mUrl.c_str(), curl_easy_strerror(aCode));
+        *result = FetchResult();
+        ExitNow();
+    }
+
+    result->mStatus = transfer->mEasy.get_info<CURLINFO_RESPONSE_CODE>().get();
+
+    switch (result->mStatus)
+    {
+    case 200:
+        otbrLogInfo("Download of %s succeeded, %zu bytes", transfer->mUrl.c_str(), result->mContent.size());
+        break;
+    case 304:
+        otbrLogInfo("Cached copy of %s is still valid", transfer->mUrl.c_str());
+        result->mContent.clear();
+        break;
+    default:
+        otbrLogErr("Download of %s failed: HTTP status %ld", transfer->mUrl.c_str(), result->mStatus);
+        *result = FetchResult();
+        break;
+    }
+
+exit:
+    if (transfer != nullptr)
+    {
+        transfer->mHandler(*result);
+    }
+}
+
+size_t MudFetcher::HandleWrite(void *aData, size_t aSize, size_t aCount, void *aContext)
+{
+    std::string *content = static_cast<std::string *>(aContext);
+    size_t       length  = aSize * aCount;
+
+    // The Content-Length checked by CURLOPT_MAXFILESIZE may be missing, e.g. with chunked encoding. Returning a
+    // short count makes curl abort the transfer.
+    VerifyOrExit(content->size() + length <= OTBR_MUD_FETCH_MAX_FILE_SIZE, length = 0);
+    content->append(static_cast<const char *>(aData), length);
+
+exit:
+    return length;
+}
+
+size_t MudFetcher::HandleHeader(void *aData, size_t aSize, size_t aCount, void *aContext)
+{
+    FetchResult *result = static_cast<FetchResult *>(aContext);
+    size_t       length = aSize * aCount;
+    std::string  header(static_cast<const char *>(aData), length);
+    std::string  name;
+    std::string  value;
+    size_t       colon;
+
+    // A new status line starts the headers of a new response, e.g. after a redirect.
+    if (header.compare(0, 5, "HTTP/") == 0)
+    {
+        result->mEtag.clear();
+        result->mLastModified.clear();
+        ExitNow();
+    }
+
+    colon = header.find(':');
+    VerifyOrExit(colon != std::string::npos);
+
+    name  = StringUtils::ToLowercase(header.substr(0, colon));
+    value = header.substr(colon + 1);
+    value.erase(0, value.find_first_not_of(" \t"));
+    value.erase(value.find_last_not_of(" \t\r\n") + 1);
+
+    if (name == "etag")
+    {
+        result->mEtag = value;
+    }
+    else if (name == "last-modified")
+    {
+        result->mLastModified = value;
+    }
+
+exit:
+    return length;
+}
+
+} // namespace MUD
+} // namespace otbr
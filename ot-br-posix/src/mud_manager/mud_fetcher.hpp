@@ -0,0 +1,219 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the MUD file fetcher.
+ */
+
+#ifndef OTBR_MUD_FETCHER_HPP_
+#define OTBR_MUD_FETCHER_HPP_
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <curl_easy.h>
+#include <curl_multi.h>
+
+#include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+
+/**
+ * Maximum number of MUD file transfers running at the same time.
+ *
+ */
+#ifndef OTBR_MUD_FETCH_MAX_TRANSFERS
+#define OTBR_MUD_FETCH_MAX_TRANSFERS 8
+#endif
+
+/**
+ * Maximum number of connections kept open to a single MUD host.
+ *
+ */
+#ifndef OTBR_MUD_FETCH_MAX_HOST_CONNECTIONS
+#define OTBR_MUD_FETCH_MAX_HOST_CONNECTIONS 2
+#endif
+
+/**
+ * Connect timeout of a MUD file transfer (in seconds).
+ *
+ */
+#ifndef OTBR_MUD_FETCH_CONNECT_TIMEOUT
+#define OTBR_MUD_FETCH_CONNECT_TIMEOUT 10
+#endif
+
+/**
+ * Overall timeout of a MUD file transfer (in seconds).
+ *
+ */
+#ifndef OTBR_MUD_FETCH_TIMEOUT
+#define OTBR_MUD_FETCH_TIMEOUT 30
+#endif
+
+/**
+ * Maximum size of a MUD file (in bytes), larger transfers are aborted.
+ *
+ */
+#ifndef OTBR_MUD_FETCH_MAX_FILE_SIZE
+#define OTBR_MUD_FETCH_MAX_FILE_SIZE (128 * 1024)
+#endif
+
+/**
+ * Maximum number of redirects followed by a MUD file transfer.
+ *
+ */
+#ifndef OTBR_MUD_FETCH_MAX_REDIRECTS
+#define OTBR_MUD_FETCH_MAX_REDIRECTS 3
+#endif
+
+namespace otbr {
+namespace MUD {
+
+/**
+ * This class implements a non-blocking fetcher of MUD files.
+ *
+ * Transfers are driven by a curl multi handle on the mainloop, so a slow or unreachable MUD server only delays
+ * the devices using it. Connections are kept in the multi handle and reused for further transfers to the same host.
+ *
+ */
+class MudFetcher : private NonCopyable
+{
+public:
+    /**
+     * This structure represents the result of a transfer.
+     *
+     */
+    struct FetchResult
+    {
+        long        mStatus;       ///< The HTTP status code, zero if the transfer failed.
+        std::string mContent;      ///< The content of the file.
+        std::string mEtag;         ///< The value of the ETag header.
+        std::string mLastModified; ///< The value of the Last-Modified header.
+    };
+
+    /**
+     * This type represents the handler called when a transfer completes.
+     *
+     * @param[in] aResult  The result of the transfer.
+     *
+     */
+    using FetchHandler = std::function<void(FetchResult &aResult)>;
+
+    /**
+     * This constructor initializes the fetcher.
+     *
+     * @param[in] aRequireHttps  Whether transfers and their redirects are restricted to HTTPS.
+     * @param[in] aMaxTransfers  Maximum number of transfers running at the same time.
+     *
+     */
+    explicit MudFetcher(bool aRequireHttps = true, size_t aMaxTransfers = OTBR_MUD_FETCH_MAX_TRANSFERS);
+
+    /**
+     * This method starts or queues the download of a file.
+     *
+     * When @p aEtag or @p aLastModified is not empty, the request is made conditional and the server may answer
+     * with HTTP status 304 without any content.
+     *
+     * @param[in] aUrl           The URL of the file.
+     * @param[in] aEtag          The ETag of the cached file, or empty.
+     * @param[in] aLastModified  The Last-Modified date of the cached file, or empty.
+     * @param[in] aHandler       The handler called on the mainloop when the transfer completes.
+     *
+     */
+    void Fetch(const std::string &aUrl,
+               const std::string &aEtag,
+               const std::string &aLastModified,
+               FetchHandler       aHandler);
+
+    /**
+     * This method aborts all running and queued transfers without calling their handlers.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method returns the number of transfers which are running or queued.
+     *
+     * @returns The number of pending transfers.
+     *
+     */
+    size_t GetPendingCount(void) const { return mTransfers.size() + mQueuedTransfers.size(); }
+
+    /**
+     * This method updates the mainloop context with the sockets of the running transfers.
+     *
+     * @param[in,out] aMainloop  A reference to the mainloop to be updated.
+     *
+     */
+    void Update(MainloopContext &aMainloop);
+
+    /**
+     * This method performs the running transfers and reports the completed ones.
+     *
+     */
+    void Process(void);
+
+private:
+    struct Transfer
+    {
+        Transfer(void)
+            : mResult()
+            , mHeaders(nullptr)
+        {
+        }
+
+        ~Transfer(void) { curl_slist_free_all(mHeaders); }
+
+        std::string        mUrl;
+        FetchResult        mResult;
+        FetchHandler       mHandler;
+        struct curl_slist *mHeaders;
+        curl::curl_easy    mEasy;
+    };
+
+    static size_t HandleWrite(void *aData, size_t aSize, size_t aCount, void *aContext);
+    static size_t HandleHeader(void *aData, size_t aSize, size_t aCount, void *aContext);
+
+    void StartQueuedTransfers(void);
+    void Start(std::unique_ptr<Transfer> aTransfer);
+    void Complete(CURL *aEasy, CURLcode aCode);
+
+    bool                                        mRequireHttps;
+    size_t                                      mMaxTransfers;
+    curl::curl_multi                            mMulti;
+    std::map<CURL *, std::unique_ptr<Transfer>> mTransfers;
+    std::deque<std::unique_ptr<Transfer>>       mQueuedTransfers;
+};
+
+} // namespace MUD
+} // namespace otbr
+
+#endif // OTBR_MUD_FETCHER_HPP_
@@ -0,0 +1,143 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the common part of the MUD firewall.
+ */
+
+#define OTBR_LOG_TAG "MudManager"
+
+#include "mud_manager/mud_firewall.hpp"
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace MUD {
+
+void TrafficCounters::Accumulate(const TrafficCounters &aReading, TrafficCounters &aLastReading)
+{
+    if (aReading.mPackets < aLastReading.mPackets || aReading.mBytes < aLastReading.mBytes)
+    {
+        aLastReading = TrafficCounters();
+    }
+
+    mPackets += aReading.mPackets - aLastReading.mPackets;
+    mBytes += aReading.mBytes - aLastReading.mBytes;
+    aLastReading = aReading;
+}
+
+std::set<std::string> Policy::GetDnsNames(void) const
+{
+    std::set<std::string> names;
+
+    for (const PolicyRule &rule : mRules)
+    {
+        if (!rule.mSrcDnsName.empty())
+        {
+            names.insert(rule.mSrcDnsName);
+        }
+
+        if (!rule.mDstDnsName.empty())
+        {
+            names.insert(rule.mDstDnsName);
+        }
+    }
+
+    return names;
+}
+
+Firewall::Firewall(const std::string &aDirectory)
+    : mDirectory(aDirectory)
+{
+}
+
+bool Firewall::PrepareDirectory(void) const
+{
+    bool ret = (mkdir(mDirectory.c_str(), 0755) == 0 || errno == EEXIST);
+
+    if (!ret)
+    {
+        otbrLogErr("Unable to create directory %s: %s", mDirectory.c_str(), strerror(errno));
+    }
+
+    return ret;
+}
+
+std::string Firewall::GetDnsSetName(const std::string &aName)
+{
+    // FNV-1a keeps set names short enough for ipset and nftables.
+    uint64_t hash = 14695981039346656037ULL;
+    char     name[sizeof("mud_dns_") + 16];
+
+    for (char c : aName)
+    {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 1099511628211ULL;
+    }
+
+    snprintf(name, sizeof(name), "mud_dns_%016llx", static_cast<unsigned long long>(hash));
+
+    return name;
+}
+
+bool Firewall::ReadCommandOutput(const std::string &aCommand, std::string &aOutput)
+{
+    FILE *pipe = popen(aCommand.c_str(), "r");
+    char  buffer[1024];
+    bool  ret = false;
+    int   status;
+
+    VerifyOrExit(pipe != nullptr, otbrLogErr("Failed to run %s: %s", aCommand.c_str(), strerror(errno)));
+
+    aOutput.clear();
+
+    while (size_t length = fread(buffer, 1, sizeof(buffer), pipe))
+    {
+        aOutput.append(buffer, length);
+    }
+
+    status = pclose(pipe);
+    VerifyOrExit(status == 0, otbrLogWarning("Command %s exited with status %d", aCommand.c_str(), status));
+    ret = true;
+
+exit:
+    return ret;
+}
+
+void Firewall::Destroy(Firewall *aFirewall)
+{
+    delete aFirewall;
+}
+
+} // namespace MUD
+} // namespace otbr
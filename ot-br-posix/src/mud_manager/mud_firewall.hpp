@@ -0,0 +1,264 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the MUD firewall.
+ */
+
+#ifndef OTBR_MUD_FIREWALL_HPP_
+#define OTBR_MUD_FIREWALL_HPP_
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace MUD {
+
+/**
+ * This structure represents a firewall rule compiled from a MUD ACE.
+ *
+ */
+struct PolicyRule
+{
+    /**
+     * This enumeration represents the direction of the traffic a rule applies to.
+     *
+     */
+    enum Direction : uint8_t
+    {
+        kToDevice,   ///< Traffic forwarded to the device.
+        kFromDevice, ///< Traffic forwarded from the device.
+    };
+
+    /**
+     * This enumeration represents the connection tracking state a rule requires.
+     *
+     */
+    enum Connection : uint8_t
+    {
+        kAnyConnection, ///< Any packet, whichever side initiated the connection.
+        kOriginal,      ///< Packets from the side which initiated a new or established connection.
+        kReply,         ///< Packets replying to an established connection initiated by the other side.
+    };
+
+    Direction   mDirection;  ///< The direction of the traffic.
+    Connection  mConnection; ///< The connections the rule applies to.
+    std::string mAclName;    ///< The name of the ACL the rule is compiled from.
+    std::string mAceName;    ///< The name of the ACE the rule is compiled from.
+    uint8_t     mProtocol;   ///< The IP protocol number, zero for any protocol.
+    std::string mSrcDnsName; ///< The source DNS name, empty for any source.
+    std::string mDstDnsName; ///< The destination DNS name, empty for any destination.
+    uint16_t    mSrcPort;    ///< The source port, zero for any port.
+    uint16_t    mDstPort;    ///< The destination port, zero for any port.
+};
+
+/**
+ * This structure represents the traffic counted by the firewall.
+ *
+ */
+struct TrafficCounters
+{
+    uint64_t mPackets = 0; ///< The number of packets.
+    uint64_t mBytes   = 0; ///< The number of bytes.
+
+    /**
+     * This method adds the traffic counted since the previous reading of the same firewall counters.
+     *
+     * The firewall counters restart from zero when a ruleset is reloaded, a reading lower than the previous one is
+     * taken as a restart and added as a whole.
+     *
+     * @param[in]     aReading      The current reading.
+     * @param[in,out] aLastReading  The previous reading, replaced by @p aReading.
+     *
+     */
+    void Accumulate(const TrafficCounters &aReading, TrafficCounters &aLastReading);
+};
+
+/**
+ * This structure represents a firewall policy compiled from a MUD file.
+ *
+ * A policy is shared by all the devices using the same MUD file.
+ *
+ */
+struct Policy
+{
+    std::string             mName;  ///< The name of the policy, derived from the MUD file content hash.
+    std::string             mUrl;   ///< The MUD URL the policy is compiled from.
+    std::vector<PolicyRule> mRules; ///< The rules accepting traffic, anything else is dropped.
+
+    /**
+     * This method returns the DNS names matched by the rules of the policy.
+     *
+     * @returns The set of DNS names.
+     *
+     */
+    std::set<std::string> GetDnsNames(void) const;
+};
+
+/**
+ * This class defines the interface of the firewall enforcing MUD policies.
+ *
+ * Each policy is compiled once and shared by all the devices attached to it.
+ *
+ */
+class Firewall : private NonCopyable
+{
+public:
+    typedef std::set<std::string> AddressSet;
+
+    virtual ~Firewall(void) = default;
+
+    /**
+     * This method installs and applies a policy, without any device attached.
+     *
+     * @param[in] aPolicy  The policy.
+     *
+     * @retval TRUE   Successfully installed the policy.
+     * @retval FALSE  Failed to install the policy.
+     *
+     */
+    virtual bool InstallPolicy(const Policy &aPolicy) = 0;
+
+    /**
+     * This method removes an installed policy.
+     *
+     * @param[in] aPolicy  The policy.
+     *
+     */
+    virtual void RemovePolicy(const Policy &aPolicy) = 0;
+
+    /**
+     * This method attaches a device to an installed policy.
+     *
+     * @param[in] aPolicy   The policy.
+     * @param[in] aAddress  The IPv6 address of the device.
+     *
+     * @retval TRUE   Successfully attached the device.
+     * @retval FALSE  Failed to attach the device.
+     *
+     */
+    virtual bool BindDevice(const Policy &aPolicy, const std::string &aAddress) = 0;
+
+    /**
+     * This method detaches a device from a policy.
+     *
+     * @param[in] aPolicy   The policy.
+     * @param[in] aAddress  The IPv6 address of the device.
+     *
+     */
+    virtual void UnbindDevice(const Policy &aPolicy, const std::string &aAddress) = 0;
+
+    /**
+     * This method updates the addresses a DNS name matched by the installed policies resolves to.
+     *
+     * Rules match DNS names through sets of addresses, only these sets are updated when the addresses change.
+     *
+     * @param[in] aName       The DNS name.
+     * @param[in] aAddresses  The IPv6 addresses the name resolves to.
+     *
+     * @retval TRUE   Successfully updated the addresses.
+     * @retval FALSE  Failed to update the addresses.
+     *
+     */
+    virtual bool UpdateDnsName(const std::string &aName, const AddressSet &aAddresses) = 0;
+
+    /**
+     * This method installs policies together with the devices attached to them in a single batch.
+     *
+     * This is used to restore the persisted state at startup, so that the devices are protected again without
+     * waiting for them to re-attach.
+     *
+     * @param[in] aPolicies  The policies.
+     * @param[in] aDevices   The addresses of the devices attached to the policies, keyed by policy name.
+     *
+     * @retval TRUE   Successfully installed the policies and attached the devices.
+     * @retval FALSE  Failed to install the policies.
+     *
+     */
+    virtual bool Restore(const std::vector<Policy> &aPolicies, const std::map<std::string, AddressSet> &aDevices) = 0;
+
+    /**
+     * This method reads the traffic counters of an installed policy.
+     *
+     * The rules only count the traffic they accept, the devices count all the traffic forwarded from and to them.
+     *
+     * @param[in]  aPolicy   The policy.
+     * @param[out] aRules    The counters of the rules, in the order of the rules of the policy.
+     * @param[out] aDevices  The counters of the devices attached to the policy, keyed by address.
+     *
+     * @retval TRUE   Successfully read the counters.
+     * @retval FALSE  Failed to read the counters.
+     *
+     */
+    virtual bool GetCounters(const Policy                           &aPolicy,
+                             std::vector<TrafficCounters>           &aRules,
+                             std::map<std::string, TrafficCounters> &aDevices) = 0;
+
+    /**
+     * This function creates the firewall backend selected at build time.
+     *
+     * @param[in] aDirectory  The directory the firewall rules are written to.
+     *
+     * @returns A pointer to the newly created firewall.
+     *
+     */
+    static Firewall *Create(const std::string &aDirectory);
+
+    /**
+     * This function destroys the firewall.
+     *
+     * @param[in] aFirewall  A pointer to the firewall.
+     *
+     */
+    static void Destroy(Firewall *aFirewall);
+
+protected:
+    explicit Firewall(const std::string &aDirectory);
+
+    bool PrepareDirectory(void) const;
+
+    static std::string GetDnsSetName(const std::string &aName);
+    static bool        ReadCommandOutput(const std::string &aCommand, std::string &aOutput);
+
+    std::string mDirectory;
+
+    // The last known addresses of the DNS names, keyed by name.
+    std::map<std::string, AddressSet> mDnsAddresses;
+};
+
+} // namespace MUD
+} // namespace otbr
+
+#endif // OTBR_MUD_FIREWALL_HPP_
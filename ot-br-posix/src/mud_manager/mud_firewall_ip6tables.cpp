@@ -0,0 +1,476 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the ip6tables MUD firewall.
+ */
+
+#define OTBR_LOG_TAG "MudManager"
+
+#include "mud_manager/mud_firewall_ip6tables.hpp"
+
+#include <fstream>
+#include <sstream>
+
+#include <arpa/inet.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common/logging.hpp"
+#include "utils/system_utils.hpp"
+
+namespace otbr {
+namespace MUD {
+
+constexpr char Ip6tablesFirewall::kRuleCommentPrefix[];
+
+Ip6tablesFirewall::Ip6tablesFirewall(const std::string &aDirectory)
+    : Firewall(aDirectory)
+{
+}
+
+std::string Ip6tablesFirewall::GetPolicyPath(const std::string &aPolicyName) const
+{
+    return mDirectory + "/" + aPolicyName + ".sh";
+}
+
+std::string Ip6tablesFirewall::GetRestorePath(void) const
+{
+    return mDirectory + "/restore.sh";
+}
+
+std::string Ip6tablesFirewall::GetProtocolName(uint8_t aProtocol)
+{
+    std::string name;
+
+    switch (aProtocol)
+    {
+    case 6:
+        name = "tcp";
+        break;
+    case 17:
+        name = "udp";
+        break;
+    case 58:
+        name = "icmpv6";
+        break;
+    default:
+        // Any other protocol is matched by number, zero matches any protocol.
+        if (aProtocol != 0)
+        {
+            name = std::to_string(aProtocol);
+        }
+        break;
+    }
+
+    return name;
+}
+
+bool Ip6tablesFirewall::GetRule(const PolicyRule &aRule, size_t aIndex, std::string &aCommand)
+{
+    std::ostringstream rule;
+    std::string        protocol = GetProtocolName(aRule.mProtocol);
+    bool               ret      = false;
+
+    // The --sport and --dport matches are only loaded with the tcp and udp protocols.
+    VerifyOrExit((aRule.mSrcPort == 0 && aRule.mDstPort == 0) || aRule.mProtocol == 6 || aRule.mProtocol == 17,
+                 otbrLogWarning("Port match of rule %zu requires tcp or udp, protocol is %u", aIndex,
+                                static_cast<unsigned int>(aRule.mProtocol)));
+
+    rule << "ip6tables -A " << (aRule.mDirection == PolicyRule::kToDevice ? "$POLICY_IN" : "$POLICY_OUT");
+
+    if (!protocol.empty())
+    {
+        rule << " -p " << protocol;
+    }
+
+    if (!aRule.mSrcDnsName.empty())
+    {
+        rule << " -m set --match-set " << GetDnsSetName(aRule.mSrcDnsName) << " src";
+    }
+
+    if (!aRule.mDstDnsName.empty())
+    {
+        rule << " -m set --match-set " << GetDnsSetName(aRule.mDstDnsName) << " dst";
+    }
+
+    if (aRule.mDstPort > 0)
+    {
+        rule << " --dport " << aRule.mDstPort;
+    }
+
+    if (aRule.mSrcPort > 0)
+    {
+        rule << " --sport " << aRule.mSrcPort;
+    }
+
+    if (aRule.mConnection == PolicyRule::kOriginal)
+    {
+        rule << " -m conntrack --ctstate NEW,ESTABLISHED --ctdir ORIGINAL";
+    }
+    else if (aRule.mConnection == PolicyRule::kReply)
+    {
+        rule << " -m conntrack --ctstate ESTABLISHED,RELATED --ctdir REPLY";
+    }
+
+    // The comment identifies the rule when reading its counter back.
+    rule << " -m comment --comment \"" << kRuleCommentPrefix << aIndex << "\" -j ACCEPT";
+
+    aCommand = rule.str();
+    ret      = true;
+
+exit:
+    return ret;
+}
+
+bool Ip6tablesFirewall::WritePolicyScript(const Policy &aPolicy)
+{
+    std::string           path     = GetPolicyPath(aPolicy.mName);
+    std::set<std::string> dnsNames = aPolicy.GetDnsNames();
+    std::ofstream         outfile;
+    bool                  ret = false;
+
+    VerifyOrExit(PrepareDirectory());
+
+    outfile.open(path);
+
+    outfile << "#!/bin/bash" << std::endl;
+    outfile << std::endl;
+    outfile << "POLICY=" << aPolicy.mName << std::endl;
+    outfile << "POLICY_IN=${POLICY}_in" << std::endl;
+    outfile << "POLICY_OUT=${POLICY}_out" << std::endl;
+    outfile << "DEVICES=${POLICY}_dev" << std::endl;
+    outfile << std::endl;
+    outfile << "if [[ $1 == \"down\" ]]; then" << std::endl;
+    outfile << std::endl;
+    outfile << "ip6tables -D FORWARD -m set --match-set $DEVICES dst -j $POLICY_IN" << std::endl;
+    outfile << "ip6tables -F $POLICY_IN" << std::endl;
+    outfile << "ip6tables -X $POLICY_IN" << std::endl;
+    outfile << std::endl;
+    outfile << "ip6tables -D FORWARD -m set --match-set $DEVICES src -j $POLICY_OUT" << std::endl;
+    outfile << "ip6tables -F $POLICY_OUT" << std::endl;
+    outfile << "ip6tables -X $POLICY_OUT" << std::endl;
+    outfile << std::endl;
+    outfile << "ipset destroy $DEVICES" << std::endl;
+
+    // The DNS sets are shared with other policies and only destroyed once unused.
+    for (const std::string &name : dnsNames)
+    {
+        outfile << "ipset destroy " << GetDnsSetName(name) << " 2> /dev/null" << std::endl;
+    }
+
+    outfile << std::endl;
+    outfile << "fi" << std::endl;
+    outfile << std::endl;
+    outfile << "if [[ $1 == \"up\" ]]; then" << std::endl;
+    outfile << std::endl;
+    outfile << "# The policy is shared by all devices using it and only installed once." << std::endl;
+    outfile << "ipset list -n $DEVICES > /dev/null 2>&1 && exit 0" << std::endl;
+    outfile << std::endl;
+    outfile << "ipset create $DEVICES hash:ip family inet6 counters" << std::endl;
+
+    for (const std::string &name : dnsNames)
+    {
+        outfile << "ipset create -exist " << GetDnsSetName(name) << " hash:ip family inet6" << std::endl;
+    }
+
+    outfile << "ip6tables -N $POLICY_IN" << std::endl;
+    outfile << "ip6tables -N $POLICY_OUT" << std::endl;
+
+    for (size_t index = 0; index < aPolicy.mRules.size(); index++)
+    {
+        const PolicyRule &rule = aPolicy.mRules[index];
+        std::string       command;
+
+        VerifyOrExit(GetRule(rule, index, command));
+
+        outfile << std::endl;
+        outfile << command << std::endl;
+    }
+
+    outfile << std::endl;
+    outfile << "ip6tables -A $POLICY_IN -j LOG --log-prefix \"MUD-Dropped: \" --log-level 4" << std::endl;
+    outfile << "ip6tables -A $POLICY_OUT -j LOG --log-prefix \"MUD-Dropped: \" --log-level 4" << std::endl;
+    outfile << std::endl;
+    outfile << "ip6tables -A $POLICY_IN -j DROP" << std::endl;
+    outfile << "ip6tables -A $POLICY_OUT -j DROP" << std::endl;
+    outfile << std::endl;
+    outfile << "ip6tables -I FORWARD 1 -m set --match-set $DEVICES dst -j $POLICY_IN" << std::endl;
+    outfile << "ip6tables -I FORWARD 1 -m set --match-set $DEVICES src -j $POLICY_OUT" << std::endl;
+    outfile << std::endl;
+    outfile << "fi" << std::endl;
+
+    outfile.close();
+    VerifyOrExit(!outfile.fail(), otbrLogErr("Failed to write %s", path.c_str()));
+
+    SystemUtils::ExecuteCommand("chmod +x %s", path.c_str());
+    ret = true;
+
+exit:
+    return ret;
+}
+
+bool Ip6tablesFirewall::InstallPolicy(const Policy &aPolicy)
+{
+    bool ret = false;
+
+    otbrLogInfo("Creating ip6tables policy %s for %s", aPolicy.mName.c_str(), aPolicy.mUrl.c_str());
+
+    VerifyOrExit(WritePolicyScript(aPolicy));
+    VerifyOrExit(SystemUtils::ExecuteCommand("bash %s up", GetPolicyPath(aPolicy.mName).c_str()) == 0);
+
+    // Fill the sets of the names which were already resolved for another policy.
+    for (const std::string &name : aPolicy.GetDnsNames())
+    {
+        if (mDnsAddresses.count(name) != 0)
+        {
+            ApplyDnsSet(name);
+        }
+    }
+
+    ret = true;
+
+exit:
+    return ret;
+}
+
+bool Ip6tablesFirewall::BindDevice(const Policy &aPolicy, const std::string &aAddress)
+{
+    otbrLogInfo("Attaching device %s to policy %s", aAddress.c_str(), aPolicy.mName.c_str());
+
+    // Only the set of devices of the installed policy is updated.
+    return SystemUtils::ExecuteCommand("ipset add -exist %s_dev %s", aPolicy.mName.c_str(), aAddress.c_str()) == 0;
+}
+
+void Ip6tablesFirewall::RemovePolicy(const Policy &aPolicy)
+{
+    std::string path = GetPolicyPath(aPolicy.mName);
+
+    otbrLogInfo("Removing ip6tables policy %s", aPolicy.mName.c_str());
+
+    SystemUtils::ExecuteCommand("bash %s down", path.c_str());
+    remove(path.c_str());
+}
+
+void Ip6tablesFirewall::UnbindDevice(const Policy &aPolicy, const std::string &aAddress)
+{
+    otbrLogInfo("Detaching device %s from policy %s", aAddress.c_str(), aPolicy.mName.c_str());
+
+    if (SystemUtils::ExecuteCommand("ipset del -exist %s_dev %s", aPolicy.mName.c_str(), aAddress.c_str()) != 0)
+    {
+        otbrLogWarning("Failed to detach device %s", aAddress.c_str());
+    }
+}
+
+bool Ip6tablesFirewall::UpdateDnsName(const std::string &aName, const AddressSet &aAddresses)
+{
+    mDnsAddresses[aName] = aAddresses;
+
+    return ApplyDnsSet(aName);
+}
+
+bool Ip6tablesFirewall::ApplyDnsSet(const std::string &aName)
+{
+    std::string   setName = GetDnsSetName(aName);
+    std::string   path    = mDirectory + "/" + setName + ".ipset";
+    std::ofstream outfile;
+    bool          ret = false;
+
+    VerifyOrExit(PrepareDirectory());
+
+    otbrLogInfo("Updating ipset %s of DNS name %s", setName.c_str(), aName.c_str());
+
+    // The new addresses are loaded into a temporary set swapped in atomically,
+    // so the rules never see a partially updated set.
+    outfile.open(path);
+
+    outfile << "create " << setName << " hash:ip family inet6" << std::endl;
+    outfile << "create " << setName << "_tmp hash:ip family inet6" << std::endl;
+    outfile << "flush " << setName << "_tmp" << std::endl;
+
+    for (const std::string &address : mDnsAddresses[aName])
+    {
+        outfile << "add " << setName << "_tmp " << address << std::endl;
+    }
+
+    outfile << "swap " << setName << "_tmp " << setName << std::endl;
+    outfile << "destroy " << setName << "_tmp" << std::endl;
+
+    outfile.close();
+    VerifyOrExit(!outfile.fail(), otbrLogErr("Failed to write %s", path.c_str()));
+
+    VerifyOrExit(SystemUtils::ExecuteCommand("ipset -exist restore < %s", path.c_str()) == 0);
+    ret = true;
+
+exit:
+    return ret;
+}
+
+bool Ip6tablesFirewall::Restore(const std::vector<Policy> &aPolicies, const std::map<std::string, AddressSet> &aDevices)
+{
+    std::string   path = GetRestorePath();
+    std::ofstream outfile;
+    bool          ret = false;
+
+    otbrLogInfo("Restoring %zu ip6tables policies", aPolicies.size());
+
+    VerifyOrExit(PrepareDirectory());
+
+    outfile.open(path);
+
+    outfile << "#!/bin/bash" << std::endl;
+    outfile << std::endl;
+
+    // The policy scripts are kept for removing the policies later, but
+    // everything is brought up from a single shell and the device sets are
+    // filled with a single ipset transaction.
+    for (const Policy &policy : aPolicies)
+    {
+        VerifyOrExit(WritePolicyScript(policy));
+        outfile << "bash " << GetPolicyPath(policy.mName) << " up || exit 1" << std::endl;
+    }
+
+    outfile << std::endl;
+    outfile << "ipset -exist restore << EOF" << std::endl;
+
+    for (const Policy &policy : aPolicies)
+    {
+        auto devices = aDevices.find(policy.mName);
+
+        if (devices == aDevices.end())
+        {
+            continue;
+        }
+
+        for (const std::string &address : devices->second)
+        {
+            outfile << "add " << policy.mName << "_dev " << address << std::endl;
+        }
+    }
+
+    outfile << "EOF" << std::endl;
+
+    outfile.close();
+    VerifyOrExit(!outfile.fail(), otbrLogErr("Failed to write %s", path.c_str()));
+
+    VerifyOrExit(SystemUtils::ExecuteCommand("bash %s", path.c_str()) == 0);
+    ret = true;
+
+exit:
+    return ret;
+}
+
+bool Ip6tablesFirewall::GetCounters(const Policy                           &aPolicy,
+                                    std::vector<TrafficCounters>           &aRules,
+                                    std::map<std::string, TrafficCounters> &aDevices)
+{
+    std::string output;
+    bool        ret = false;
+
+    aRules.assign(aPolicy.mRules.size(), TrafficCounters());
+    aDevices.clear();
+
+    for (const char *suffix : {"_in", "_out"})
+    {
+        VerifyOrExit(ReadCommandOutput("ip6tables -L " + aPolicy.mName + suffix + " -v -x -n", output));
+        ParseRuleCounters(output, aRules);
+    }
+
+    VerifyOrExit(ReadCommandOutput("ipset list " + aPolicy.mName + "_dev", output));
+    ParseDeviceCounters(output, aDevices);
+    ret = true;
+
+exit:
+    return ret;
+}
+
+void Ip6tablesFirewall::ParseRuleCounters(const std::string &aOutput, std::vector<TrafficCounters> &aRules)
+{
+    static const std::string kComment = std::string("/* ") + kRuleCommentPrefix;
+
+    std::istringstream input(aOutput);
+    std::string        line;
+
+    // The rules are listed as `<packets> <bytes> ACCEPT ... /* ace <index> */ ...`.
+    while (std::getline(input, line))
+    {
+        size_t          position = line.find(kComment);
+        size_t          index;
+        TrafficCounters counters;
+
+        if (position == std::string::npos)
+        {
+            continue;
+        }
+
+        index = strtoul(line.c_str() + position + kComment.size(), nullptr, 10);
+
+        if (index < aRules.size() &&
+            sscanf(line.c_str(), "%" SCNu64 " %" SCNu64, &counters.mPackets, &counters.mBytes) == 2)
+        {
+            aRules[index] = counters;
+        }
+    }
+}
+
+void Ip6tablesFirewall::ParseDeviceCounters(const std::string                      &aOutput,
+                                            std::map<std::string, TrafficCounters> &aDevices)
+{
+    std::istringstream input(aOutput);
+    std::string        line;
+    bool               inMembers = false;
+
+    // The members are listed as `<address> packets <n> bytes <n>`.
+    while (std::getline(input, line))
+    {
+        char            address[INET6_ADDRSTRLEN];
+        TrafficCounters counters;
+
+        if (!inMembers)
+        {
+            inMembers = (line == "Members:");
+            continue;
+        }
+
+        if (sscanf(line.c_str(), "%45s packets %" SCNu64 " bytes %" SCNu64, address, &counters.mPackets,
+                   &counters.mBytes) == 3)
+        {
+            aDevices[address] = counters;
+        }
+    }
+}
+
+Firewall *Firewall::Create(const std::string &aDirectory)
+{
+    return new Ip6tablesFirewall(aDirectory);
+}
+
+} // namespace MUD
+} // namespace otbr
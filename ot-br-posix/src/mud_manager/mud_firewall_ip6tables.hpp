@@ -0,0 +1,109 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the ip6tables MUD firewall.
+ */
+
+#ifndef OTBR_MUD_FIREWALL_IP6TABLES_HPP_
+#define OTBR_MUD_FIREWALL_IP6TABLES_HPP_
+
+#include <string>
+#include <vector>
+
+#include "mud_manager/mud_firewall.hpp"
+
+namespace otbr {
+namespace MUD {
+
+/**
+ * This class implements the ip6tables firewall enforcing MUD policies.
+ *
+ * Each policy is compiled once into a pair of chains, and devices are attached to a policy through an ipset of
+ * device addresses matched in the FORWARD chain. The number of rules thus grows with the number of distinct MUD
+ * files rather than with the number of devices. DNS names are matched through ipsets of their addresses, which are
+ * swapped atomically when the names resolve to new addresses. The rules count the traffic they accept, and the ipset of
+ * device addresses counts the traffic of each device.
+ *
+ */
+class Ip6tablesFirewall : public Firewall
+{
+public:
+    /**
+     * This constructor initializes the firewall.
+     *
+     * @param[in] aDirectory  The directory the firewall scripts are written to.
+     *
+     */
+    explicit Ip6tablesFirewall(const std::string &aDirectory);
+
+    bool InstallPolicy(const Policy &aPolicy) override;
+    void RemovePolicy(const Policy &aPolicy) override;
+    bool BindDevice(const Policy &aPolicy, const std::string &aAddress) override;
+    void UnbindDevice(const Policy &aPolicy, const std::string &aAddress) override;
+    bool UpdateDnsName(const std::string &aName, const AddressSet &aAddresses) override;
+    bool Restore(const std::vector<Policy> &aPolicies, const std::map<std::string, AddressSet> &aDevices) override;
+    bool GetCounters(const Policy                           &aPolicy,
+                     std::vector<TrafficCounters>           &aRules,
+                     std::map<std::string, TrafficCounters> &aDevices) override;
+
+    /**
+     * This function parses the counters of the rules out of the listing of a chain of a policy.
+     *
+     * @param[in]     aOutput  The output of `ip6tables -L -v -x -n`.
+     * @param[in,out] aRules   The counters of the rules, sized to the number of rules of the policy.
+     *
+     */
+    static void ParseRuleCounters(const std::string &aOutput, std::vector<TrafficCounters> &aRules);
+
+    /**
+     * This function parses the counters of the devices out of the listing of the ipset of a policy.
+     *
+     * @param[in]  aOutput   The output of `ipset list`.
+     * @param[out] aDevices  The counters of the devices, keyed by address.
+     *
+     */
+    static void ParseDeviceCounters(const std::string &aOutput, std::map<std::string, TrafficCounters> &aDevices);
+
+private:
+    static constexpr char kRuleCommentPrefix[] = "ace ";
+
+    std::string GetPolicyPath(const std::string &aPolicyName) const;
+    std::string GetRestorePath(void) const;
+    bool        WritePolicyScript(const Policy &aPolicy);
+    bool        ApplyDnsSet(const std::string &aName);
+
+    static std::string GetProtocolName(uint8_t aProtocol);
+    static bool        GetRule(const PolicyRule &aRule, size_t aIndex, std::string &aCommand);
+};
+
+} // namespace MUD
+} // namespace otbr
+
+#endif // OTBR_MUD_FIREWALL_IP6TABLES_HPP_
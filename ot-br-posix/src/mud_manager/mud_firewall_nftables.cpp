@@ -0,0 +1,447 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the nftables MUD firewall.
+ */
+
+#define OTBR_LOG_TAG "MudManager"
+
+#include "mud_manager/mud_firewall_nftables.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common/logging.hpp"
+#include "utils/system_utils.hpp"
+
+namespace otbr {
+namespace MUD {
+
+constexpr char NftablesFirewall::kRuleCommentPrefix[];
+
+NftablesFirewall::NftablesFirewall(const std::string &aDirectory)
+    : Firewall(aDirectory)
+{
+}
+
+std::string NftablesFirewall::GetPolicyPath(const std::string &aPolicyName) const
+{
+    return mDirectory + "/" + aPolicyName + ".nft";
+}
+
+std::string NftablesFirewall::GetRestorePath(void) const
+{
+    return mDirectory + "/restore.nft";
+}
+
+std::string NftablesFirewall::GetRule(const PolicyRule &aRule, size_t aIndex)
+{
+    std::ostringstream rule;
+
+    if (!aRule.mSrcDnsName.empty())
+    {
+        rule << "ip6 saddr @" << GetDnsSetName(aRule.mSrcDnsName) << " ";
+    }
+
+    if (!aRule.mDstDnsName.empty())
+    {
+        rule << "ip6 daddr @" << GetDnsSetName(aRule.mDstDnsName) << " ";
+    }
+
+    if (aRule.mProtocol != 0)
+    {
+        rule << "meta l4proto " << static_cast<unsigned int>(aRule.mProtocol) << " ";
+    }
+
+    if (aRule.mSrcPort > 0)
+    {
+        rule << "th sport " << aRule.mSrcPort << " ";
+    }
+
+    if (aRule.mDstPort > 0)
+    {
+        rule << "th dport " << aRule.mDstPort << " ";
+    }
+
+    if (aRule.mConnection == PolicyRule::kOriginal)
+    {
+        rule << "ct direction original ct state new,established ";
+    }
+    else if (aRule.mConnection == PolicyRule::kReply)
+    {
+        rule << "ct direction reply ct state established,related ";
+    }
+
+    // The comment identifies the rule when reading its counter back.
+    rule << "counter accept comment \"" << kRuleCommentPrefix << aIndex << "\"";
+
+    return rule.str();
+}
+
+void NftablesFirewall::WriteElements(std::ostream &aOutput, const AddressSet &aAddresses)
+{
+    const char *separator = "";
+
+    aOutput << "{ ";
+
+    for (const std::string &address : aAddresses)
+    {
+        aOutput << separator << address;
+        separator = ", ";
+    }
+
+    aOutput << " }";
+}
+
+bool NftablesFirewall::WriteRulesetFile(const Policy &aPolicy)
+{
+    const std::set<std::string> &devices = mDevices[aPolicy.mName];
+    std::string                  path    = GetPolicyPath(aPolicy.mName);
+    std::string                  tmpPath = path + ".tmp";
+    std::ofstream                outfile;
+    bool                         ret = false;
+
+    VerifyOrExit(PrepareDirectory());
+
+    outfile.open(tmpPath);
+
+    outfile << "#!/usr/sbin/nft -f" << std::endl;
+    outfile << std::endl;
+    // Declaring the table before deleting it makes the deletion succeed when the
+    // policy is not loaded yet. The whole file is a single transaction.
+    outfile << "add table inet " << aPolicy.mName << std::endl;
+    outfile << "delete table inet " << aPolicy.mName << std::endl;
+    outfile << std::endl;
+    outfile << "table inet " << aPolicy.mName << " {" << std::endl;
+    outfile << "    set devices {" << std::endl;
+    outfile << "        type ipv6_addr" << std::endl;
+    outfile << "        counter" << std::endl;
+
+    if (!devices.empty())
+    {
+        outfile << "        elements = ";
+        WriteElements(outfile, devices);
+        outfile << std::endl;
+    }
+
+    outfile << "    }" << std::endl;
+
+    for (const std::string &name : mDnsNames[aPolicy.mName])
+    {
+        const AddressSet &addresses = mDnsAddresses[name];
+
+        outfile << std::endl;
+        outfile << "    set " << GetDnsSetName(name) << " {" << std::endl;
+        outfile << "        type ipv6_addr" << std::endl;
+
+        if (!addresses.empty())
+        {
+            outfile << "        elements = ";
+            WriteElements(outfile, addresses);
+            outfile << std::endl;
+        }
+
+        outfile << "    }" << std::endl;
+    }
+
+    for (PolicyRule::Direction direction : {PolicyRule::kToDevice, PolicyRule::kFromDevice})
+    {
+        outfile << std::endl;
+        outfile << "    chain " << (direction == PolicyRule::kToDevice ? "to_device" : "from_device") << " {"
+                << std::endl;
+
+        for (size_t index = 0; index < aPolicy.mRules.size(); index++)
+        {
+            const PolicyRule &rule = aPolicy.mRules[index];
+
+            if (rule.mDirection == direction)
+            {
+                outfile << "        " << GetRule(rule, index) << std::endl;
+            }
+        }
+
+        outfile << "        log prefix \"MUD-Dropped: \" level warn" << std::endl;
+        outfile << "        drop" << std::endl;
+        outfile << "    }" << std::endl;
+    }
+
+    outfile << std::endl;
+    outfile << "    chain forward {" << std::endl;
+    outfile << "        type filter hook forward priority 0; policy accept;" << std::endl;
+    outfile << "        ip6 daddr @devices jump to_device" << std::endl;
+    outfile << "        ip6 saddr @devices jump from_device" << std::endl;
+    outfile << "    }" << std::endl;
+    outfile << "}" << std::endl;
+
+    outfile.close();
+    VerifyOrExit(!outfile.fail(), otbrLogErr("Failed to write %s", tmpPath.c_str()));
+    VerifyOrExit(rename(tmpPath.c_str(), path.c_str()) == 0, otbrLogErr("Failed to write %s", path.c_str()));
+    ret = true;
+
+exit:
+    return ret;
+}
+
+bool NftablesFirewall::WriteRuleset(const Policy &aPolicy)
+{
+    return WriteRulesetFile(aPolicy) &&
+           SystemUtils::ExecuteCommand("nft -f %s", GetPolicyPath(aPolicy.mName).c_str()) == 0;
+}
+
+bool NftablesFirewall::InstallPolicy(const Policy &aPolicy)
+{
+    otbrLogInfo("Creating nftables policy %s for %s", aPolicy.mName.c_str(), aPolicy.mUrl.c_str());
+
+    mDnsNames[aPolicy.mName] = aPolicy.GetDnsNames();
+
+    return WriteRuleset(aPolicy);
+}
+
+bool NftablesFirewall::BindDevice(const Policy &aPolicy, const std::string &aAddress)
+{
+    otbrLogInfo("Attaching device %s to policy %s", aAddress.c_str(), aPolicy.mName.c_str());
+
+    // Only the set of devices is updated, the ruleset file is rewritten on the next reload of the policy.
+    mDevices[aPolicy.mName].insert(aAddress);
+
+    return SystemUtils::ExecuteCommand("nft add element inet %s devices '{ %s }'", aPolicy.mName.c_str(),
+                                       aAddress.c_str()) == 0;
+}
+
+void NftablesFirewall::RemovePolicy(const Policy &aPolicy)
+{
+    otbrLogInfo("Removing nftables policy %s", aPolicy.mName.c_str());
+
+    mDevices.erase(aPolicy.mName);
+    mDnsNames.erase(aPolicy.mName);
+    SystemUtils::ExecuteCommand("nft delete table inet %s", aPolicy.mName.c_str());
+    remove(GetPolicyPath(aPolicy.mName).c_str());
+}
+
+void NftablesFirewall::UnbindDevice(const Policy &aPolicy, const std::string &aAddress)
+{
+    otbrLogInfo("Detaching device %s from policy %s", aAddress.c_str(), aPolicy.mName.c_str());
+
+    mDevices[aPolicy.mName].erase(aAddress);
+
+    if (SystemUtils::ExecuteCommand("nft delete element inet %s devices '{ %s }'", aPolicy.mName.c_str(),
+                                    aAddress.c_str()) != 0)
+    {
+        otbrLogWarning("Failed to detach device %s", aAddress.c_str());
+    }
+}
+
+bool NftablesFirewall::UpdateDnsName(const std::string &aName, const AddressSet &aAddresses)
+{
+    std::string   setName = GetDnsSetName(aName);
+    std::string   path    = mDirectory + "/" + setName + ".nft";
+    std::ofstream outfile;
+    bool          ret = false;
+
+    mDnsAddresses[aName] = aAddresses;
+
+    VerifyOrExit(PrepareDirectory());
+
+    otbrLogInfo("Updating set %s of DNS name %s", setName.c_str(), aName.c_str());
+
+    outfile.open(path);
+
+    outfile << "#!/usr/sbin/nft -f" << std::endl;
+    outfile << std::endl;
+
+    // Only the sets are replaced, in a single transaction across all policies.
+    for (const auto &policy : mDnsNames)
+    {
+        if (policy.second.count(aName) == 0)
+        {
+            continue;
+        }
+
+        outfile << "flush set inet " << policy.first << " " << setName << std::endl;
+
+        if (!aAddresses.empty())
+        {
+            outfile << "add element inet " << policy.first << " " << setName << " ";
+            WriteElements(outfile, aAddresses);
+            outfile << std::endl;
+        }
+    }
+
+    outfile.close();
+    VerifyOrExit(!outfile.fail(), otbrLogErr("Failed to write %s", path.c_str()));
+
+    VerifyOrExit(SystemUtils::ExecuteCommand("nft -f %s", path.c_str()) == 0);
+    ret = true;
+
+exit:
+    return ret;
+}
+
+bool NftablesFirewall::Restore(const std::vector<Policy> &aPolicies, const std::map<std::string, AddressSet> &aDevices)
+{
+    std::string   path = GetRestorePath();
+    std::ofstream outfile;
+    bool          ret = false;
+
+    otbrLogInfo("Restoring %zu nftables policies", aPolicies.size());
+
+    VerifyOrExit(PrepareDirectory());
+
+    outfile.open(path);
+
+    outfile << "#!/usr/sbin/nft -f" << std::endl;
+    outfile << std::endl;
+
+    // Including the rulesets of all the policies loads them in a single transaction.
+    for (const Policy &policy : aPolicies)
+    {
+        auto devices = aDevices.find(policy.mName);
+
+        mDnsNames[policy.mName] = policy.GetDnsNames();
+        mDevices[policy.mName]  = (devices != aDevices.end()) ? devices->second : AddressSet();
+
+        VerifyOrExit(WriteRulesetFile(policy));
+        outfile << "include \"" << GetPolicyPath(policy.mName) << "\"" << std::endl;
+    }
+
+    outfile.close();
+    VerifyOrExit(!outfile.fail(), otbrLogErr("Failed to write %s", path.c_str()));
+
+    VerifyOrExit(SystemUtils::ExecuteCommand("nft -f %s", path.c_str()) == 0);
+    ret = true;
+
+exit:
+    return ret;
+}
+
+bool NftablesFirewall::GetCounters(const Policy                           &aPolicy,
+                                   std::vector<TrafficCounters>           &aRules,
+                                   std::map<std::string, TrafficCounters> &aDevices)
+{
+    std::string output;
+    bool        ret = false;
+
+    VerifyOrExit(ReadCommandOutput("nft list table inet " + aPolicy.mName, output));
+
+    aRules.assign(aPolicy.mRules.size(), TrafficCounters());
+    aDevices.clear();
+    ParseCounters(output, aRules, aDevices);
+    ret = true;
+
+exit:
+    return ret;
+}
+
+void NftablesFirewall::ParseCounters(const std::string                      &aOutput,
+                                     std::vector<TrafficCounters>           &aRules,
+                                     std::map<std::string, TrafficCounters> &aDevices)
+{
+    static const std::string kElements = "elements = {";
+    static const std::string kComment  = std::string("comment \"") + kRuleCommentPrefix;
+
+    std::istringstream input(aOutput);
+    std::string        line;
+    std::string        elements;
+    bool               inElements = false;
+
+    while (std::getline(input, line))
+    {
+        size_t position = line.find(kElements);
+
+        // The elements of the sets may be wrapped on several lines.
+        if (position != std::string::npos)
+        {
+            inElements = true;
+            line.erase(0, position + kElements.size());
+        }
+
+        if (inElements)
+        {
+            position   = line.find('}');
+            inElements = (position == std::string::npos);
+            elements += line.substr(0, position) + " ";
+            continue;
+        }
+
+        position = line.find(kComment);
+
+        if (position != std::string::npos)
+        {
+            size_t          index   = strtoul(line.c_str() + position + kComment.size(), nullptr, 10);
+            size_t          counter = line.find("counter packets ");
+            TrafficCounters counters;
+
+            if (counter != std::string::npos && index < aRules.size() &&
+                sscanf(line.c_str() + counter, "counter packets %" SCNu64 " bytes %" SCNu64, &counters.mPackets,
+                       &counters.mBytes) == 2)
+            {
+                aRules[index] = counters;
+            }
+        }
+    }
+
+    // Only the elements of the set of devices carry counters, as in `<address> counter packets <n> bytes <n>`.
+    std::replace(elements.begin(), elements.end(), ',', ' ');
+
+    {
+        std::istringstream tokens(elements);
+        std::string        token;
+        std::string        address;
+
+        while (tokens >> token)
+        {
+            if (token == "packets")
+            {
+                tokens >> aDevices[address].mPackets;
+            }
+            else if (token == "bytes")
+            {
+                tokens >> aDevices[address].mBytes;
+            }
+            else if (token != "counter")
+            {
+                address = token;
+            }
+        }
+    }
+}
+
+Firewall *Firewall::Create(const std::string &aDirectory)
+{
+    return new NftablesFirewall(aDirectory);
+}
+
+} // namespace MUD
+} // namespace otbr
@@ -0,0 +1,112 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the nftables MUD firewall.
+ */
+
+#ifndef OTBR_MUD_FIREWALL_NFTABLES_HPP_
+#define OTBR_MUD_FIREWALL_NFTABLES_HPP_
+
+#include <map>
+#include <ostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "mud_manager/mud_firewall.hpp"
+
+namespace otbr {
+namespace MUD {
+
+/**
+ * This class implements the nftables firewall enforcing MUD policies.
+ *
+ * Each policy is written as a ruleset file declaring its own table, with the set of attached devices, the chains of the
+ * policy and a forward hook. The file replaces the whole table, so loading it with `nft -f` applies the policy and all
+ * its devices in a single atomic transaction and a single process. Devices attached or detached later are added to or
+ * deleted from the set of devices in place, without reloading the table. DNS names are matched through sets of their
+ * addresses, which are updated in place when the names resolve to new addresses. The rules and the elements of the set
+ * of devices carry counters, read back by listing the table.
+ *
+ */
+class NftablesFirewall : public Firewall
+{
+public:
+    /**
+     * This constructor initializes the firewall.
+     *
+     * @param[in] aDirectory  The directory the ruleset files are written to.
+     *
+     */
+    explicit NftablesFirewall(const std::string &aDirectory);
+
+    bool InstallPolicy(const Policy &aPolicy) override;
+    void RemovePolicy(const Policy &aPolicy) override;
+    bool BindDevice(const Policy &aPolicy, const std::string &aAddress) override;
+    void UnbindDevice(const Policy &aPolicy, const std::string &aAddress) override;
+    bool UpdateDnsName(const std::string &aName, const AddressSet &aAddresses) override;
+    bool Restore(const std::vector<Policy> &aPolicies, const std::map<std::string, AddressSet> &aDevices) override;
+    bool GetCounters(const Policy                           &aPolicy,
+                     std::vector<TrafficCounters>           &aRules,
+                     std::map<std::string, TrafficCounters> &aDevices) override;
+
+    /**
+     * This function parses the counters out of the listing of the table of a policy.
+     *
+     * @param[in]     aOutput   The output of `nft list table`.
+     * @param[in,out] aRules    The counters of the rules, sized to the number of rules of the policy.
+     * @param[out]    aDevices  The counters of the devices, keyed by address.
+     *
+     */
+    static void ParseCounters(const std::string                      &aOutput,
+                              std::vector<TrafficCounters>           &aRules,
+                              std::map<std::string, TrafficCounters> &aDevices);
+
+private:
+    static constexpr char kRuleCommentPrefix[] = "ace ";
+
+    std::string GetPolicyPath(const std::string &aPolicyName) const;
+    std::string GetRestorePath(void) const;
+    bool        WriteRulesetFile(const Policy &aPolicy);
+    bool        WriteRuleset(const Policy &aPolicy);
+
+    static std::string GetRule(const PolicyRule &aRule, size_t aIndex);
+    static void        WriteElements(std::ostream &aOutput, const AddressSet &aAddresses);
+
+    // The addresses of the devices attached to each policy, and the DNS names
+    // matched by each policy, keyed by policy name.
+    std::map<std::string, AddressSet>            mDevices;
+    std::map<std::string, std::set<std::string>> mDnsNames;
+};
+
+} // namespace MUD
+} // namespace otbr
+
+#endif // OTBR_MUD_FIREWALL_NFTABLES_HPP_
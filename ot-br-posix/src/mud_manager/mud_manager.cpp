@@ -36,14 +36,13 @@
 #include "mud_manager/mud_manager.hpp"
 
 #include <openthread/platform/toolchain.h>
-#include <openthread/message.h>
 #include "ncp/ncp_openthread.hpp"
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/time.hpp"
 
 #include <list>
-#include <thread>
 #include <iostream>
 #include <ostream>
 #include <fstream>
@@ -57,666 +56,774 @@
 #include <fcntl.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
 #include "common/code_utils.hpp"
+#include "utils/hex.hpp"
 #include "utils/system_utils.hpp"
 
-#include "../../third_party/curlcpp/repo/include/curl_easy.h"
-#include "../../third_party/curlcpp/repo/include/curl_form.h"
-#include "../../third_party/curlcpp/repo/include/curl_ios.h"
-#include "../../third_party/curlcpp/repo/include/curl_exception.h"
-
-#include "../../third_party/rapidjson/repo/include/rapidjson/document.h"
-#include "../../third_party/rapidjson/repo/include/rapidjson/writer.h"
-#include "../../third_party/rapidjson/repo/include/rapidjson/stringbuffer.h"
-
-using namespace curl;
-using namespace rapidjson;
 using namespace std;
 
 
 namespace otbr {
     namespace MUD {
-      ostringstream mud_signature;
-      
-      std::string file_folder = "/home/pi/ot-br-posix/mud";
-      char iptables_file[] =  "/home/pi/ot-br-posix/mud/acl.sh";
+      constexpr Seconds MudManager::kAttachTimeout;
 
-      static otMessageQueue mq;
-      thread queueWatcher;
-
-      bool closeMQ = false;
-      
-      MudManager::MudManager(void) {
-         otbrLogInfo("Starting MUD Manager");
+      MudManager *MudManager::sMudManager = nullptr;
 
-         otMessageQueueInit(&mq);
+      MudManager::MudManager(void)
+         : MudManager(OTBR_MUD_DATA_DIR, Firewall::Create(OTBR_MUD_DATA_DIR))
+      {
+      }
 
-         otbrLogInfo("Message Queue Instanciated");
+      MudManager::MudManager(const string &aDataDirectory, Firewall *aFirewall, bool aRequireHttps)
+         : mPendingHead(0)
+         , mPendingCount(0)
+         , mNcp(nullptr)
+         , mRequireHttps(aRequireHttps)
+         , mChildTableChanged(false)
+         , mFetcher(aRequireHttps)
+         , mResolver([this](const string &aName, const MudResolver::AddressSet &aAddresses) {
+              PostWorkerTask([this, aName, aAddresses]() { mFirewall->UpdateDnsName(aName, aAddresses); });
+           })
+         , mCache(aDataDirectory + "/cache")
+         , mFirewall(aFirewall)
+         , mStore(aDataDirectory + "/state.bin")
+         , mStateChanged(false)
+         , mShouldStop(false)
+      {
+         otbrLogInfo("Starting MUD Manager");
       }
 
       MudManager::~MudManager(void) {
          this->Deinit();
+         Firewall::Destroy(mFirewall);
       }
 
-      otMessageQueue* MudManager::GetMessageQueue(void) {
-         return &mq;
+      void MudManager::Init(Ncp::ControllerOpenThread &aNcp) {
+         mNcp = &aNcp;
+         sMudManager = this;
+
+         RegisterCallbacks();
+         mNcp->RegisterResetHandler([this]() {
+            RegisterCallbacks();
+            mChildTableChanged = true;
+         });
+         mNcp->AddThreadStateChangedCallback([this](otChangedFlags aFlags) { HandleThreadStateChanged(aFlags); });
+         ScheduleSync();
+         ScheduleCounters();
+
+         Init();
       }
 
       void MudManager::Init(void) {
-         
-         otbrLogInfo("MUD Manager started");
+         otbrLogInfo("MUD Manager started (%d concurrent downloads)", OTBR_MUD_FETCH_MAX_TRANSFERS);
+
+         mCache.Load();
 
-         thread queueWatcher(&MudManager::CheckMessageQueue, this);
-         queueWatcher.detach();
+         mShouldStop = false;
+         PostWorkerTask([this]() { RestoreState(); });
+         mWorker = thread(&MudManager::RunWorker, this);
       }
 
       void MudManager::Deinit(void) {
-         otbrLogInfo("Closing Message Queue");
-         closeMQ = true;
-         queueWatcher.~thread();
-      }
-
-      void MudManager::CheckMessageQueue() {
-
-         // Define variables
-         
-         otMessage* msg;
-         
-         uint8_t  mudUrlLength;
-         uint8_t  mudIpLength;
-         char     mudUrl[60];
-         char     mudIp[41];
-
-         while (closeMQ == false) {
-            
-            if ((msg = otMessageQueueGetHead(&mq)) != nullptr) {
-               otbrLogInfo("New message in queue, dequeueing...");
-               otMessageQueueDequeue(&mq, msg);
-               otbrLogInfo("Message dequeued");
-
-               uint16_t num_bytes;
-               if ((num_bytes = otMessageRead(msg, 0, &mudUrlLength, 8)) <= 0) {
-                  otbrLogErr("Could not read message");
-                  otMessageFree(msg);  
-
-                  memset(&mudUrl, 0, sizeof mudUrl);
-                  memset(&mudIp, 0, sizeof mudIp);
-
-                  msg = nullptr;
-                  
-                  continue;
-               }
+         {
+            std::lock_guard<std::mutex> lock(mTaskMutex);
 
-               otbrLogInfo("URL Length: %d", mudUrlLength);
+            mShouldStop = true;
+            mWorkerTasks.clear();
+         }
 
-               if ((num_bytes = otMessageRead(msg, 8, &mudUrl, mudUrlLength - 1)) <= 0) {
-                  otbrLogErr("Could not read message");
-                  otMessageFree(msg);  
+         mTaskCondition.notify_one();
+         mFetcher.Clear();
+         mFetchingRequests.clear();
 
-                  memset(&mudUrl, 0, sizeof mudUrl);
-                  memset(&mudIp, 0, sizeof mudIp);
+         if (mWorker.joinable()) {
+            otbrLogInfo("Stopping MUD worker");
+            mWorker.join();
+         }
 
-                  msg = nullptr;
-                  
-                  continue;
-               }
+         if (mNcp != nullptr && mNcp->GetInstance() != nullptr) {
+            otThreadSetMudRequestCallback(mNcp->GetInstance(), nullptr, nullptr);
+         }
 
-               otbrLogInfo("URL: %s", mudUrl);
+         mPendingHead = 0;
+         mPendingCount = 0;
+      }
 
-               if ((num_bytes = otMessageRead(msg, mudUrlLength + 8, &mudIpLength, 8)) <= 0) {
-                  otbrLogErr("Could not read message");
-                  otMessageFree(msg);  
+      void MudManager::RegisterCallbacks(void) {
+         otThreadRegisterNeighborTableCallback(mNcp->GetInstance(), &MudManager::HandleNeighborTableEvent);
+         otThreadSetMudRequestCallback(mNcp->GetInstance(), &MudManager::HandleMudRequest, this);
+      }
 
-                  memset(&mudUrl, 0, sizeof mudUrl);
-                  memset(&mudIp, 0, sizeof mudIp);
+      void MudManager::HandleMudRequest(const otThreadMudRequestInfo *aInfo, void *aContext) {
+         static_cast<MudManager *>(aContext)->HandleMudRequest(*aInfo);
+      }
 
-                  msg = nullptr;
-                  
-                  continue;
-               }
+      void MudManager::HandleMudRequest(const otThreadMudRequestInfo &aInfo) {
+         // This is called from the MLE receive path, only keep a copy of the
+         // record and process it from the mainloop.
+         if (mPendingCount == OTBR_MUD_MAX_PENDING_REQUESTS) {
+            otbrLogWarning("Too many pending MUD requests, dropping %s", aInfo.mUrl);
+            ExitNow();
+         }
 
-               otbrLogInfo("Ip Length: %d", mudIpLength);
+         mPendingRequests[(mPendingHead + mPendingCount) % OTBR_MUD_MAX_PENDING_REQUESTS] = aInfo;
+         mPendingCount++;
 
-               if ((num_bytes = otMessageRead(msg, mudUrlLength + 16, &mudIp, mudIpLength)) <= 0) {
-                  otbrLogErr("Could not read message");
-                  otMessageFree(msg);  
+      exit:
+         return;
+      }
 
-                  memset(&mudUrl, 0, sizeof mudUrl);
-                  memset(&mudIp, 0, sizeof mudIp);
+      void MudManager::HandleNeighborTableEvent(otNeighborTableEvent aEvent, const otNeighborTableEntryInfo *aEntryInfo) {
+         OTBR_UNUSED_VARIABLE(aEntryInfo);
+
+         // The child table is being updated while this is called, so only take
+         // note of the change and look at the children from the mainloop.
+         switch (aEvent) {
+         case OT_NEIGHBOR_TABLE_EVENT_CHILD_ADDED:
+         case OT_NEIGHBOR_TABLE_EVENT_CHILD_REMOVED:
+         case OT_NEIGHBOR_TABLE_EVENT_CHILD_MODE_CHANGED:
+            if (sMudManager != nullptr) {
+               sMudManager->mChildTableChanged = true;
+            }
+            break;
+         default:
+            break;
+         }
+      }
 
-                  msg = nullptr;
-                  
-                  continue;
-               }
+      void MudManager::HandleThreadStateChanged(otChangedFlags aFlags) {
+         // New on-mesh prefixes make the children register new addresses.
+         if (aFlags & (OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED | OT_CHANGED_THREAD_NETDATA)) {
+            mChildTableChanged = true;
+         }
+      }
 
-               otbrLogInfo("Ip: %s", mudIp);
+      void MudManager::ScheduleSync(void) {
+         mNcp->PostTimerTask(Seconds(OTBR_MUD_DEVICE_SYNC_INTERVAL), [this]() {
+            mChildTableChanged = true;
+            ScheduleSync();
+         });
+      }
 
-               string mudUrlString = mudUrl;
-               string mudIpString = mudIp;
+      void MudManager::ScheduleCounters(void) {
+         mNcp->PostTimerTask(Seconds(OTBR_MUD_COUNTERS_INTERVAL), [this]() {
+            PostWorkerTask([this]() { UpdateCounters(); });
+            ScheduleCounters();
+         });
+      }
 
-               otbrLogWarning("MUD Url: %s", mudUrl);
-               otbrLogWarning("MUD IP: %s", mudIp);
-               otbrLogWarning("MUD IP String: %s", mudIpString.c_str());
+      void MudManager::CollectChildren(std::map<std::string, AddressSet> &aChildren) {
+         otInstance *instance;
+         uint16_t maxChildren;
 
-               otMessageFree(msg);
-               msg = nullptr;
+         VerifyOrExit(mNcp != nullptr);
 
-               otbrLogInfo("Parsing URL");
-               mudUrlString = this->ParseURL(mudUrlString);
-               otbrLogInfo("URL Parsed");
+         instance = mNcp->GetInstance();
+         maxChildren = otThreadGetMaxAllowedChildren(instance);
 
-               ostringstream mud_content;
+         for (uint16_t index = 0; index < maxChildren; index++) {
+            otChildInfo childInfo;
+            otChildIp6AddressIterator iterator = OT_CHILD_IP6_ADDRESS_ITERATOR_INIT;
+            otIp6Address address;
+            char extAddress[sizeof(childInfo.mExtAddress.m8) * 2 + 1];
+            char addressString[INET6_ADDRSTRLEN];
 
-               if (!this->RetrieveFile(&mud_content, mudUrlString)) {
-                  otbrLogErr("Error processing MUD file");
+            if (otThreadGetChildInfoByIndex(instance, index, &childInfo) != OT_ERROR_NONE ||
+                childInfo.mIsStateRestoring) {
+               continue;
+            }
 
-                  memset(&mudUrl, 0, sizeof mudUrl);
-                  memset(&mudIp, 0, sizeof mudIp);
-               }
-               
-               MUDFile mf;
-               
-               if (!this->ParseMUDFile(&mf, &mud_content, mudIpString)) {
-                  otbrLogErr("Error processing MUD file");
-
-                  memset(&mudUrl, 0, sizeof mudUrl);
-                  memset(&mudIp, 0, sizeof mudIp);
-               }
+            Utils::Bytes2Hex(childInfo.mExtAddress.m8, sizeof(childInfo.mExtAddress.m8), extAddress);
 
-               if (!this->ImplementMUDfile(&mf)) {
-                  otbrLogErr("Error processing MUD file");
+            AddressSet &addresses = aChildren[extAddress];
 
-                  memset(&mudUrl, 0, sizeof mudUrl);
-                  memset(&mudIp, 0, sizeof mudIp);
-               }
-               
-               otbrLogInfo("MUD File successfully converted");
-   
-               memset(&mudUrl, 0, sizeof mudUrl);
-               memset(&mudIp, 0, sizeof mudIp);              
+            while (otThreadGetChildNextIp6Address(instance, index, &iterator, &address) == OT_ERROR_NONE) {
+               inet_ntop(AF_INET6, address.mFields.m8, addressString, sizeof(addressString));
+               addresses.insert(addressString);
             }
-
-            sleep(1);	
          }
+
+      exit:
+         return;
       }
 
-      /**
-       * Create a valid MUD URL that cURL can use
-       * @param url A MUD URL
-       * 
-       * @returns A valid MUD URL
-      */
-      string MudManager::ParseURL(string url)
-      {
-         if (url.length() == 0) {
-            return "";
+      void MudManager::Update(MainloopContext &aMainloop) {
+         // The OpenThread core delivers MUD requests and updates the child table
+         // while processing the mainloop, wake up immediately to handle them.
+         if (mPendingCount > 0 || mChildTableChanged) {
+            aMainloop.mTimeout = ToTimeval(Microseconds::zero());
          }
 
-         // Check for HTTP://, if present replace with HTTPS
-         if (!strcasecmp(url.substr(0, 7).c_str(), "http://"))
-         {
-            url.insert(4, "s");
-         }
+         mFetcher.Update(aMainloop);
+         mResolver.Update(aMainloop);
+      }
 
-         // If not HTTP://, check for HTTPS:// present. If not, append it
-         else if (strcasecmp(url.substr(0, 8).c_str(), "https://"))
-         {
-            url.insert(0, "https://");
+      void MudManager::Process(const MainloopContext &aMainloop) {
+         ProcessPendingRequests();
+         mFetcher.Process();
+         mResolver.Process(aMainloop);
+
+         if (mChildTableChanged) {
+            std::map<std::string, AddressSet> children;
+
+            mChildTableChanged = false;
+            CollectChildren(children);
+            PostWorkerTask([this, children]() { UpdateDevices(children); });
          }
+      }
 
-         return url;
+      void MudManager::ProcessPendingRequests(void) {
+         while (mPendingCount > 0) {
+            MudRequest request;
+
+            ReadRequest(mPendingRequests[mPendingHead], request);
+            mPendingHead = (mPendingHead + 1) % OTBR_MUD_MAX_PENDING_REQUESTS;
+            mPendingCount--;
+
+            FetchFile(request);
+         }
       }
 
+      void MudManager::ReadRequest(const otThreadMudRequestInfo &aInfo, MudRequest &aRequest) {
+         char extAddress[sizeof(aInfo.mExtAddress.m8) * 2 + 1];
+         char address[INET6_ADDRSTRLEN];
 
-      bool MudManager::RetrieveFile(ostringstream *target, string url)
-      {
-         // Start file download
-         otbrLogInfo("Starting download of: %s", url.c_str());
+         Utils::Bytes2Hex(aInfo.mExtAddress.m8, sizeof(aInfo.mExtAddress.m8), extAddress);
+         inet_ntop(AF_INET6, aInfo.mPeerAddress.mFields.m8, address, sizeof(address));
 
-         // Create buffer writer for output to variable
-         curl_ios<ostringstream> writer(*target);
-    
-         curl_easy easy(writer);
-         easy.add<CURLOPT_URL>(url.c_str());
-         easy.add<CURLOPT_FOLLOWLOCATION>(1L);
+         aRequest.mUrl.assign(aInfo.mUrl, aInfo.mUrlLength);
+         aRequest.mIp = address;
+         aRequest.mExtAddress = extAddress;
 
-         try
-         {
-            otbrLogInfo("Downloading file");
+         otbrLogInfo("MUD request from %s (%s): %s", extAddress, address, aRequest.mUrl.c_str());
+      }
+
+      void MudManager::FetchFile(MudRequest &aRequest) {
+         MudCache::Entry entry;
+         bool cached;
 
-            easy.perform();
+         aRequest.mFileUrl = mRequireHttps ? this->ParseURL(aRequest.mUrl) : aRequest.mUrl;
 
-            otbrLogInfo("Download succeeded!");
+         // Devices sharing a MUD URL wait for the download which is already running.
+         auto fetching = mFetchingRequests.find(aRequest.mFileUrl);
 
-            return true;
+         if (fetching != mFetchingRequests.end()) {
+            fetching->second.push_back(std::move(aRequest));
+            return;
          }
-         catch (curl_easy_exception &error)
-         {
-            otbrLogErr("Error: %s", error.what());
 
-            return false;
+         cached = mCache.Lookup(aRequest.mFileUrl, entry);
+
+         if (cached && MudCache::IsFresh(entry)) {
+            otbrLogInfo("Using cached MUD file %s", aRequest.mFileUrl.c_str());
+            aRequest.mContent = std::move(entry.mContent);
+            aRequest.mContentHash = std::move(entry.mContentHash);
+            HandleFileFetched(aRequest);
+            return;
          }
+
+         string url = aRequest.mFileUrl;
+         Timepoint start = Clock::now();
+
+         mFetchingRequests[url].push_back(std::move(aRequest));
+         mFetcher.Fetch(url, cached ? entry.mEtag : "", cached ? entry.mLastModified : "",
+                        [this, url, start](MudFetcher::FetchResult &aResult) {
+                           RecordLatency(&MudStatistics::mFetchLatency, start);
+                           HandleFetchResult(url, aResult);
+                        });
       }
 
-      bool MudManager::ParseMUDFile(MUDFile *trgt, ostringstream* src, string ip)
-      {
-         Document mudFileParsed;
-         // Parse the JSON into an object
-         mudFileParsed.Parse(src->str().c_str());
+      void MudManager::HandleFetchResult(const string &aUrl, MudFetcher::FetchResult &aResult) {
+         MudCache::Entry entry;
+         vector<MudRequest> requests;
+         bool found = true;
+         auto fetching = mFetchingRequests.find(aUrl);
 
-         // Throw error if parsing did not succeed
-         if (mudFileParsed.HasParseError()) {
-            return false;
+         if (fetching != mFetchingRequests.end()) {
+            requests = std::move(fetching->second);
+            mFetchingRequests.erase(fetching);
          }
 
-         // Convert JSON Object to internal object
-         Value& mud = mudFileParsed["ietf-mud:mud"];
+         if (aResult.mStatus == 200) {
+            mCache.Store(aUrl, aResult.mContent, aResult.mEtag, aResult.mLastModified, entry);
+         } else if (aResult.mStatus == 304) {
+            found = mCache.Revalidate(aUrl, entry);
+         } else {
+            // Keep protecting the devices with the outdated MUD file rather than none at all.
+            found = mCache.Lookup(aUrl, entry);
 
-         trgt->device_ip = ip.c_str();
-         trgt->mud_version = mud["mud-version"].GetInt();
-         trgt->mud_url = mud["mud-url"].GetString();
-         trgt->last_update = mud["last-update"].GetString();
-         trgt->mud_signature = mud["mud-signature"].GetString();
-         trgt->cache_validity = mud["cache-validity"].GetInt();
-         trgt->is_supported = mud["is-supported"].GetBool();
-         trgt->systeminfo = mud["systeminfo"].GetString();
-         trgt->mfg_name = mud["mfg-name"].GetString();
-         trgt->model_name = mud["model-name"].GetString();
-         trgt->firmware_rev = mud["firmware-rev"].GetString();
-         trgt->documentation = mud["documentation"].GetString();
-         trgt->extensions = mud["extensions"].GetString();
+            if (found) {
+               otbrLogWarning("Error retrieving MUD file %s, using outdated cached copy", aUrl.c_str());
+            }
+         }
 
-         Value& from = mud["from-device-policy"]["access-lists"]["access-list"];
-         for (auto& f : from.GetArray()) {
-            trgt->from_device_policies.push_back(f["name"].GetString());
-         } 
+         if (!found) {
+            otbrLogErr("Error retrieving MUD file %s", aUrl.c_str());
+            return;
+         }
 
-         Value& to = mud["to-device-policy"]["access-lists"]["access-list"];
-         for (auto& t : to.GetArray()) {
-            trgt->to_device_policies.push_back(t["name"].GetString());
-         } 
+         for (MudRequest &request : requests) {
+            request.mContent = entry.mContent;
+            request.mContentHash = entry.mContentHash;
+            HandleFileFetched(request);
+         }
+      }
 
-         Value& acls = mudFileParsed["ietf-access-control-list:acls"]["acl"];
+      void MudManager::HandleFileFetched(MudRequest &aRequest) {
+         std::map<std::string, AddressSet> children;
 
-         for (auto& acl : acls.GetArray()) {
-            ACL mACL = ACL();
-            mACL.name = acl["name"].GetString();
-            otbrLogInfo("Processing ACL: %s", mACL.name);
-            mACL.type = acl["type"].GetString();
+         CollectChildren(children);
 
-            Value& aces = acl["aces"]["ace"];
+         aRequest.mAddresses = std::move(children[aRequest.mExtAddress]);
+         aRequest.mAddresses.insert(aRequest.mIp);
 
-            for (auto& ace : aces.GetArray()) {
-               ACE mACE = ACE();
+         PostWorkerTask([this, aRequest]() { ProcessRequest(aRequest); });
+      }
 
-               mACE.name = ace["name"].GetString();
-               mACE.forwarding = ace["actions"]["forwarding"].GetString();
+      void MudManager::PostWorkerTask(WorkerTask aTask) {
+         size_t depth;
 
-               otbrLogInfo("Processing ACE: %s", mACE.name);
+         {
+            std::lock_guard<std::mutex> lock(mTaskMutex);
 
-               Match mMatch = Match();
+            VerifyOrExit(!mShouldStop);
+            mWorkerTasks.push_back(std::move(aTask));
+            depth = mWorkerTasks.size();
+         }
 
-               Value& matches = ace["matches"];
+         mTaskCondition.notify_one();
 
-               if (matches.HasMember("ietf-mud:mud")) {
-                  Value& mud = matches["ietf-mud:mud"];
+         {
+            std::lock_guard<std::mutex> lock(mStatisticsMutex);
 
-                  if (mud.HasMember("controller")) {
-                     mMatch.controller = mud["controller"].GetString();
-                  }
-               }
+            mStatistics.mQueueDepth.Record(depth);
+         }
 
-               if (matches.HasMember("ipv6")) {
-                  Value& ipv6 = matches["ipv6"];
-                  if (ipv6.HasMember("ietf-acldns:src-dnsname")) {
-                     mMatch.src_dnsname = ipv6["ietf-acldns:src-dnsname"].GetString();
-                  }  
-                  if (ipv6.HasMember("ietf-acldns:dst-dnsname")) {
-                     mMatch.dst_dnsname = ipv6["ietf-acldns:dst-dnsname"].GetString();
-                  }
+      exit:
+         return;
+      }
 
-                  mMatch.protocol = ipv6["protocol"].GetInt();
+      void MudManager::RunWorker(void) {
+         Timepoint saveTime;
+
+         while (true) {
+            WorkerTask task;
+            bool wasChanged;
+
+            // A burst of tasks changing the state rewrites the state file once.
+            if (mStateChanged && Clock::now() >= saveTime) {
+               mStateChanged = false;
+               SaveState();
+            }
+
+            {
+               std::unique_lock<std::mutex> lock(mTaskMutex);
+               auto ready = [this]() { return mShouldStop || !mWorkerTasks.empty(); };
+
+               if (mStateChanged) {
+                  mTaskCondition.wait_until(lock, saveTime, ready);
+               } else {
+                  mTaskCondition.wait(lock, ready);
                }
 
-               if (matches.HasMember("ipv4")) {
-                  Value& ipv4 = matches["ipv4"];
-                  if (ipv4.HasMember("ietf-acldns:src-dnsname")) {
-                     mMatch.src_dnsname = ipv4["ietf-acldns:src-dnsname"].GetString();
-                  }
-                  if (ipv4.HasMember("ietf-acldns:dst-dnsname")) {
-                     mMatch.dst_dnsname = ipv4["ietf-acldns:dst-dnsname"].GetString();
-                  }
+               if (mShouldStop) {
+                  break;
+               }
 
-                  mMatch.protocol = ipv4["protocol"].GetInt();
+               // The save delay elapsed without any task.
+               if (mWorkerTasks.empty()) {
+                  continue;
                }
 
-               if (matches.HasMember("tcp")) {
-                  Value& tcp = matches["tcp"];
+               task = std::move(mWorkerTasks.front());
+               mWorkerTasks.pop_front();
+            }
 
-                  if (tcp.HasMember("ietf-mud:direction-initiated")) {
-                     mMatch.direction_initiated = tcp["ietf-mud:direction-initiated"].GetString();
-                  }
+            wasChanged = mStateChanged;
+            task();
 
-                  if (tcp.HasMember("source-port")) {
-                     Value& src = tcp["source-port"];
+            if (mStateChanged && !wasChanged) {
+               saveTime = Clock::now() + Milliseconds(OTBR_MUD_STATE_SAVE_DELAY);
+            }
+         }
 
-                     if (src.HasMember("operator")) {
-                        mMatch.src_op = src["operator"].GetString();
-                     }
+         if (mStateChanged) {
+            mStateChanged = false;
+            SaveState();
+         }
+      }
 
-                     if (src.HasMember("port")) {
-                        mMatch.src_port = src["port"].GetInt();
-                     }
-                     
-                  }
+      void MudManager::ProcessRequest(const MudRequest &aRequest) {
+         auto policy = mPolicies.find(aRequest.mContentHash);
 
-                  if (tcp.HasMember("destination-port")) {
-                     Value& dst = tcp["destination-port"];
+         // Devices using the same MUD file share the policy, only the first one
+         // pays for parsing the file and installing the chains.
+         if (policy == mPolicies.end()) {
+            MudFile mudFile;
+            Policy compiled;
+            Timepoint start = Clock::now();
+            otbrError error = MudParser::Parse(aRequest.mContent, mudFile);
 
-                     if (dst.HasMember("operator")) {
-                        mMatch.dst_op = dst["operator"].GetString();
-                     }
+            RecordLatency(&MudStatistics::mParseLatency, start);
 
-                     if (dst.HasMember("port")) {
-                        mMatch.dst_port = dst["port"].GetInt();
-                     }
-                     
-                  }
-               }
+            if (error != OTBR_ERROR_NONE) {
+               otbrLogErr("Error processing MUD file %s", aRequest.mFileUrl.c_str());
+               return;
+            }
 
-               if (matches.HasMember("udp")) {
-                  Value& udp = matches["udp"];
+            mCache.SetFileInfo(aRequest.mFileUrl, aRequest.mContentHash, mudFile.mCacheValidity, mudFile.mLastUpdate);
 
-                  if (udp.HasMember("ietf-mud:direction-initiated")) {
-                     mMatch.direction_initiated = udp["ietf-mud:direction-initiated"].GetString();
-                  }
+            start = Clock::now();
+            this->CompilePolicy(mudFile, aRequest.mContentHash, compiled);
+            RecordLatency(&MudStatistics::mCompileLatency, start);
 
-                  if (udp.HasMember("source-port")) {
-                     Value& src = udp["source-port"];
+            start = Clock::now();
+            bool installed = mFirewall->InstallPolicy(compiled);
+            RecordLatency(&MudStatistics::mInstallLatency, start);
 
-                     if (src.HasMember("operator")) {
-                        mMatch.src_op = src["operator"].GetString();
-                     }
+            if (!installed) {
+               otbrLogErr("Error installing MUD policy %s", compiled.mName.c_str());
+               return;
+            }
 
-                     if (src.HasMember("port")) {
-                        mMatch.src_port = src["port"].GetInt();
-                     }
-                     
-                  }
+            WatchDnsNames(compiled, true);
+            mPolicies.emplace(aRequest.mContentHash, std::move(compiled));
+            mStateChanged = true;
+         }
 
-                  if (udp.HasMember("destination-port")) {
-                     Value& dst = udp["destination-port"];
+         auto device = mDevices.find(aRequest.mExtAddress);
 
-                     if (dst.HasMember("operator")) {
-                        mMatch.dst_op = dst["operator"].GetString();
-                     }
+         // A device announcing another MUD file leaves its former policy.
+         if (device != mDevices.end() && device->second.mContentHash != aRequest.mContentHash) {
+            RemoveDevice(aRequest.mExtAddress);
+            device = mDevices.end();
+         }
 
-                     if (dst.HasMember("port")) {
-                        mMatch.dst_port = dst["port"].GetInt();
-                     }
-                     
-                  }
-               } 
+         if (device == mDevices.end()) {
+            device = mDevices.emplace(aRequest.mExtAddress, Device()).first;
+            device->second.mContentHash = aRequest.mContentHash;
+            device->second.mBindTime = Clock::now();
+            mStateChanged = true;
+         }
 
-               if (matches.HasMember("icmpv6")) {
-                  Value& icmp = matches["icmpv6"];
+         UpdateDevice(device->second, aRequest.mAddresses);
 
-                  if (icmp.HasMember("ietf-mud:direction-initiated")) {
-                     mMatch.direction_initiated = icmp["ietf-mud:direction-initiated"].GetString();
-                  }
+         otbrLogInfo("MUD File successfully converted");
+      }
 
-                  if (icmp.HasMember("source-port")) {
-                     Value& src = icmp["source-port"];
+      void MudManager::UpdateDevice(Device &aDevice, const AddressSet &aAddresses) {
+         const Policy &policy = mPolicies[aDevice.mContentHash];
+         AddressSet bound;
 
-                     if (src.HasMember("operator")) {
-                        mMatch.src_op = src["operator"].GetString();
-                     }
+         for (const std::string &address : aDevice.mAddresses) {
+            if (aAddresses.count(address) == 0) {
+               mFirewall->UnbindDevice(policy, address);
+               aDevice.mReadings.erase(address);
+            } else {
+               bound.insert(address);
+            }
+         }
 
-                     if (src.HasMember("port")) {
-                        mMatch.src_port = src["port"].GetInt();
-                     }
-                     
-                  }
+         for (const std::string &address : aAddresses) {
+            if (bound.count(address) != 0) {
+               continue;
+            }
+
+            if (mFirewall->BindDevice(policy, address)) {
+               bound.insert(address);
+            } else {
+               otbrLogErr("Error binding device %s to MUD policy %s", address.c_str(), policy.mName.c_str());
+            }
+         }
 
-                  if (icmp.HasMember("destination-port")) {
-                     Value& dst = icmp["destination-port"];
+         if (bound != aDevice.mAddresses) {
+            aDevice.mAddresses = std::move(bound);
+            mStateChanged = true;
+         }
+      }
 
-                     if (dst.HasMember("operator")) {
-                        mMatch.dst_op = dst["operator"].GetString();
-                     }
+      void MudManager::UpdateDevices(const std::map<std::string, AddressSet> &aChildren) {
+         Timepoint now = Clock::now();
+         auto device = mDevices.begin();
 
-                     if (dst.HasMember("port")) {
-                        mMatch.dst_port = dst["port"].GetInt();
-                     }
-                     
-                  }
-               } 
+         while (device != mDevices.end()) {
+            auto child = aChildren.find(device->first);
+            auto current = device++;
 
-               mACE.matches = mMatch;
-               mACL.aces.push_back(mACE);
-  
+            if (child != aChildren.end()) {
+               current->second.mAttached = true;
+               UpdateDevice(current->second, child->second);
+            } else if (current->second.mAttached || now - current->second.mBindTime >= kAttachTimeout) {
+               // The child left or never attached to this router.
+               RemoveDevice(current->first);
             }
+         }
+      }
 
-            otbrLogInfo("ACL: %s | ACE Count: %d", mACL.name, mACL.aces.size());
+      void MudManager::RemoveDevice(const std::string &aExtAddress) {
+         auto device = mDevices.find(aExtAddress);
+         std::string contentHash;
+         bool inUse = false;
 
-            for (const char* a : trgt->from_device_policies) {
-               if ( strcmp(a, mACL.name) == 0 ) {
-                  otbrLogInfo("Adding from device policy: %s", mACL.name);
-                  trgt->from_device_acls.push_back(mACL);
-               }
-            }
+         VerifyOrExit(device != mDevices.end());
+
+         otbrLogInfo("Removing MUD device %s", aExtAddress.c_str());
+
+         contentHash = device->second.mContentHash;
+         UpdateDevice(device->second, AddressSet());
+         mDevices.erase(device);
+         mStateChanged = true;
+
+         for (const auto &other : mDevices) {
+            inUse = inUse || (other.second.mContentHash == contentHash);
+         }
+
+         // Stale chains slow down forwarding, drop the policy with its last device.
+         if (!inUse) {
+            mFirewall->RemovePolicy(mPolicies[contentHash]);
+            WatchDnsNames(mPolicies[contentHash], false);
+            mPolicies.erase(contentHash);
+            mRuleCounters.erase(contentHash);
+         }
 
-            for (const char* a : trgt->to_device_policies) {
-               if ( strcmp(a, mACL.name) == 0 ) {
-                  otbrLogInfo("Adding to device policy: %s", mACL.name);
-                  trgt->to_device_acls.push_back(mACL);
+      exit:
+         return;
+      }
+
+      void MudManager::WatchDnsNames(const Policy &aPolicy, bool aWatch) {
+         std::set<std::string> names = aPolicy.GetDnsNames();
+
+         VerifyOrExit(!names.empty());
+
+         // The resolver lives on the mainloop thread.
+         mTaskRunner.Post([this, names, aWatch]() {
+            for (const std::string &name : names) {
+               if (aWatch) {
+                  mResolver.Watch(name);
+               } else {
+                  mResolver.Unwatch(name);
                }
             }
+         });
 
-            
-         }
-
-         otbrLogInfo("Converted MUD File to MUD Struct.");
-
-         otbrLogInfo("Incoming ACLs: %d", trgt->to_device_acls.size());
-         otbrLogInfo("Incoming Policies: %d", trgt->to_device_policies.size());
-
-         otbrLogInfo("Outgoing ACLs: %d", trgt->from_device_acls.size());
-         otbrLogInfo("Outgoing Policies: %d", trgt->from_device_policies.size());
-
-         otbrLogInfo("Finished creating MUD Structure");
-
-         return true;
-      }
-
-      bool MudManager::ImplementMUDfile(MUDFile *mf) {
-         // Check if folder exists for iptables
-         struct stat statbuf; 
-         int isDir = 0; 
-
-         if (stat(file_folder.c_str(), &statbuf) == 0) { 
-            if (S_ISDIR(statbuf.st_mode)) { 
-               isDir = 1; 
-            } 
-         }
-
-         if (isDir == 0) {
-            otbrLogInfo("ACL folder does not exist");
-
-            if (!mkdir(file_folder.c_str(), 0777))
-               otbrLogInfo("Directory created");
-            else {
-               otbrLogInfo("Unable to create directory");
-               return false;
-            }    
-         }
-
-         otbrLogInfo("Folder %s exists!", file_folder.c_str());
-
-         otbrLogInfo("Creating ip6tables file");
-
-         string device_ip = mf->device_ip;
-         string device_ip_stripped = device_ip;
-         device_ip_stripped.erase(std::remove(device_ip_stripped.begin(), device_ip_stripped.end(), ':'), device_ip_stripped.end());
-         
-         string policy = this->RandomPolicy(20);
-        
-         string policy_name_in = policy + "_in";
-         string policy_name_out = policy + "_out";
-         string file_name = device_ip_stripped + ".sh";
-         string file_path = file_folder + "/" + file_name;
-
-         otbrLogWarning("File path: %s", file_path.c_str());
-
-         // struct stat fileBuffer;   
-         // if (stat(file_path.c_str(), &fileBuffer) == 0) {
-         //    SystemUtils::ExecuteCommand("bash %s down", file_path.c_str());
-         // }
-
-         std::ofstream outfile (file_path);
-
-         outfile << "#!/bin/bash" << endl;
-         outfile << endl;
-         outfile << "IP=" << device_ip << endl;
-         outfile << "POLICY_IN=" << policy_name_in << endl;
-         outfile << "POLICY_OUT=" << policy_name_out << endl;
-         outfile << endl;
-         outfile << "if [[ $1 == \"down\" ]]; then" << endl;
-         outfile << endl;
-         outfile << "ip6tables -D FORWARD -d $IP -j $POLICY_IN" << endl;
-         outfile << "ip6tables -F $POLICY_IN" << endl;
-         outfile << "ip6tables -X $POLICY_IN" << endl;
-         outfile << endl;
-         outfile << "ip6tables -D FORWARD -s $IP -j $POLICY_OUT" << endl;
-         outfile << "ip6tables -F $POLICY_OUT" << endl;
-         outfile << "ip6tables -X $POLICY_OUT" << endl;
-         outfile << endl;
-         outfile << "fi" << endl;
-         outfile << endl;
-         outfile << "if [[ $1 == \"up\" ]]; then" << endl;
-         outfile << endl;
-         outfile << "ip6tables -N $POLICY_IN" << endl;
-         outfile << "ip6tables -N $POLICY_OUT" << endl;
-
-         for (ACL a : mf->from_device_acls) {
-            outfile << endl;
-            outfile << "# ACL: " << a.name << " | Type: " << a.type << endl;
-            for (ACE e : a.aces) {
-               outfile << "## ACE: " << e.name << endl;
-               ostringstream line;
-               line << "ip6tables -A $POLICY_OUT";
-
-               if (e.matches.protocol == 1) {
-                  line << " -p tcp";
-               } else if (e.matches.protocol == 6) {
-                  line << " -p tcp";
-               } else if (e.matches.protocol == 17) {
-                  line << " -p udp";
-               } else if (e.matches.protocol == 58) {
-                  line << " -p icmpv6";
-               }
+      exit:
+         return;
+      }
 
-               if ((e.matches.src_dnsname != NULL) && (strlen(e.matches.src_dnsname) > 0)) {
-                  line << " -s " << e.matches.src_dnsname;
-               }
+      void MudManager::RestoreState(void) {
+         MudStore::PolicyMap policies;
+         MudStore::BindingMap bindings;
+         std::vector<Policy> installed;
+         std::map<std::string, AddressSet> devices;
+         Timepoint now = Clock::now();
 
-               if ((e.matches.dst_dnsname != NULL) && (strlen(e.matches.dst_dnsname) > 0)) {
-                  line << " -d " << e.matches.dst_dnsname;
-               }
+         VerifyOrExit(mStore.Load(policies, bindings));
 
-               if (e.matches.dst_port > 0) {
-                  line << " --dport " << e.matches.dst_port;
-               }
+         for (const auto &policy : policies) {
+            installed.push_back(policy.second);
+         }
 
-               if (e.matches.src_port > 0) {
-                  line << " --sport " << e.matches.src_port;
-               }
+         for (const auto &binding : bindings) {
+            const Policy &policy = policies[binding.second.mContentHash];
 
-               line << " -j ACCEPT";
+            devices[policy.mName].insert(binding.second.mAddresses.begin(), binding.second.mAddresses.end());
+         }
 
-               outfile << line.str() << endl;
-            }
+         if (!mFirewall->Restore(installed, devices)) {
+            otbrLogErr("Error restoring MUD policies, waiting for the devices to re-attach");
+            ExitNow();
          }
 
-         otbrLogInfo("Finished Creating From Device ACLs");
-
-         otbrLogInfo("To Device ACLs: %d", mf->to_device_acls.size());
-
-         for (ACL a : mf->to_device_acls) {
-            outfile << endl;
-            outfile << "# ACL: " << a.name << " | Type: " << a.type << endl;
-            otbrLogInfo("To Device ACEs: %d", a.aces.size());
-            for (ACE e : a.aces) {
-               outfile << "## ACE: " << e.name << endl;
-               ostringstream line;
-               line << "ip6tables -A $POLICY_IN";
-               
-               if (e.matches.protocol == 1) {
-                  line << " -p tcp";
-               } else if (e.matches.protocol == 6) {
-                  line << " -p tcp";
-               } else if (e.matches.protocol == 17) {
-                  line << " -p udp";
-               } else if (e.matches.protocol == 58) {
-                  line << " -p icmpv6";
-               }
+         // The devices are kept until the next child table synchronization,
+         // and evicted if they do not show up as children in time.
+         for (auto &binding : bindings) {
+            Device &device = mDevices[binding.first];
 
-               if ((e.matches.src_dnsname != NULL) && (strlen(e.matches.src_dnsname) > 0)) {
-                  line << " -s " << e.matches.src_dnsname;
-               }
+            device.mContentHash = binding.second.mContentHash;
+            device.mAddresses = std::move(binding.second.mAddresses);
+            device.mBindTime = now;
+         }
 
-               if ((e.matches.dst_dnsname != NULL) && (strlen(e.matches.dst_dnsname) > 0)) {
-                  line << " -d " << e.matches.dst_dnsname;
-               }
+         for (auto &policy : policies) {
+            WatchDnsNames(policy.second, true);
+            mPolicies.emplace(policy.first, std::move(policy.second));
+         }
+
+         otbrLogInfo("Restored %zu MUD policies and %zu devices", mPolicies.size(), mDevices.size());
+
+      exit:
+         return;
+      }
+
+      void MudManager::SaveState(void) {
+         MudStore::BindingMap bindings;
+
+         for (const auto &device : mDevices) {
+            MudStore::Binding &binding = bindings[device.first];
+
+            binding.mContentHash = device.second.mContentHash;
+            binding.mAddresses = device.second.mAddresses;
+         }
+
+         mStore.Save(mPolicies, bindings);
+      }
 
-               if (e.matches.dst_port > 0) {
-                  line << " --dport " << e.matches.dst_port;
+      void MudManager::UpdateCounters(void) {
+         std::vector<MudStatistics::Device> devices;
+         std::vector<MudStatistics::Rule> rules;
+
+         for (const auto &entry : mPolicies) {
+            const Policy &policy = entry.second;
+            std::vector<TrafficCounters> ruleReadings;
+            std::map<std::string, TrafficCounters> deviceReadings;
+            std::vector<RuleCounters> &ruleCounters = mRuleCounters[entry.first];
+
+            if (!mFirewall->GetCounters(policy, ruleReadings, deviceReadings)) {
+               otbrLogWarning("Error reading the counters of MUD policy %s", policy.mName.c_str());
+               continue;
+            }
+
+            ruleCounters.resize(policy.mRules.size());
+
+            for (size_t index = 0; index < policy.mRules.size(); index++) {
+               MudStatistics::Rule rule;
+
+               ruleCounters[index].mCounters.Accumulate(ruleReadings[index], ruleCounters[index].mReading);
+
+               rule.mPolicyName = policy.mName;
+               rule.mAclName = policy.mRules[index].mAclName;
+               rule.mAceName = policy.mRules[index].mAceName;
+               rule.mDirection = policy.mRules[index].mDirection;
+               rule.mCounters = ruleCounters[index].mCounters;
+               rules.push_back(std::move(rule));
+            }
+
+            for (auto &device : mDevices) {
+               MudStatistics::Device statistics;
+
+               if (device.second.mContentHash != entry.first) {
+                  continue;
                }
 
-               if (e.matches.src_port > 0) {
-                  line << " --sport " << e.matches.src_port;
+               for (const std::string &address : device.second.mAddresses) {
+                  auto reading = deviceReadings.find(address);
+
+                  if (reading != deviceReadings.end()) {
+                     device.second.mCounters.Accumulate(reading->second, device.second.mReadings[address]);
+                  }
                }
 
-               line << " -j ACCEPT";
-               outfile << line.str() << endl;
+               statistics.mExtAddress = device.first;
+               statistics.mPolicyName = policy.mName;
+               statistics.mUrl = policy.mUrl;
+               statistics.mCounters = device.second.mCounters;
+               devices.push_back(std::move(statistics));
             }
          }
-         outfile << endl;
-         outfile << "ip6tables -A $POLICY_IN -j LOG --log-prefix \"MUD-Dropped: \" --log-level 4" << endl;
-         outfile << "ip6tables -A $POLICY_OUT -j LOG --log-prefix \"MUD-Dropped: \" --log-level 4" << endl;
-         outfile << endl;
-         outfile << "ip6tables -A $POLICY_IN -j DROP" << endl;
-         outfile << "ip6tables -A $POLICY_OUT -j DROP" << endl;
-         outfile << endl;
-         outfile << "ip6tables -I FORWARD 1 -d $IP -j $POLICY_IN" << endl;
-         outfile << "ip6tables -I FORWARD 1 -s $IP -j $POLICY_OUT" << endl;
-         outfile << endl;
-         outfile << "fi" << endl;
 
-         otbrLogInfo("Finished creating IpTables");
+         std::lock_guard<std::mutex> lock(mStatisticsMutex);
 
-         outfile.close();
+         mStatistics.mDevices = std::move(devices);
+         mStatistics.mRules = std::move(rules);
+      }
 
-         otbrLogInfo("File Closed");
+      void MudManager::RecordLatency(Histogram MudStatistics::*aHistogram, Timepoint aStart) {
+         uint64_t latency = std::chrono::duration_cast<Microseconds>(Clock::now() - aStart).count();
+         std::lock_guard<std::mutex> lock(mStatisticsMutex);
 
-         SystemUtils::ExecuteCommand("chmod +x %s", file_path.c_str());
-         // SystemUtils::ExecuteCommand("bash %s up", file_path.c_str());
+         (mStatistics.*aHistogram).Record(latency);
+      }
 
-         otbrLogInfo("Executed file");
+      void MudManager::GetStatistics(MudStatistics &aStatistics) const {
+         std::lock_guard<std::mutex> lock(mStatisticsMutex);
 
-         return true;
+         aStatistics = mStatistics;
       }
 
-      string MudManager::RandomPolicy(int length) {
-         static const char AlphaNumeric[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-                                "abcdefghijklmnopqrstuvwxyz";
-         string r = "";
+      /**
+       * Create a valid MUD URL that cURL can use
+       * @param url A MUD URL
+       * 
+       * @returns A valid MUD URL
+      */
+      string MudManager::ParseURL(string url)
+      {
+         if (url.length() == 0) {
+            return "";
+         }
 
-         for (int i = 0 ; i < length ; i++) {
-            r += AlphaNumeric[rand() % (sizeof(AlphaNumeric) - 1) ];
+         // Check for HTTP://, if present replace with HTTPS
+         if (!strcasecmp(url.substr(0, 7).c_str(), "http://"))
+         {
+            url.insert(4, "s");
+         }
+
+         // If not HTTP://, check for HTTPS:// present. If not, append it
+         else if (strcasecmp(url.substr(0, 8).c_str(), "https://"))
+         {
+            url.insert(0, "https://");
          }
 
-         return r;
+         return url;
+      }
+
+
+      void MudManager::CompilePolicy(const MudFile &aMudFile, const string &aContentHash, Policy &aPolicy) {
+         auto compileAcls = [&aMudFile, &aPolicy](const vector<string> &aAclNames, PolicyRule::Direction aDirection) {
+            for (const string &name : aAclNames) {
+               const MudAcl *acl = aMudFile.FindAcl(name);
+
+               for (const MudAce &ace : acl->mAces) {
+                  PolicyRule rule;
+
+                  // Anything not accepted is dropped at the end of the chains.
+                  if (ace.mForwarding != MudAce::kForwardingAccept) {
+                     continue;
+                  }
+
+                  // Matches the firewall cannot enforce would accept more traffic than the MUD file allows.
+                  if (ace.mHasUnsupportedMatch || ace.mIpVersion == 4 || !ace.mController.empty()) {
+                     otbrLogWarning("Ignoring ACE %s of ACL %s: unsupported matches", ace.mName.c_str(),
+                                    acl->mName.c_str());
+                     continue;
+                  }
+
+                  rule.mDirection = aDirection;
+
+                  // Only the side named by direction-initiated may open connections, the other side may only
+                  // reply to them.
+                  if (ace.mDirectionInitiated.empty()) {
+                     rule.mConnection = PolicyRule::kAnyConnection;
+                  } else if ((ace.mDirectionInitiated == "from-device") == (aDirection == PolicyRule::kFromDevice)) {
+                     rule.mConnection = PolicyRule::kOriginal;
+                  } else {
+                     rule.mConnection = PolicyRule::kReply;
+                  }
+
+                  rule.mAclName = acl->mName;
+                  rule.mAceName = ace.mName;
+                  rule.mProtocol = ace.mProtocol;
+                  rule.mSrcDnsName = ace.mSrcDnsName;
+                  rule.mDstDnsName = ace.mDstDnsName;
+                  rule.mSrcPort = ace.mSrcPort;
+                  rule.mDstPort = ace.mDstPort;
+
+                  aPolicy.mRules.push_back(std::move(rule));
+               }
+            }
+         };
+
+         // The policy name must fit in an ip6tables chain name with its suffix.
+         aPolicy.mName = "mud_" + aContentHash.substr(0, 16);
+         aPolicy.mUrl = aMudFile.mUrl;
+         aPolicy.mRules.clear();
+
+         compileAcls(aMudFile.mFromDevicePolicies, PolicyRule::kFromDevice);
+         compileAcls(aMudFile.mToDevicePolicies, PolicyRule::kToDevice);
+
+         otbrLogInfo("Compiled MUD policy %s with %zu rules", aPolicy.mName.c_str(), aPolicy.mRules.size());
       }
     }
  }
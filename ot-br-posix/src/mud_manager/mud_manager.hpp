@@ -34,132 +34,305 @@
 #ifndef OTBR_MUD_MANAGER_HPP_
 #define OTBR_MUD_MANAGER_HPP_
 
-#include <string>
-#include <list>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <list>
+#include <map>
+#include <mutex>
 #include <ostream>
-#include <fstream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
 
-#include "utils/system_utils.hpp"
+#include <openthread/instance.h>
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
 
-#include <openthread/message.h>
+#include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+#include "mud_manager/mud_cache.hpp"
+#include "mud_manager/mud_fetcher.hpp"
+#include "mud_manager/mud_firewall.hpp"
+#include "mud_manager/mud_parser.hpp"
+#include "mud_manager/mud_resolver.hpp"
+#include "mud_manager/mud_statistics.hpp"
+#include "mud_manager/mud_store.hpp"
+#include "utils/system_utils.hpp"
 
 using namespace std;
 
 // #include "../../third_party/cpp-httplib/repo/httplib.h"
 
-enum ACE_TYPE { ipv4, ipv6 };
-
-struct Match {
-   ACE_TYPE type; // ipv4 || ipv6
-   const char* src_dnsname;
-   const char* dst_dnsname;
-   uint8_t protocol;
-   const char* direction_initiated;
-   const char* src_op;
-   uint16_t src_port;
-   const char* dst_op;
-   uint16_t dst_port;
-   const char* controller;
-};
+/**
+ * Interval in seconds at which the devices are synchronized with the child table.
+ *
+ * Children register new addresses without any child table event, they are picked up at this interval.
+ *
+ */
+#ifndef OTBR_MUD_DEVICE_SYNC_INTERVAL
+#define OTBR_MUD_DEVICE_SYNC_INTERVAL 30
+#endif
 
-struct ACE {
-   const char* name;
-   const char* forwarding;
-   Match matches;
-};
+/**
+ * Directory of the MUD file cache, the firewall rules and the persisted state.
+ *
+ */
+#ifndef OTBR_MUD_DATA_DIR
+#define OTBR_MUD_DATA_DIR "/var/lib/thread/mud"
+#endif
 
-struct ACL {
-   const char* name;
-   const char* type;
-   list <ACE> aces;
-};
+/**
+ * Interval in seconds at which the traffic counters are read from the firewall.
+ *
+ */
+#ifndef OTBR_MUD_COUNTERS_INTERVAL
+#define OTBR_MUD_COUNTERS_INTERVAL 10
+#endif
 
-struct MUDFile {
-   uint8_t mud_version;
-   const char* mud_url;
-   const char* last_update;
-   const char* mud_signature;
-   uint8_t cache_validity;
-   bool is_supported;
-   const char* systeminfo;
-   const char* mfg_name;
-   const char* model_name;
-   const char* firmware_rev;
-   const char* software_rev;
-   const char* documentation;
-   const char* extensions;
-   string device_ip;
-   list<const char *> from_device_policies;
-   list<const char *> to_device_policies;
-   list <ACL> from_device_acls;
-   list <ACL> to_device_acls;
-};
+/**
+ * Maximum number of MUD requests received from the OpenThread core waiting to be processed on the mainloop.
+ *
+ */
+#ifndef OTBR_MUD_MAX_PENDING_REQUESTS
+#define OTBR_MUD_MAX_PENDING_REQUESTS 32
+#endif
+
+/**
+ * Delay in milliseconds between a change of the policies or devices and the saving of the state, all the changes
+ * made during the delay are saved together.
+ *
+ */
+#ifndef OTBR_MUD_STATE_SAVE_DELAY
+#define OTBR_MUD_STATE_SAVE_DELAY 500
+#endif
 
 namespace otbr {
-    namespace MUD {
-        class MudManager {
-            public:
-
-                /**
-                 * This constructor creates a MUD Manager Object.
-                 *
-                 */
-                explicit MudManager(void);
-
-                /**
-                 * This destructor destroys a MUD Manager Object.
-                 *
-                 */
-                ~MudManager(void);
-
-                /**
-                 * This method initializes a ND Proxy manager instance.
-                 *
-                 */
-                void Init(void);
-
-                void Deinit(void);
-
-                otMessageQueue* GetMessageQueue(void);
-
-                void CheckMessageQueue();
-
-                /**
-                 * Start Processing of the actual MUD URL
-                 *
-                 */
-                void Process(void);
-
-                /**
-                * Create a valid MUD URL that cURL can use
-                * @param url A MUD URL
-                * 
-                * @returns A valid MUD URL
-                */
-                string ParseURL(string url);
-
-                /**
-                 * Retrieve a MUD File from a server
-                 * 
-                 * @returns A pointer to the MUD File Content
-                 * 
-                */
-                bool RetrieveFile(ostringstream *target, string url);
-
-                // /**
-                //  * Convert the MUD content into a C object
-                // */
-                bool ParseMUDFile(MUDFile *trgt, ostringstream* src, string ip);
-
-                // /**
-                //  * Create a bash script that can insert the MUD rules into ip6tables
-                // */
-                bool ImplementMUDfile(MUDFile *mf);
-
-                string RandomPolicy(int length);
-        };
-    }
+
+namespace Ncp {
+class ControllerOpenThread;
 }
 
-#endif
\ No newline at end of file
+namespace MUD {
+
+/**
+ * This class implements the MUD Manager.
+ *
+ * MUD requests are delivered by the OpenThread core as typed records when a Parent Request carries a MUD URL TLV,
+ * and kept in a bounded ring until the mainloop processes them outside of the MLE receive path.
+ * MUD files are served from the MUD cache or downloaded concurrently on the mainloop, and handed over to a worker
+ * thread that compiles them into firewall policies. A policy is compiled and installed once per distinct MUD file and
+ * shared by all the devices using it.
+ *
+ * The DNS names matched by the policies are resolved asynchronously on the mainloop, and only the address sets of
+ * the names are updated when their addresses change.
+ *
+ * Devices follow the lifecycle of the children: their addresses are bound while they are attached, and the policy
+ * is torn down when the last device using it is evicted or times out. The policies and the devices bound to them are
+ * persisted, and reinstalled in a single batch when the agent restarts, without waiting for the devices to re-attach.
+ *
+ */
+class MudManager : public MainloopProcessor, private NonCopyable
+{
+public:
+    /**
+     * This constructor creates a MUD Manager Object.
+     *
+     */
+    explicit MudManager(void);
+
+    /**
+     * This constructor creates a MUD Manager Object working on a given directory and firewall.
+     *
+     * @param[in] aDataDirectory  The directory the MUD cache and the state are kept in.
+     * @param[in] aFirewall       The firewall enforcing the policies, destroyed with the MUD Manager.
+     * @param[in] aRequireHttps   Whether MUD files are only fetched over HTTPS, as required by RFC 8520.
+     *
+     */
+    MudManager(const std::string &aDataDirectory, Firewall *aFirewall, bool aRequireHttps = true);
+
+    /**
+     * This destructor destroys a MUD Manager Object.
+     *
+     */
+    ~MudManager(void) override;
+
+    /**
+     * This method initializes the MUD Manager and starts the worker thread.
+     *
+     * @param[in] aNcp  A reference to the OpenThread controller the children are tracked on.
+     *
+     */
+    void Init(Ncp::ControllerOpenThread &aNcp);
+
+    /**
+     * This method initializes the MUD Manager without an OpenThread controller and starts the worker thread.
+     *
+     * MUD requests are then only received through HandleMudRequest(), and the devices are never evicted.
+     *
+     */
+    void Init(void);
+
+    /**
+     * This method stops the worker thread and drops all pending MUD requests.
+     *
+     */
+    void Deinit(void);
+
+    /**
+     * This method queues a MUD request, to be processed on the next mainloop iteration.
+     *
+     * The request is dropped when OTBR_MUD_MAX_PENDING_REQUESTS requests are already waiting.
+     *
+     * @param[in] aInfo  The MUD request.
+     *
+     */
+    void HandleMudRequest(const otThreadMudRequestInfo &aInfo);
+
+    void Update(MainloopContext &aMainloop) override;
+    void Process(const MainloopContext &aMainloop) override;
+
+    /**
+    * Create a valid MUD URL that cURL can use
+    * @param url A MUD URL
+    * 
+    * @returns A valid MUD URL
+    */
+    string ParseURL(string url);
+
+    /**
+     * Compile the ACLs of a MUD file into a firewall policy
+     * @param aMudFile     A parsed MUD file
+     * @param aContentHash The hash of the MUD file content
+     * @param aPolicy      The compiled policy
+     */
+    void CompilePolicy(const MudFile &aMudFile, const string &aContentHash, Policy &aPolicy);
+
+    /**
+     * This method returns a snapshot of the statistics of the MUD Manager.
+     *
+     * This method may be called from any thread.
+     *
+     * @param[out] aStatistics  The statistics.
+     *
+     */
+    void GetStatistics(MudStatistics &aStatistics) const;
+
+private:
+    typedef std::set<std::string>     AddressSet;
+    typedef std::function<void(void)> WorkerTask;
+
+    // The time a device is kept bound without ever being attached as a child.
+    static constexpr Seconds kAttachTimeout = Seconds(60);
+
+    struct MudRequest
+    {
+        std::string mUrl;
+        std::string mIp;
+        std::string mExtAddress;
+        std::string mFileUrl;
+        std::string mContent;
+        std::string mContentHash;
+        AddressSet  mAddresses;
+    };
+
+    struct Device
+    {
+        std::string mContentHash;
+        AddressSet  mAddresses;
+        Timepoint   mBindTime;
+        bool        mAttached = false;
+
+        // The traffic of the device, and the last firewall reading of each address.
+        TrafficCounters                        mCounters;
+        std::map<std::string, TrafficCounters> mReadings;
+    };
+
+    struct RuleCounters
+    {
+        TrafficCounters mCounters;
+        TrafficCounters mReading;
+    };
+
+    static void HandleNeighborTableEvent(otNeighborTableEvent aEvent, const otNeighborTableEntryInfo *aEntryInfo);
+    static void HandleMudRequest(const otThreadMudRequestInfo *aInfo, void *aContext);
+    void        RegisterCallbacks(void);
+    void        HandleThreadStateChanged(otChangedFlags aFlags);
+    void        ScheduleSync(void);
+    void        ScheduleCounters(void);
+    void        CollectChildren(std::map<std::string, AddressSet> &aChildren);
+    void        ProcessPendingRequests(void);
+    void        ReadRequest(const otThreadMudRequestInfo &aInfo, MudRequest &aRequest);
+    void        FetchFile(MudRequest &aRequest);
+    void        HandleFetchResult(const std::string &aUrl, MudFetcher::FetchResult &aResult);
+    void        HandleFileFetched(MudRequest &aRequest);
+    void        PostWorkerTask(WorkerTask aTask);
+    void        RunWorker(void);
+    void        ProcessRequest(const MudRequest &aRequest);
+    void        UpdateDevice(Device &aDevice, const AddressSet &aAddresses);
+    void        UpdateDevices(const std::map<std::string, AddressSet> &aChildren);
+    void        RemoveDevice(const std::string &aExtAddress);
+    void        WatchDnsNames(const Policy &aPolicy, bool aWatch);
+    void        RestoreState(void);
+    void        SaveState(void);
+    void        UpdateCounters(void);
+    void        RecordLatency(Histogram MudStatistics::*aHistogram, Timepoint aStart);
+
+    static MudManager *sMudManager;
+
+    // The MUD requests received from the OpenThread core, oldest first.
+    otThreadMudRequestInfo mPendingRequests[OTBR_MUD_MAX_PENDING_REQUESTS];
+    uint16_t               mPendingHead;
+    uint16_t               mPendingCount;
+
+    Ncp::ControllerOpenThread *mNcp;
+    bool                       mRequireHttps;
+    bool                       mChildTableChanged;
+    MudFetcher                 mFetcher;
+    MudResolver                mResolver;
+    MudCache                   mCache;
+
+    // The tasks posted by the worker thread to the mainloop.
+    TaskRunner mTaskRunner;
+
+    // The compiled policies keyed by MUD file content hash, and the devices
+    // keyed by extended address. Only used by the worker thread.
+    Firewall                     *mFirewall;
+    std::map<std::string, Policy> mPolicies;
+    std::map<std::string, Device> mDevices;
+
+    // The traffic of the rules of the policies, keyed by MUD file content
+    // hash. Only used by the worker thread.
+    std::map<std::string, std::vector<RuleCounters>> mRuleCounters;
+
+    // The statistics are updated by both threads and read from any thread,
+    // guarded by `mStatisticsMutex`.
+    MudStatistics      mStatistics;
+    mutable std::mutex mStatisticsMutex;
+
+    // The policies and devices are persisted shortly after a worker task
+    // changed them, and restored when the worker starts.
+    MudStore mStore;
+    bool     mStateChanged;
+
+    // The requests waiting for a running download, keyed by MUD file URL.
+    std::map<std::string, std::vector<MudRequest>> mFetchingRequests;
+
+    // The tasks are produced by the mainloop thread and consumed by the
+    // worker thread, guarded by `mTaskMutex`.
+    std::deque<WorkerTask>  mWorkerTasks;
+    std::mutex              mTaskMutex;
+    std::condition_variable mTaskCondition;
+    std::thread             mWorker;
+    bool                    mShouldStop;
+};
+
+} // namespace MUD
+} // namespace otbr
+
+#endif // OTBR_MUD_MANAGER_HPP_
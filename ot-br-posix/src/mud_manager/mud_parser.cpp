@@ -0,0 +1,858 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the MUD file parser.
+ */
+
+#define OTBR_LOG_TAG "MudManager"
+
+#include "mud_manager/mud_parser.hpp"
+
+#include <set>
+
+#include <ctype.h>
+#include <string.h>
+
+#include <rapidjson/error/en.h>
+#include <rapidjson/reader.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace MUD {
+
+constexpr size_t MudParser::kMaxAcls;
+constexpr size_t MudParser::kMaxAces;
+constexpr size_t MudParser::kMaxStringLength;
+constexpr size_t MudParser::kMaxDepth;
+
+namespace {
+
+/**
+ * This class implements the SAX handler filling a `MudFile`.
+ *
+ * The handler tracks the position in the document with a stack of contexts. Unknown members are skipped, known
+ * members of the wrong type or out of range abort the parsing. Unknown members of the matches of an ACE flag the ACE,
+ * so that it is not compiled into a rule matching more traffic than the MUD file allows.
+ *
+ */
+class MudHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, MudHandler>
+{
+public:
+    explicit MudHandler(MudFile &aMudFile)
+        : mMudFile(aMudFile)
+        , mAceCount(0)
+        , mError(OTBR_ERROR_NONE)
+        , mHasMud(false)
+        , mHasIsSupported(false)
+        , mFromDevice(false)
+    {
+    }
+
+    otbrError GetError(void) const { return mError; }
+
+    bool Key(const char *aKey, rapidjson::SizeType aLength, bool aCopy)
+    {
+        OTBR_UNUSED_VARIABLE(aCopy);
+
+        mKey.assign(aKey, aLength);
+
+        return true;
+    }
+
+    bool StartObject(void) { return Enter(/* aIsArray */ false); }
+    bool EndObject(rapidjson::SizeType aCount) { return Leave(aCount); }
+    bool StartArray(void) { return Enter(/* aIsArray */ true); }
+    bool EndArray(rapidjson::SizeType aCount) { return Leave(aCount); }
+
+    bool Bool(bool aValue)
+    {
+        bool ret = true;
+
+        if (Top() == kMud && mKey == "is-supported")
+        {
+            mMudFile.mIsSupported = aValue;
+            mHasIsSupported       = true;
+        }
+        else
+        {
+            ret = CheckUnknown();
+        }
+
+        return ret;
+    }
+
+    bool Int(int aValue) { return (aValue < 0) ? CheckUnknown() : Uint64(static_cast<uint64_t>(aValue)); }
+    bool Int64(int64_t aValue) { return (aValue < 0) ? CheckUnknown() : Uint64(static_cast<uint64_t>(aValue)); }
+    bool Uint(unsigned aValue) { return Uint64(aValue); }
+
+    bool Uint64(uint64_t aValue)
+    {
+        bool ret = true;
+
+        switch (Top())
+        {
+        case kMud:
+            if (mKey == "mud-version")
+            {
+                VerifyOrExit(aValue == 1, ret = Fail("unsupported mud-version"));
+                mMudFile.mVersion = static_cast<uint8_t>(aValue);
+            }
+            else if (mKey == "cache-validity")
+            {
+                VerifyOrExit(aValue >= 1 && aValue <= 168, ret = Fail("cache-validity out of range"));
+                mMudFile.mCacheValidity = static_cast<uint8_t>(aValue);
+            }
+            else
+            {
+                ret = CheckUnknown();
+            }
+            break;
+
+        case kMatchIp:
+            if (mKey == "protocol")
+            {
+                VerifyOrExit(aValue <= UINT8_MAX, ret = Fail("protocol out of range"));
+                VerifyOrExit(CurrentAce().mProtocol == 0 || CurrentAce().mProtocol == aValue,
+                             ret = Fail("protocol does not match the transport"));
+                CurrentAce().mProtocol = static_cast<uint8_t>(aValue);
+            }
+            else
+            {
+                ret = CheckUnknown();
+            }
+            break;
+
+        case kSrcPort:
+        case kDstPort:
+            if (mKey == "port")
+            {
+                VerifyOrExit(aValue <= UINT16_MAX, ret = Fail("port out of range"));
+                (Top() == kSrcPort ? CurrentAce().mSrcPort : CurrentAce().mDstPort) = static_cast<uint16_t>(aValue);
+            }
+            else if (mKey == "lower-port" || mKey == "upper-port")
+            {
+                ret = Fail("port ranges are not supported");
+            }
+            else
+            {
+                ret = CheckUnknown();
+            }
+            break;
+
+        default:
+            ret = CheckUnknown();
+            break;
+        }
+
+    exit:
+        return ret;
+    }
+
+    bool Double(double aValue)
+    {
+        OTBR_UNUSED_VARIABLE(aValue);
+
+        return CheckUnknown();
+    }
+
+    bool Null(void) { return CheckUnknown(); }
+
+    bool String(const char *aValue, rapidjson::SizeType aLength, bool aCopy)
+    {
+        std::string *target  = nullptr;
+        bool         handled = false;
+        bool         ret     = true;
+
+        OTBR_UNUSED_VARIABLE(aCopy);
+
+        VerifyOrExit(aLength <= MudParser::kMaxStringLength, ret = Fail("string too long"));
+
+        switch (Top())
+        {
+        case kMud:
+            target = GetMudString();
+            break;
+
+        case kExtensions:
+            mMudFile.mExtensions.emplace_back();
+            target = &mMudFile.mExtensions.back();
+            break;
+
+        case kAccessList:
+            if (mKey == "name")
+            {
+                target = &(mFromDevice ? mMudFile.mFromDevicePolicies : mMudFile.mToDevicePolicies).back();
+            }
+            break;
+
+        case kAcl:
+            if (mKey == "name")
+            {
+                target = &mMudFile.mAcls.back().mName;
+            }
+            else if (mKey == "type")
+            {
+                target = &mMudFile.mAcls.back().mType;
+            }
+            break;
+
+        case kAce:
+            if (mKey == "name")
+            {
+                target = &CurrentAce().mName;
+            }
+            break;
+
+        case kActions:
+            if (mKey == "forwarding")
+            {
+                VerifyOrExit(SetForwarding(std::string(aValue, aLength)), ret = Fail("invalid forwarding"));
+                handled = true;
+            }
+            break;
+
+        case kMatchIp:
+            if (mKey == "ietf-acldns:src-dnsname")
+            {
+                target = &CurrentAce().mSrcDnsName;
+            }
+            else if (mKey == "ietf-acldns:dst-dnsname")
+            {
+                target = &CurrentAce().mDstDnsName;
+            }
+            break;
+
+        case kMatchTransport:
+            if (mKey == "ietf-mud:direction-initiated")
+            {
+                VerifyOrExit(IsEqual(aValue, aLength, "from-device") || IsEqual(aValue, aLength, "to-device"),
+                             ret = Fail("invalid direction-initiated"));
+                target = &CurrentAce().mDirectionInitiated;
+            }
+            break;
+
+        case kSrcPort:
+        case kDstPort:
+            if (mKey == "operator")
+            {
+                VerifyOrExit(IsEqual(aValue, aLength, "eq"), ret = Fail("port operators other than eq are not supported"));
+                handled = true;
+            }
+            break;
+
+        case kMatchMud:
+            if (mKey == "controller")
+            {
+                target = &CurrentAce().mController;
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        if (target != nullptr)
+        {
+            target->assign(aValue, aLength);
+        }
+        else if (!handled)
+        {
+            // Either an unknown member or a known member of another type.
+            ret = CheckUnknown();
+        }
+
+    exit:
+        return ret;
+    }
+
+    /**
+     * This method indicates whether the document had the `ietf-mud:mud` container.
+     *
+     */
+    bool HasMud(void) const { return mHasMud; }
+
+    /**
+     * This method indicates whether the document had the `is-supported` member.
+     *
+     */
+    bool HasIsSupported(void) const { return mHasIsSupported; }
+
+private:
+    enum Context : uint8_t
+    {
+        kRoot,
+        kDocument,
+        kMud,
+        kExtensions,
+        kDevicePolicy,
+        kAccessLists,
+        kAccessListArray,
+        kAccessList,
+        kAcls,
+        kAclArray,
+        kAcl,
+        kAces,
+        kAceArray,
+        kAce,
+        kActions,
+        kMatches,
+        kMatchIp,
+        kMatchTransport,
+        kSrcPort,
+        kDstPort,
+        kMatchMud,
+        kUnknown,
+    };
+
+    Context Top(void) const { return mContexts.empty() ? kRoot : mContexts.back(); }
+    MudAce &CurrentAce(void) { return mMudFile.mAcls.back().mAces.back(); }
+
+    bool Fail(const char *aReason)
+    {
+        otbrLogWarning("Invalid MUD file: %s", aReason);
+        mError = OTBR_ERROR_INVALID_ARGS;
+
+        return false;
+    }
+
+    // Scalars are only valid at unknown members.
+    bool CheckUnknown(void)
+    {
+        bool ret = true;
+
+        switch (Top())
+        {
+        case kExtensions:
+        case kAccessListArray:
+        case kAclArray:
+        case kAceArray:
+            ret = Fail("unexpected value type");
+            break;
+        default:
+            ret = !(IsKnownScalar() || IsKnownContainer()) || Fail("unexpected value type");
+
+            if (ret && IsMatch(Top()))
+            {
+                CurrentAce().mHasUnsupportedMatch = true;
+            }
+            break;
+        }
+
+        return ret;
+    }
+
+    static bool IsMatch(Context aContext)
+    {
+        return aContext == kMatches || aContext == kMatchIp || aContext == kMatchTransport || aContext == kSrcPort ||
+               aContext == kDstPort || aContext == kMatchMud;
+    }
+
+    bool IsKnownContainer(void) const
+    {
+        bool ret = false;
+
+        switch (Top())
+        {
+        case kDocument:
+            ret = (mKey == "ietf-mud:mud" || mKey == "ietf-access-control-list:acls");
+            break;
+        case kMud:
+            ret = (mKey == "extensions" || mKey == "from-device-policy" || mKey == "to-device-policy");
+            break;
+        case kDevicePolicy:
+            ret = (mKey == "access-lists");
+            break;
+        case kAccessLists:
+            ret = (mKey == "access-list");
+            break;
+        case kAcls:
+            ret = (mKey == "acl");
+            break;
+        case kAcl:
+            ret = (mKey == "aces");
+            break;
+        case kAces:
+            ret = (mKey == "ace");
+            break;
+        case kAce:
+            ret = (mKey == "matches" || mKey == "actions");
+            break;
+        case kMatches:
+            ret = (mKey == "ipv6" || mKey == "ipv4" || mKey == "tcp" || mKey == "udp" || mKey == "ietf-mud:mud");
+            break;
+        case kMatchTransport:
+            ret = (mKey == "source-port" || mKey == "destination-port");
+            break;
+        default:
+            break;
+        }
+
+        return ret;
+    }
+
+    bool IsKnownScalar(void) const
+    {
+        static const std::set<std::string> kMudScalars = {
+            "mud-version", "mud-url",  "last-update",  "mud-signature", "cache-validity", "is-supported",
+            "systeminfo",  "mfg-name", "model-name",   "firmware-rev",  "software-rev",   "documentation",
+        };
+        bool ret = false;
+
+        switch (Top())
+        {
+        case kMud:
+            ret = (kMudScalars.count(mKey) != 0);
+            break;
+        case kAccessList:
+        case kAce:
+            ret = (mKey == "name");
+            break;
+        case kAcl:
+            ret = (mKey == "name" || mKey == "type");
+            break;
+        case kActions:
+            ret = (mKey == "forwarding");
+            break;
+        case kMatchIp:
+            ret = (mKey == "protocol" || mKey == "ietf-acldns:src-dnsname" || mKey == "ietf-acldns:dst-dnsname");
+            break;
+        case kMatchTransport:
+            ret = (mKey == "ietf-mud:direction-initiated");
+            break;
+        case kSrcPort:
+        case kDstPort:
+            ret = (mKey == "port" || mKey == "operator");
+            break;
+        default:
+            break;
+        }
+
+        return ret;
+    }
+
+    std::string *GetMudString(void)
+    {
+        std::string *target = nullptr;
+
+        if (mKey == "mud-url")
+        {
+            target = &mMudFile.mUrl;
+        }
+        else if (mKey == "last-update")
+        {
+            target = &mMudFile.mLastUpdate;
+        }
+        else if (mKey == "mud-signature")
+        {
+            target = &mMudFile.mSignature;
+        }
+        else if (mKey == "systeminfo")
+        {
+            target = &mMudFile.mSystemInfo;
+        }
+        else if (mKey == "mfg-name")
+        {
+            target = &mMudFile.mMfgName;
+        }
+        else if (mKey == "model-name")
+        {
+            target = &mMudFile.mModelName;
+        }
+        else if (mKey == "firmware-rev")
+        {
+            target = &mMudFile.mFirmwareRev;
+        }
+        else if (mKey == "software-rev")
+        {
+            target = &mMudFile.mSoftwareRev;
+        }
+        else if (mKey == "documentation")
+        {
+            target = &mMudFile.mDocumentation;
+        }
+
+        return target;
+    }
+
+    bool SetForwarding(const std::string &aForwarding)
+    {
+        static const char kPrefix[] = "ietf-access-control-list:";
+        std::string       forwarding = aForwarding;
+        bool              ret        = true;
+
+        if (forwarding.compare(0, sizeof(kPrefix) - 1, kPrefix) == 0)
+        {
+            forwarding.erase(0, sizeof(kPrefix) - 1);
+        }
+
+        if (forwarding == "accept")
+        {
+            CurrentAce().mForwarding = MudAce::kForwardingAccept;
+        }
+        else if (forwarding == "drop")
+        {
+            CurrentAce().mForwarding = MudAce::kForwardingDrop;
+        }
+        else if (forwarding == "reject")
+        {
+            CurrentAce().mForwarding = MudAce::kForwardingReject;
+        }
+        else
+        {
+            ret = false;
+        }
+
+        return ret;
+    }
+
+    bool Enter(bool aIsArray)
+    {
+        Context parent = Top();
+        Context child  = kUnknown;
+        bool    ret    = true;
+
+        VerifyOrExit(mContexts.size() < MudParser::kMaxDepth, ret = false);
+
+        switch (parent)
+        {
+        case kRoot:
+            child = kDocument;
+            break;
+        case kDocument:
+            if (mKey == "ietf-mud:mud")
+            {
+                child    = kMud;
+                mHasMud  = true;
+            }
+            else if (mKey == "ietf-access-control-list:acls")
+            {
+                child = kAcls;
+            }
+            break;
+        case kMud:
+            if (mKey == "extensions")
+            {
+                child = kExtensions;
+            }
+            else if (mKey == "from-device-policy" || mKey == "to-device-policy")
+            {
+                child       = kDevicePolicy;
+                mFromDevice = (mKey == "from-device-policy");
+            }
+            break;
+        case kDevicePolicy:
+            child = (mKey == "access-lists") ? kAccessLists : kUnknown;
+            break;
+        case kAccessLists:
+            child = (mKey == "access-list") ? kAccessListArray : kUnknown;
+            break;
+        case kAccessListArray:
+            child = kAccessList;
+            (mFromDevice ? mMudFile.mFromDevicePolicies : mMudFile.mToDevicePolicies).emplace_back();
+            break;
+        case kAcls:
+            child = (mKey == "acl") ? kAclArray : kUnknown;
+            break;
+        case kAclArray:
+            VerifyOrExit(mMudFile.mAcls.size() < MudParser::kMaxAcls, ret = Fail("too many ACLs"));
+            child = kAcl;
+            mMudFile.mAcls.emplace_back();
+            break;
+        case kAcl:
+            child = (mKey == "aces") ? kAces : kUnknown;
+            break;
+        case kAces:
+            child = (mKey == "ace") ? kAceArray : kUnknown;
+            break;
+        case kAceArray:
+            VerifyOrExit(mAceCount++ < MudParser::kMaxAces, ret = Fail("too many ACEs"));
+            child = kAce;
+            mMudFile.mAcls.back().mAces.emplace_back();
+            break;
+        case kAce:
+            if (mKey == "matches")
+            {
+                child = kMatches;
+            }
+            else if (mKey == "actions")
+            {
+                child = kActions;
+            }
+            break;
+        case kMatches:
+            if (mKey == "ipv6" || mKey == "ipv4")
+            {
+                uint8_t version = (mKey == "ipv6") ? 6 : 4;
+
+                VerifyOrExit(CurrentAce().mIpVersion == 0, ret = Fail("several IP versions matched"));
+                CurrentAce().mIpVersion = version;
+                child                   = kMatchIp;
+            }
+            else if (mKey == "tcp" || mKey == "udp")
+            {
+                uint8_t protocol = (mKey == "tcp") ? 6 : 17;
+
+                VerifyOrExit(CurrentAce().mProtocol == 0 || CurrentAce().mProtocol == protocol,
+                             ret = Fail("protocol does not match the transport"));
+                CurrentAce().mProtocol = protocol;
+                child                  = kMatchTransport;
+            }
+            else if (mKey == "ietf-mud:mud")
+            {
+                child = kMatchMud;
+            }
+            break;
+        case kMatchTransport:
+            if (mKey == "source-port")
+            {
+                child = kSrcPort;
+            }
+            else if (mKey == "destination-port")
+            {
+                child = kDstPort;
+            }
+            break;
+        default:
+            break;
+        }
+
+        VerifyOrExit(child != kUnknown || !IsKnownScalar(), ret = Fail("unexpected value type"));
+
+        if (child == kUnknown && IsMatch(parent))
+        {
+            CurrentAce().mHasUnsupportedMatch = true;
+        }
+
+        // Known containers must have the expected JSON type.
+        switch (child)
+        {
+        case kExtensions:
+        case kAccessListArray:
+        case kAclArray:
+        case kAceArray:
+            VerifyOrExit(aIsArray, ret = Fail("expected an array"));
+            break;
+        case kUnknown:
+            break;
+        default:
+            VerifyOrExit(!aIsArray, ret = Fail("expected an object"));
+            break;
+        }
+
+        mContexts.push_back(child);
+        mKey.clear();
+
+    exit:
+        return ret;
+    }
+
+    bool Leave(rapidjson::SizeType aCount)
+    {
+        OTBR_UNUSED_VARIABLE(aCount);
+
+        mContexts.pop_back();
+
+        return true;
+    }
+
+    static bool IsEqual(const char *aValue, rapidjson::SizeType aLength, const char *aExpected)
+    {
+        return strlen(aExpected) == aLength && memcmp(aValue, aExpected, aLength) == 0;
+    }
+
+    MudFile             &mMudFile;
+    std::vector<Context> mContexts;
+    std::string          mKey;
+    size_t               mAceCount;
+    otbrError            mError;
+    bool                 mHasMud;
+    bool                 mHasIsSupported;
+    bool                 mFromDevice;
+};
+
+// The names end up in log messages and firewall commands, reject anything a shell or a ruleset would interpret.
+bool IsSafeName(const std::string &aName)
+{
+    static const char kUnsafeCharacters[] = "\"'`$;\\";
+
+    bool ret = false;
+
+    for (char c : aName)
+    {
+        VerifyOrExit(!iscntrl(static_cast<unsigned char>(c)) && strchr(kUnsafeCharacters, c) == nullptr);
+    }
+
+    ret = true;
+
+exit:
+    return ret;
+}
+
+// A host name as defined by RFC 1123: dot separated labels of letters, digits and hyphens, the labels neither start
+// nor end with a hyphen and are at most 63 characters long, the whole name is at most 253 characters long.
+bool IsValidDnsName(const std::string &aName)
+{
+    static constexpr size_t kMaxNameLength  = 253;
+    static constexpr size_t kMaxLabelLength = 63;
+
+    size_t labelLength = 0;
+    char   previous    = '.';
+    bool   ret         = false;
+
+    VerifyOrExit(!aName.empty() && aName.size() <= kMaxNameLength);
+
+    for (char c : aName)
+    {
+        if (c == '.')
+        {
+            VerifyOrExit(labelLength != 0 && previous != '-');
+            labelLength = 0;
+        }
+        else
+        {
+            VerifyOrExit(isalnum(static_cast<unsigned char>(c)) || (c == '-' && labelLength != 0));
+            VerifyOrExit(++labelLength <= kMaxLabelLength);
+        }
+
+        previous = c;
+    }
+
+    VerifyOrExit(labelLength != 0 && previous != '-');
+    ret = true;
+
+exit:
+    return ret;
+}
+
+} // namespace
+
+const MudAcl *MudFile::FindAcl(const std::string &aName) const
+{
+    const MudAcl *ret = nullptr;
+
+    for (const MudAcl &acl : mAcls)
+    {
+        if (acl.mName == aName)
+        {
+            ret = &acl;
+            break;
+        }
+    }
+
+    return ret;
+}
+
+otbrError MudParser::Parse(const std::string &aContent, MudFile &aMudFile)
+{
+    otbrError                     error = OTBR_ERROR_NONE;
+    MudHandler                    handler(aMudFile);
+    rapidjson::Reader             reader;
+    rapidjson::MemoryStream       stream(aContent.data(), aContent.size());
+    rapidjson::ParseResult        result;
+
+    aMudFile = MudFile();
+
+    // The iterative parser keeps the native stack bounded whatever the nesting.
+    result = reader.Parse<rapidjson::kParseIterativeFlag | rapidjson::kParseStopWhenDoneFlag>(stream, handler);
+
+    if (result.IsError())
+    {
+        error = (handler.GetError() != OTBR_ERROR_NONE) ? handler.GetError() : OTBR_ERROR_PARSE;
+        otbrLogWarning("Failed to parse MUD file at offset %zu: %s", result.Offset(),
+                       rapidjson::GetParseError_En(result.Code()));
+        ExitNow();
+    }
+
+    VerifyOrExit(handler.HasMud(), error = OTBR_ERROR_INVALID_ARGS, otbrLogWarning("Invalid MUD file: no ietf-mud:mud"));
+    VerifyOrExit(handler.HasIsSupported(), error = OTBR_ERROR_INVALID_ARGS,
+                 otbrLogWarning("Invalid MUD file: no is-supported"));
+
+    error = Validate(aMudFile);
+
+exit:
+    return error;
+}
+
+otbrError MudParser::Validate(const MudFile &aMudFile)
+{
+    otbrError             error = OTBR_ERROR_INVALID_ARGS;
+    std::set<std::string> aclNames;
+    const char           *reason = nullptr;
+
+    VerifyOrExit(aMudFile.mVersion == 1, reason = "no mud-version");
+    VerifyOrExit(aMudFile.mUrl.compare(0, 8, "https://") == 0, reason = "mud-url is not an https URL");
+    VerifyOrExit(IsSafeName(aMudFile.mUrl), reason = "mud-url contains unsafe characters");
+    VerifyOrExit(!aMudFile.mLastUpdate.empty(), reason = "no last-update");
+    VerifyOrExit(aMudFile.mSystemInfo.size() <= 60, reason = "systeminfo longer than 60 characters");
+
+    for (const MudAcl &acl : aMudFile.mAcls)
+    {
+        std::set<std::string> aceNames;
+
+        VerifyOrExit(!acl.mName.empty(), reason = "ACL without name");
+        VerifyOrExit(IsSafeName(acl.mName), reason = "ACL name contains unsafe characters");
+        VerifyOrExit(aclNames.insert(acl.mName).second, reason = "duplicate ACL name");
+
+        for (const MudAce &ace : acl.mAces)
+        {
+            VerifyOrExit(!ace.mName.empty(), reason = "ACE without name");
+            VerifyOrExit(IsSafeName(ace.mName), reason = "ACE name contains unsafe characters");
+            VerifyOrExit(ace.mSrcDnsName.empty() || IsValidDnsName(ace.mSrcDnsName), reason = "invalid src-dnsname");
+            VerifyOrExit(ace.mDstDnsName.empty() || IsValidDnsName(ace.mDstDnsName), reason = "invalid dst-dnsname");
+            VerifyOrExit(aceNames.insert(ace.mName).second, reason = "duplicate ACE name");
+            VerifyOrExit(ace.mForwarding != MudAce::kForwardingNone, reason = "ACE without forwarding action");
+            VerifyOrExit((ace.mSrcPort == 0 && ace.mDstPort == 0) || ace.mProtocol == 6 || ace.mProtocol == 17,
+                         reason = "port matched without tcp or udp");
+        }
+    }
+
+    for (const std::vector<std::string> *policies : {&aMudFile.mFromDevicePolicies, &aMudFile.mToDevicePolicies})
+    {
+        for (const std::string &name : *policies)
+        {
+            VerifyOrExit(aclNames.count(name) != 0, reason = "policy references an unknown ACL");
+        }
+    }
+
+    error = OTBR_ERROR_NONE;
+
+exit:
+    if (reason != nullptr)
+    {
+        otbrLogWarning("Invalid MUD file: %s", reason);
+    }
+
+    return error;
+}
+
+} // namespace MUD
+} // namespace otbr
@@ -0,0 +1,160 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the MUD file parser.
+ */
+
+#ifndef OTBR_MUD_PARSER_HPP_
+#define OTBR_MUD_PARSER_HPP_
+
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+namespace MUD {
+
+/**
+ * This structure represents an access control entry of a MUD file.
+ *
+ */
+struct MudAce
+{
+    /**
+     * This enumeration represents the action of an access control entry.
+     *
+     */
+    enum Forwarding : uint8_t
+    {
+        kForwardingNone,   ///< No action was specified.
+        kForwardingAccept, ///< The matching traffic is accepted.
+        kForwardingDrop,   ///< The matching traffic is dropped.
+        kForwardingReject, ///< The matching traffic is rejected.
+    };
+
+    std::string mName;                         ///< The name of the entry.
+    Forwarding  mForwarding = kForwardingNone; ///< The action of the entry.
+    uint8_t     mIpVersion  = 0;               ///< The IP version matched, zero for none.
+    uint8_t     mProtocol   = 0;               ///< The IP protocol matched, zero for any protocol.
+    std::string mSrcDnsName;                   ///< The source DNS name matched, empty for any source.
+    std::string mDstDnsName;                   ///< The destination DNS name matched, empty for any destination.
+    uint16_t    mSrcPort = 0;                  ///< The source port matched, zero for any port.
+    uint16_t    mDstPort = 0;                  ///< The destination port matched, zero for any port.
+    std::string mDirectionInitiated;           ///< The direction the connection is initiated in, or empty.
+    std::string mController;                   ///< The MUD controller matched, or empty.
+    bool        mHasUnsupportedMatch = false;  ///< Whether the entry matches on members the parser does not support.
+};
+
+/**
+ * This structure represents an access control list of a MUD file.
+ *
+ */
+struct MudAcl
+{
+    std::string         mName; ///< The name of the list.
+    std::string         mType; ///< The type of the list.
+    std::vector<MudAce> mAces; ///< The entries of the list.
+};
+
+/**
+ * This structure represents a parsed MUD file.
+ *
+ * All the members are owned, the structure stays valid after the content it was parsed from is released.
+ *
+ */
+struct MudFile
+{
+    uint8_t                  mVersion       = 0;     ///< The `mud-version`.
+    std::string              mUrl;                   ///< The `mud-url`.
+    std::string              mLastUpdate;            ///< The `last-update`.
+    std::string              mSignature;             ///< The `mud-signature`, or empty.
+    uint8_t                  mCacheValidity = 48;    ///< The `cache-validity` in hours.
+    bool                     mIsSupported   = false; ///< The `is-supported` flag.
+    std::string              mSystemInfo;            ///< The `systeminfo`, or empty.
+    std::string              mMfgName;               ///< The `mfg-name`, or empty.
+    std::string              mModelName;             ///< The `model-name`, or empty.
+    std::string              mFirmwareRev;           ///< The `firmware-rev`, or empty.
+    std::string              mSoftwareRev;           ///< The `software-rev`, or empty.
+    std::string              mDocumentation;         ///< The `documentation`, or empty.
+    std::vector<std::string> mExtensions;            ///< The `extensions`.
+    std::vector<std::string> mFromDevicePolicies;    ///< The names of the ACLs applied to traffic from the device.
+    std::vector<std::string> mToDevicePolicies;      ///< The names of the ACLs applied to traffic to the device.
+    std::vector<MudAcl>      mAcls;                  ///< The ACLs.
+
+    /**
+     * This method finds an ACL by name.
+     *
+     * @param[in] aName  The name of the ACL.
+     *
+     * @returns A pointer to the ACL, or nullptr if not found.
+     *
+     */
+    const MudAcl *FindAcl(const std::string &aName) const;
+};
+
+/**
+ * This class implements the MUD file parser.
+ *
+ * The content is parsed with the rapidjson SAX reader straight into a `MudFile`, without building a DOM nor copying
+ * the document, and validated against the constraints of the RFC 8520 YANG modules.
+ *
+ */
+class MudParser
+{
+public:
+    static constexpr size_t kMaxAcls         = 64;   ///< Maximum number of ACLs in a MUD file.
+    static constexpr size_t kMaxAces         = 1024; ///< Maximum number of ACEs in a MUD file.
+    static constexpr size_t kMaxStringLength = 1024; ///< Maximum length of a string in a MUD file.
+    static constexpr size_t kMaxDepth        = 16;   ///< Maximum nesting depth of a MUD file.
+
+    /**
+     * This function parses and validates a MUD file.
+     *
+     * @param[in]  aContent  The content of the MUD file.
+     * @param[out] aMudFile  The parsed MUD file.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully parsed the MUD file.
+     * @retval OTBR_ERROR_PARSE         The content is not valid JSON or exceeds the parser limits.
+     * @retval OTBR_ERROR_INVALID_ARGS  The content violates the MUD data model.
+     *
+     */
+    static otbrError Parse(const std::string &aContent, MudFile &aMudFile);
+
+private:
+    static otbrError Validate(const MudFile &aMudFile);
+};
+
+} // namespace MUD
+} // namespace otbr
+
+#endif // OTBR_MUD_PARSER_HPP_
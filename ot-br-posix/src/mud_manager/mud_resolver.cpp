@@ -0,0 +1,248 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the resolver of the DNS names used in MUD files.
+ */
+
+#define OTBR_LOG_TAG "MudManager"
+
+#include "mud_manager/mud_resolver.hpp"
+
+#include <algorithm>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace MUD {
+
+constexpr Seconds MudResolver::kRetryInterval;
+
+MudResolver::MudResolver(ResolveHandler aHandler)
+    : mHandler(std::move(aHandler))
+    , mChannel(nullptr)
+{
+    int status;
+
+    ares_library_init(ARES_LIB_INIT_ALL);
+    status = ares_init(&mChannel);
+
+    if (status != ARES_SUCCESS)
+    {
+        otbrLogErr("Failed to initialize the DNS resolver: %s", ares_strerror(status));
+        mChannel = nullptr;
+    }
+}
+
+MudResolver::~MudResolver(void)
+{
+    mNames.clear();
+
+    if (mChannel != nullptr)
+    {
+        // Running queries complete with ARES_EDESTRUCTION and are ignored.
+        ares_destroy(mChannel);
+    }
+
+    ares_library_cleanup();
+}
+
+void MudResolver::Watch(const std::string &aName)
+{
+    Name &entry = mNames[aName];
+
+    if (entry.mWatchCount++ == 0)
+    {
+        otbrLogInfo("Watching DNS name %s", aName.c_str());
+        Resolve(aName, entry);
+    }
+}
+
+void MudResolver::Unwatch(const std::string &aName)
+{
+    auto entry = mNames.find(aName);
+
+    VerifyOrExit(entry != mNames.end());
+
+    if (--entry->second.mWatchCount == 0)
+    {
+        otbrLogInfo("Stopped watching DNS name %s", aName.c_str());
+        mNames.erase(entry);
+    }
+
+exit:
+    return;
+}
+
+void MudResolver::Resolve(const std::string &aName, Name &aEntry)
+{
+    struct ares_addrinfo_hints hints;
+
+    VerifyOrExit(mChannel != nullptr && !aEntry.mResolving);
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET6;
+    hints.ai_flags  = ARES_AI_NOSORT;
+
+    aEntry.mResolving = true;
+    ares_getaddrinfo(mChannel, aName.c_str(), nullptr, &hints, &MudResolver::HandleResult, new Query{this, aName});
+
+exit:
+    return;
+}
+
+void MudResolver::HandleResult(void *aContext, int aStatus, int aTimeouts, struct ares_addrinfo *aResult)
+{
+    Query *query = static_cast<Query *>(aContext);
+
+    OTBR_UNUSED_VARIABLE(aTimeouts);
+
+    if (aStatus != ARES_EDESTRUCTION)
+    {
+        query->mResolver->HandleResult(query->mName, aStatus, aResult);
+    }
+
+    if (aResult != nullptr)
+    {
+        ares_freeaddrinfo(aResult);
+    }
+
+    delete query;
+}
+
+void MudResolver::HandleResult(const std::string &aName, int aStatus, struct ares_addrinfo *aResult)
+{
+    auto       entry = mNames.find(aName);
+    AddressSet addresses;
+    int        ttl = OTBR_MUD_RESOLVE_MAX_TTL;
+
+    // The name was unwatched while being resolved.
+    VerifyOrExit(entry != mNames.end());
+
+    entry->second.mResolving = false;
+
+    if (aStatus != ARES_SUCCESS)
+    {
+        // Keep enforcing the last known addresses until the name resolves again.
+        otbrLogWarning("Failed to resolve %s: %s", aName.c_str(), ares_strerror(aStatus));
+        entry->second.mExpireTime = Clock::now() + kRetryInterval;
+        ExitNow();
+    }
+
+    for (struct ares_addrinfo_node *node = aResult->nodes; node != nullptr; node = node->ai_next)
+    {
+        char address[INET6_ADDRSTRLEN];
+
+        if (node->ai_family != AF_INET6)
+        {
+            continue;
+        }
+
+        inet_ntop(AF_INET6, &reinterpret_cast<struct sockaddr_in6 *>(node->ai_addr)->sin6_addr, address,
+                  sizeof(address));
+        addresses.insert(address);
+        ttl = std::min(ttl, node->ai_ttl);
+    }
+
+    ttl                       = std::max(ttl, OTBR_MUD_RESOLVE_MIN_TTL);
+    entry->second.mExpireTime = Clock::now() + Seconds(ttl);
+
+    if (addresses != entry->second.mAddresses)
+    {
+        otbrLogInfo("DNS name %s resolved to %zu addresses, TTL %d", aName.c_str(), addresses.size(), ttl);
+        entry->second.mAddresses = addresses;
+        mHandler(aName, addresses);
+    }
+
+exit:
+    return;
+}
+
+void MudResolver::Update(MainloopContext &aMainloop)
+{
+    Timepoint    now     = Clock::now();
+    Microseconds timeout = FromTimeval<Microseconds>(aMainloop.mTimeout);
+    timeval      maxTimeout;
+    timeval      aresTimeout;
+    int          maxFd;
+
+    VerifyOrExit(mChannel != nullptr);
+
+    maxFd            = ares_fds(mChannel, &aMainloop.mReadFdSet, &aMainloop.mWriteFdSet) - 1;
+    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, maxFd);
+
+    // Wake up when the records of a name expire.
+    for (const auto &name : mNames)
+    {
+        if (!name.second.mResolving)
+        {
+            Microseconds delay = std::chrono::duration_cast<Microseconds>(name.second.mExpireTime - now);
+
+            timeout = std::min(timeout, std::max(delay, Microseconds::zero()));
+        }
+    }
+
+    maxTimeout         = ToTimeval(timeout);
+    aMainloop.mTimeout = *ares_timeout(mChannel, &maxTimeout, &aresTimeout);
+
+exit:
+    return;
+}
+
+void MudResolver::Process(const MainloopContext &aMainloop)
+{
+    Timepoint now = Clock::now();
+    fd_set    readFdSet;
+    fd_set    writeFdSet;
+
+    VerifyOrExit(mChannel != nullptr);
+
+    readFdSet  = aMainloop.mReadFdSet;
+    writeFdSet = aMainloop.mWriteFdSet;
+    ares_process(mChannel, &readFdSet, &writeFdSet);
+
+    for (auto &name : mNames)
+    {
+        if (!name.second.mResolving && name.second.mExpireTime <= now)
+        {
+            Resolve(name.first, name.second);
+        }
+    }
+
+exit:
+    return;
+}
+
+} // namespace MUD
+} // namespace otbr
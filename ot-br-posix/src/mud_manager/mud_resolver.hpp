@@ -0,0 +1,165 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the resolver of the DNS names used in MUD files.
+ */
+
+#ifndef OTBR_MUD_RESOLVER_HPP_
+#define OTBR_MUD_RESOLVER_HPP_
+
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+
+#include <ares.h>
+
+#include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/time.hpp"
+
+/**
+ * Minimum interval in seconds between two resolutions of the same DNS name, whatever its TTL.
+ *
+ */
+#ifndef OTBR_MUD_RESOLVE_MIN_TTL
+#define OTBR_MUD_RESOLVE_MIN_TTL 30
+#endif
+
+/**
+ * Maximum interval in seconds between two resolutions of the same DNS name, whatever its TTL.
+ *
+ */
+#ifndef OTBR_MUD_RESOLVE_MAX_TTL
+#define OTBR_MUD_RESOLVE_MAX_TTL 3600
+#endif
+
+namespace otbr {
+namespace MUD {
+
+/**
+ * This class implements the asynchronous resolver of the DNS names matched by MUD ACEs.
+ *
+ * Watched names are resolved with c-ares on the mainloop and resolved again when their records expire. The handler
+ * is only called when the set of addresses of a name changes.
+ *
+ */
+class MudResolver : private NonCopyable
+{
+public:
+    typedef std::set<std::string> AddressSet;
+
+    /**
+     * This type represents the handler called when the addresses of a name change.
+     *
+     * @param[in] aName       The DNS name.
+     * @param[in] aAddresses  The IPv6 addresses the name resolves to.
+     *
+     */
+    using ResolveHandler = std::function<void(const std::string &aName, const AddressSet &aAddresses)>;
+
+    /**
+     * This constructor initializes the resolver.
+     *
+     * @param[in] aHandler  The handler called on the mainloop when the addresses of a name change.
+     *
+     */
+    explicit MudResolver(ResolveHandler aHandler);
+
+    /**
+     * This destructor cancels all the running resolutions.
+     *
+     */
+    ~MudResolver(void);
+
+    /**
+     * This method starts watching a DNS name.
+     *
+     * A name may be watched several times, it is resolved until it is unwatched as many times.
+     *
+     * @param[in] aName  The DNS name.
+     *
+     */
+    void Watch(const std::string &aName);
+
+    /**
+     * This method stops watching a DNS name.
+     *
+     * @param[in] aName  The DNS name.
+     *
+     */
+    void Unwatch(const std::string &aName);
+
+    /**
+     * This method updates the mainloop context with the sockets and timeout of the resolver.
+     *
+     * @param[in,out] aMainloop  A reference to the mainloop to be updated.
+     *
+     */
+    void Update(MainloopContext &aMainloop);
+
+    /**
+     * This method processes the resolver sockets and starts the due resolutions.
+     *
+     * @param[in] aMainloop  A reference to the mainloop context.
+     *
+     */
+    void Process(const MainloopContext &aMainloop);
+
+private:
+    static constexpr Seconds kRetryInterval = Seconds(30);
+
+    struct Name
+    {
+        unsigned int mWatchCount = 0;
+        bool         mResolving  = false;
+        Timepoint    mExpireTime;
+        AddressSet   mAddresses;
+    };
+
+    struct Query
+    {
+        MudResolver *mResolver;
+        std::string  mName;
+    };
+
+    static void HandleResult(void *aContext, int aStatus, int aTimeouts, struct ares_addrinfo *aResult);
+    void        HandleResult(const std::string &aName, int aStatus, struct ares_addrinfo *aResult);
+    void        Resolve(const std::string &aName, Name &aEntry);
+
+    ResolveHandler              mHandler;
+    ares_channel                mChannel;
+    std::map<std::string, Name> mNames;
+};
+
+} // namespace MUD
+} // namespace otbr
+
+#endif // OTBR_MUD_RESOLVER_HPP_
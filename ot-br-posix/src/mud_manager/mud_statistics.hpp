@@ -0,0 +1,172 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the MUD Manager statistics.
+ */
+
+#ifndef OTBR_MUD_STATISTICS_HPP_
+#define OTBR_MUD_STATISTICS_HPP_
+
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include "mud_manager/mud_firewall.hpp"
+
+namespace otbr {
+namespace MUD {
+
+/**
+ * This class implements a histogram with power-of-two buckets.
+ *
+ * Bucket 0 counts the zero values, and bucket `i` the values in [2^(i-1), 2^i). The last bucket also counts all the
+ * larger values.
+ *
+ */
+class Histogram
+{
+public:
+    static constexpr uint8_t kNumBuckets = 28; ///< The number of buckets, the last one starting at 2^26.
+
+    /**
+     * This constructor initializes an empty histogram.
+     *
+     */
+    Histogram(void);
+
+    /**
+     * This method records a value.
+     *
+     * @param[in] aValue  The value.
+     *
+     */
+    void Record(uint64_t aValue);
+
+    /**
+     * This method returns the number of recorded values.
+     *
+     * @returns The number of recorded values.
+     *
+     */
+    uint64_t GetCount(void) const { return mCount; }
+
+    /**
+     * This method returns the sum of the recorded values.
+     *
+     * @returns The sum of the recorded values.
+     *
+     */
+    uint64_t GetSum(void) const { return mSum; }
+
+    /**
+     * This method returns the largest recorded value.
+     *
+     * @returns The largest recorded value, zero if none was recorded.
+     *
+     */
+    uint64_t GetMax(void) const { return mMax; }
+
+    /**
+     * This method returns the number of values recorded in a bucket.
+     *
+     * @param[in] aIndex  The index of the bucket, less than `kNumBuckets`.
+     *
+     * @returns The number of values recorded in the bucket.
+     *
+     */
+    uint64_t GetBucket(uint8_t aIndex) const { return mBuckets[aIndex]; }
+
+    /**
+     * This function returns the index of the bucket counting a value.
+     *
+     * @param[in] aValue  The value.
+     *
+     * @returns The index of the bucket.
+     *
+     */
+    static uint8_t GetBucketIndex(uint64_t aValue);
+
+private:
+    uint64_t mCount;
+    uint64_t mSum;
+    uint64_t mMax;
+    uint64_t mBuckets[kNumBuckets];
+};
+
+/**
+ * This structure represents the statistics of the MUD Manager.
+ *
+ * The latencies are recorded in microseconds, the queue depth is the number of tasks waiting for the worker thread
+ * when a task is posted. The traffic counters are read periodically from the firewall and accumulated across
+ * ruleset reloads.
+ *
+ */
+struct MudStatistics
+{
+    /**
+     * This structure represents the traffic of a device.
+     *
+     */
+    struct Device
+    {
+        std::string     mExtAddress; ///< The extended address of the device, in hex.
+        std::string     mPolicyName; ///< The name of the policy the device is attached to.
+        std::string     mUrl;        ///< The MUD URL of the policy.
+        TrafficCounters mCounters;   ///< The traffic forwarded from and to the device.
+    };
+
+    /**
+     * This structure represents the traffic accepted by a rule compiled from a MUD ACE.
+     *
+     */
+    struct Rule
+    {
+        std::string           mPolicyName; ///< The name of the policy.
+        std::string           mAclName;    ///< The name of the ACL.
+        std::string           mAceName;    ///< The name of the ACE.
+        PolicyRule::Direction mDirection;  ///< The direction of the traffic.
+        TrafficCounters       mCounters;   ///< The traffic accepted by the rule.
+    };
+
+    std::vector<Device> mDevices; ///< The devices attached to a policy.
+    std::vector<Rule>   mRules;   ///< The rules of the installed policies.
+
+    Histogram mFetchLatency;   ///< The time to download a MUD file.
+    Histogram mParseLatency;   ///< The time to parse a MUD file.
+    Histogram mCompileLatency; ///< The time to compile a MUD file into a policy.
+    Histogram mInstallLatency; ///< The time to install a policy in the firewall.
+    Histogram mQueueDepth;     ///< The number of tasks waiting for the worker thread.
+};
+
+} // namespace MUD
+} // namespace otbr
+
+#endif // OTBR_MUD_STATISTICS_HPP_
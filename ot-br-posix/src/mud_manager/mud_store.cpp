@@ -0,0 +1,462 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the persistent MUD state store.
+ */
+
+#define OTBR_LOG_TAG "MudManager"
+
+#include "mud_manager/mud_store.hpp"
+
+#include <vector>
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <mbedtls/sha256.h>
+
+#include "common/logging.hpp"
+#include "utils/hex.hpp"
+
+namespace otbr {
+namespace MUD {
+
+namespace {
+
+// The file starts with a fixed header:
+//
+//   magic (4) | version (2) | reserved (2) | policy count (4) | binding count (4) | payload length (4) |
+//   payload SHA-256 (32)
+//
+// followed by the payload, all integers in little-endian:
+//
+//   policy:  content hash, name, URL (strings), rule count (2), rules
+//   rule:    direction (1), protocol (1), source port (2), destination port (2), ACL name, ACE name,
+//            source DNS name, destination DNS name (strings)
+//   binding: extended address (8), policy index (2), address count (2), addresses (16 each)
+//
+// Strings are a length (2) followed by the characters.
+constexpr char     kMagic[4]      = {'M', 'U', 'D', 'S'};
+constexpr size_t   kHashLength    = 32;
+constexpr size_t   kHeaderLength  = sizeof(kMagic) + 2 + 2 + 4 + 4 + 4 + kHashLength;
+constexpr size_t   kExtAddrLength = 8;
+constexpr size_t   kAddressLength = 16;
+constexpr uint16_t kMaxCount      = UINT16_MAX;
+
+class Writer
+{
+public:
+    void AppendUint8(uint8_t aValue) { mBuffer.push_back(static_cast<char>(aValue)); }
+
+    void AppendUint16(uint16_t aValue)
+    {
+        AppendUint8(static_cast<uint8_t>(aValue));
+        AppendUint8(static_cast<uint8_t>(aValue >> 8));
+    }
+
+    void AppendUint32(uint32_t aValue)
+    {
+        AppendUint16(static_cast<uint16_t>(aValue));
+        AppendUint16(static_cast<uint16_t>(aValue >> 16));
+    }
+
+    void AppendBytes(const void *aBytes, size_t aLength)
+    {
+        mBuffer.append(static_cast<const char *>(aBytes), aLength);
+    }
+
+    // The strings of a compiled policy are bounded by the MUD parser.
+    void AppendString(const std::string &aString)
+    {
+        AppendUint16(static_cast<uint16_t>(aString.size()));
+        mBuffer.append(aString);
+    }
+
+    std::string &GetBuffer(void) { return mBuffer; }
+
+private:
+    std::string mBuffer;
+};
+
+class Reader
+{
+public:
+    Reader(const uint8_t *aData, size_t aLength)
+        : mData(aData)
+        , mLength(aLength)
+    {
+    }
+
+    bool ReadUint8(uint8_t &aValue) { return ReadBytes(&aValue, sizeof(aValue)); }
+
+    bool ReadUint16(uint16_t &aValue)
+    {
+        uint8_t bytes[2];
+        bool    ret = ReadBytes(bytes, sizeof(bytes));
+
+        aValue = static_cast<uint16_t>(bytes[0] | (bytes[1] << 8));
+
+        return ret;
+    }
+
+    bool ReadUint32(uint32_t &aValue)
+    {
+        uint16_t low  = 0;
+        uint16_t high = 0;
+        bool     ret  = ReadUint16(low) && ReadUint16(high);
+
+        aValue = low | (static_cast<uint32_t>(high) << 16);
+
+        return ret;
+    }
+
+    bool ReadBytes(void *aBytes, size_t aLength)
+    {
+        bool ret = (aLength <= mLength);
+
+        if (ret)
+        {
+            memcpy(aBytes, mData, aLength);
+            Skip(aLength);
+        }
+        else
+        {
+            memset(aBytes, 0, aLength);
+        }
+
+        return ret;
+    }
+
+    bool ReadString(std::string &aString)
+    {
+        uint16_t length;
+        bool     ret = ReadUint16(length) && length <= mLength;
+
+        if (ret)
+        {
+            aString.assign(reinterpret_cast<const char *>(mData), length);
+            Skip(length);
+        }
+
+        return ret;
+    }
+
+    size_t GetRemaining(void) const { return mLength; }
+
+private:
+    void Skip(size_t aLength)
+    {
+        mData += aLength;
+        mLength -= aLength;
+    }
+
+    const uint8_t *mData;
+    size_t         mLength;
+};
+
+void ComputeHash(const void *aData, size_t aLength, uint8_t (&aHash)[kHashLength])
+{
+    mbedtls_sha256(static_cast<const uint8_t *>(aData), aLength, aHash, /* is224 */ 0);
+}
+
+bool ReadPolicy(Reader &aReader, std::string &aContentHash, Policy &aPolicy)
+{
+    uint16_t ruleCount;
+    bool     ret = false;
+
+    VerifyOrExit(aReader.ReadString(aContentHash) && aReader.ReadString(aPolicy.mName) &&
+                 aReader.ReadString(aPolicy.mUrl) && aReader.ReadUint16(ruleCount));
+
+    aPolicy.mRules.resize(ruleCount);
+
+    for (PolicyRule &rule : aPolicy.mRules)
+    {
+        uint8_t direction;
+        uint8_t connection;
+
+        VerifyOrExit(aReader.ReadUint8(direction) && direction <= PolicyRule::kFromDevice);
+        rule.mDirection = static_cast<PolicyRule::Direction>(direction);
+
+        VerifyOrExit(aReader.ReadUint8(connection) && connection <= PolicyRule::kReply);
+        rule.mConnection = static_cast<PolicyRule::Connection>(connection);
+
+        VerifyOrExit(aReader.ReadUint8(rule.mProtocol) && aReader.ReadUint16(rule.mSrcPort) &&
+                     aReader.ReadUint16(rule.mDstPort) && aReader.ReadString(rule.mAclName) &&
+                     aReader.ReadString(rule.mAceName) && aReader.ReadString(rule.mSrcDnsName) &&
+                     aReader.ReadString(rule.mDstDnsName));
+    }
+
+    ret = true;
+
+exit:
+    return ret;
+}
+
+void WritePolicy(Writer &aWriter, const std::string &aContentHash, const Policy &aPolicy)
+{
+    aWriter.AppendString(aContentHash);
+    aWriter.AppendString(aPolicy.mName);
+    aWriter.AppendString(aPolicy.mUrl);
+    aWriter.AppendUint16(static_cast<uint16_t>(aPolicy.mRules.size()));
+
+    for (const PolicyRule &rule : aPolicy.mRules)
+    {
+        aWriter.AppendUint8(rule.mDirection);
+        aWriter.AppendUint8(rule.mConnection);
+        aWriter.AppendUint8(rule.mProtocol);
+        aWriter.AppendUint16(rule.mSrcPort);
+        aWriter.AppendUint16(rule.mDstPort);
+        aWriter.AppendString(rule.mAclName);
+        aWriter.AppendString(rule.mAceName);
+        aWriter.AppendString(rule.mSrcDnsName);
+        aWriter.AppendString(rule.mDstDnsName);
+    }
+}
+
+} // namespace
+
+constexpr uint16_t MudStore::kVersion;
+
+MudStore::MudStore(const std::string &aPath)
+    : mPath(aPath)
+{
+}
+
+bool MudStore::Load(PolicyMap &aPolicies, BindingMap &aBindings) const
+{
+    int                      fd   = -1;
+    void                    *data = MAP_FAILED;
+    struct stat              st;
+    std::vector<std::string> contentHashes;
+    char                     magic[sizeof(kMagic)];
+    uint16_t                 version;
+    uint16_t                 reserved;
+    uint32_t                 policyCount;
+    uint32_t                 bindingCount;
+    uint32_t                 payloadLength;
+    uint8_t                  hash[kHashLength];
+    uint8_t                  computedHash[kHashLength];
+    bool                     ret = false;
+
+    aPolicies.clear();
+    aBindings.clear();
+
+    fd = open(mPath.c_str(), O_RDONLY | O_CLOEXEC);
+    VerifyOrExit(fd >= 0);
+    VerifyOrExit(fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= kHeaderLength);
+
+    data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    VerifyOrExit(data != MAP_FAILED);
+
+    {
+        Reader reader(static_cast<const uint8_t *>(data), static_cast<size_t>(st.st_size));
+
+        reader.ReadBytes(magic, sizeof(magic));
+        reader.ReadUint16(version);
+        reader.ReadUint16(reserved);
+        reader.ReadUint32(policyCount);
+        reader.ReadUint32(bindingCount);
+        reader.ReadUint32(payloadLength);
+        reader.ReadBytes(hash, sizeof(hash));
+        OTBR_UNUSED_VARIABLE(reserved);
+
+        VerifyOrExit(memcmp(magic, kMagic, sizeof(kMagic)) == 0 && version == kVersion,
+                     otbrLogWarning("Ignoring MUD state %s of another version", mPath.c_str()));
+        VerifyOrExit(payloadLength == reader.GetRemaining() && policyCount <= kMaxCount &&
+                     bindingCount <= kMaxCount);
+
+        ComputeHash(static_cast<const uint8_t *>(data) + kHeaderLength, payloadLength, computedHash);
+        VerifyOrExit(memcmp(hash, computedHash, sizeof(hash)) == 0);
+
+        for (uint32_t i = 0; i < policyCount; i++)
+        {
+            std::string contentHash;
+            Policy      policy;
+
+            VerifyOrExit(ReadPolicy(reader, contentHash, policy));
+            contentHashes.push_back(contentHash);
+            aPolicies[contentHash] = std::move(policy);
+        }
+
+        for (uint32_t i = 0; i < bindingCount; i++)
+        {
+            uint8_t  extAddress[kExtAddrLength];
+            char     extAddressHex[sizeof(extAddress) * 2 + 1];
+            uint16_t policyIndex;
+            uint16_t addressCount;
+            Binding  binding;
+
+            VerifyOrExit(reader.ReadBytes(extAddress, sizeof(extAddress)) && reader.ReadUint16(policyIndex) &&
+                         reader.ReadUint16(addressCount) && policyIndex < contentHashes.size());
+
+            binding.mContentHash = contentHashes[policyIndex];
+
+            for (uint16_t j = 0; j < addressCount; j++)
+            {
+                uint8_t address[kAddressLength];
+                char    addressString[INET6_ADDRSTRLEN];
+
+                VerifyOrExit(reader.ReadBytes(address, sizeof(address)));
+                inet_ntop(AF_INET6, address, addressString, sizeof(addressString));
+                binding.mAddresses.insert(addressString);
+            }
+
+            Utils::Bytes2Hex(extAddress, sizeof(extAddress), extAddressHex);
+            aBindings[extAddressHex] = std::move(binding);
+        }
+
+        VerifyOrExit(reader.GetRemaining() == 0);
+    }
+
+    otbrLogInfo("Loaded %zu MUD policies and %zu devices from %s", aPolicies.size(), aBindings.size(),
+                mPath.c_str());
+    ret = true;
+
+exit:
+    if (!ret && fd >= 0)
+    {
+        otbrLogWarning("Ignoring invalid MUD state %s", mPath.c_str());
+        aPolicies.clear();
+        aBindings.clear();
+    }
+
+    if (data != MAP_FAILED)
+    {
+        munmap(data, static_cast<size_t>(st.st_size));
+    }
+
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    return ret;
+}
+
+bool MudStore::Save(const PolicyMap &aPolicies, const BindingMap &aBindings) const
+{
+    std::map<std::string, uint16_t> policyIndexes;
+    Writer                          payload;
+    Writer                          header;
+    uint8_t                         hash[kHashLength];
+    uint32_t                        bindingCount = 0;
+    std::string                     tmpPath      = mPath + ".tmp";
+    int                             fd           = -1;
+    int                             closed;
+    bool                            ret = false;
+
+    VerifyOrExit(aPolicies.size() <= kMaxCount && aBindings.size() <= kMaxCount);
+
+    for (const auto &policy : aPolicies)
+    {
+        policyIndexes[policy.first] = static_cast<uint16_t>(policyIndexes.size());
+        WritePolicy(payload, policy.first, policy.second);
+    }
+
+    for (const auto &binding : aBindings)
+    {
+        auto     index = policyIndexes.find(binding.second.mContentHash);
+        uint8_t  extAddress[kExtAddrLength];
+        size_t   countOffset;
+        uint16_t addressCount = 0;
+
+        if (index == policyIndexes.end() ||
+            Utils::Hex2Bytes(binding.first.c_str(), extAddress, sizeof(extAddress)) != sizeof(extAddress))
+        {
+            continue;
+        }
+
+        payload.AppendBytes(extAddress, sizeof(extAddress));
+        payload.AppendUint16(index->second);
+        countOffset = payload.GetBuffer().size();
+        payload.AppendUint16(0);
+
+        for (const std::string &address : binding.second.mAddresses)
+        {
+            uint8_t bytes[kAddressLength];
+
+            if (addressCount < kMaxCount && inet_pton(AF_INET6, address.c_str(), bytes) == 1)
+            {
+                payload.AppendBytes(bytes, sizeof(bytes));
+                addressCount++;
+            }
+        }
+
+        payload.GetBuffer()[countOffset]     = static_cast<char>(addressCount);
+        payload.GetBuffer()[countOffset + 1] = static_cast<char>(addressCount >> 8);
+        bindingCount++;
+    }
+
+    ComputeHash(payload.GetBuffer().data(), payload.GetBuffer().size(), hash);
+
+    header.AppendBytes(kMagic, sizeof(kMagic));
+    header.AppendUint16(kVersion);
+    header.AppendUint16(0);
+    header.AppendUint32(static_cast<uint32_t>(aPolicies.size()));
+    header.AppendUint32(bindingCount);
+    header.AppendUint32(static_cast<uint32_t>(payload.GetBuffer().size()));
+    header.AppendBytes(hash, sizeof(hash));
+    header.GetBuffer().append(payload.GetBuffer());
+
+    fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    VerifyOrExit(fd >= 0);
+    VerifyOrExit(write(fd, header.GetBuffer().data(), header.GetBuffer().size()) ==
+                 static_cast<ssize_t>(header.GetBuffer().size()));
+    VerifyOrExit(fsync(fd) == 0);
+    closed = close(fd);
+    fd     = -1;
+    VerifyOrExit(closed == 0);
+    VerifyOrExit(rename(tmpPath.c_str(), mPath.c_str()) == 0);
+
+    ret = true;
+
+exit:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    if (!ret)
+    {
+        otbrLogWarning("Failed to persist MUD state %s: %s", mPath.c_str(), strerror(errno));
+        remove(tmpPath.c_str());
+    }
+
+    return ret;
+}
+
+} // namespace MUD
+} // namespace otbr
@@ -0,0 +1,116 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the persistent MUD state store.
+ */
+
+#ifndef OTBR_MUD_STORE_HPP_
+#define OTBR_MUD_STORE_HPP_
+
+#include <map>
+#include <set>
+#include <string>
+
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+#include "mud_manager/mud_firewall.hpp"
+
+namespace otbr {
+namespace MUD {
+
+/**
+ * This class implements the on-disk store of the compiled MUD policies and of the devices bound to them.
+ *
+ * The state is written as a single versioned binary file: a fixed header followed by length-prefixed records, the
+ * devices referencing their policy by index and carrying their addresses in binary form. The file is replaced
+ * atomically, so that a crash leaves either the previous or the new state, and it is mapped in memory when loaded.
+ *
+ */
+class MudStore : private NonCopyable
+{
+public:
+    typedef std::set<std::string> AddressSet;
+
+    /**
+     * This structure represents a device bound to a policy.
+     *
+     */
+    struct Binding
+    {
+        std::string mContentHash; ///< The content hash of the MUD file the policy is compiled from.
+        AddressSet  mAddresses;   ///< The IPv6 addresses of the device.
+    };
+
+    typedef std::map<std::string, Policy>  PolicyMap;  ///< Policies keyed by MUD file content hash.
+    typedef std::map<std::string, Binding> BindingMap; ///< Bindings keyed by hex extended address.
+
+    static constexpr uint16_t kVersion = 2; ///< The version of the file format.
+
+    /**
+     * This constructor initializes the store.
+     *
+     * @param[in] aPath  The path of the state file.
+     *
+     */
+    explicit MudStore(const std::string &aPath);
+
+    /**
+     * This method loads the persisted state.
+     *
+     * @param[out] aPolicies  The persisted policies.
+     * @param[out] aBindings  The persisted bindings.
+     *
+     * @retval TRUE   Successfully loaded the state.
+     * @retval FALSE  There is no state, or it is invalid or of another version.
+     *
+     */
+    bool Load(PolicyMap &aPolicies, BindingMap &aBindings) const;
+
+    /**
+     * This method persists the state, replacing the previous one.
+     *
+     * @param[in] aPolicies  The policies.
+     * @param[in] aBindings  The bindings, only those referencing a policy of @p aPolicies are persisted.
+     *
+     * @retval TRUE   Successfully persisted the state.
+     * @retval FALSE  Failed to persist the state.
+     *
+     */
+    bool Save(const PolicyMap &aPolicies, const BindingMap &aBindings) const;
+
+private:
+    std::string mPath;
+};
+
+} // namespace MUD
+} // namespace otbr
+
+#endif // OTBR_MUD_STORE_HPP_
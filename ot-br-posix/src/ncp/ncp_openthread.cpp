@@ -66,8 +66,7 @@ ControllerOpenThread::ControllerOpenThread(const char                      *aInt
                                            const std::vector<const char *> &aRadioUrls,
                                            const char                      *aBackboneInterfaceName,
                                            bool                             aDryRun,
-                                           bool                             aEnableAutoAttach,
-                                           otMessageQueue                  *aMudQueue)
+                                           bool                             aEnableAutoAttach)
     : mInstance(nullptr)
     , mEnableAutoAttach(aEnableAutoAttach)
 {
@@ -78,7 +77,6 @@ ControllerOpenThread::ControllerOpenThread(const char                      *aInt
     mConfig.mInterfaceName         = aInterfaceName;
     mConfig.mBackboneInterfaceName = aBackboneInterfaceName;
     mConfig.mDryRun                = aDryRun;
-    mConfig.mMudQueue              = aMudQueue;
 
     for (const char *url : aRadioUrls)
     {
@@ -236,10 +234,6 @@ void ControllerOpenThread::Init(void)
 #endif
 #endif
 
-#if OTBR_ENABLE_MUD_MANAGER
-    otThreadSetMudQueuePointer(mInstance, mConfig.mMudQueue);
-#endif
-
 #if !OTBR_ENABLE_FEATURE_FLAGS
     // Bring up all features when feature flags is not supported.
 #if OTBR_ENABLE_NAT64
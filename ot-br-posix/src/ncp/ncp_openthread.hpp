@@ -81,8 +81,7 @@ public:
                          const std::vector<const char *> &aRadioUrls,
                          const char                      *aBackboneInterfaceName,
                          bool                             aDryRun,
-                         bool                             aEnableAutoAttach,
-                         otMessageQueue                  *aMudQueue);
+                         bool                             aEnableAutoAttach);
 
     /**
      * This method initialize the NCP controller.
@@ -43,8 +43,9 @@ using std::chrono::steady_clock;
 namespace otbr {
 namespace rest {
 
-// The timeout (in microseconds) since a connection is in wait callback state
-static const uint32_t kCallbackTimeout = 10000000;
+// The timeout (in microseconds) since a connection is in wait callback state, longer than the wait of a diagnostics
+// request for changes.
+static const uint32_t kCallbackTimeout = 30000000;
 
 // The time interval (in microseconds) for checking again if there is a connection need callback.
 static const uint32_t kCallbackCheckInterval = 500000;
@@ -55,153 +56,180 @@ static const uint32_t kWriteTimeout = 10000000;
 // The timeout (in microseconds) since a connection is in wait read state
 static const uint32_t kReadTimeout = 1000000;
 
-Connection::Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd)
+// The timeout (in microseconds) since a persistent connection is idle
+static const uint32_t kIdleTimeout = OTBR_REST_IDLE_TIMEOUT * 1000000;
+
+Connection::Connection(steady_clock::time_point aStartTime,
+                       Resource                *aResource,
+                       int                      aFd,
+                       CompleteHandler          aCompleteHandler,
+                       IdleHandler              aIdleHandler)
     : mTimeStamp(aStartTime)
     , mFd(aFd)
     , mState(ConnectionState::kInit)
     , mParser(&mRequest)
     , mResource(aResource)
+    , mKeepAlive(false)
+    , mWriteOffset(0)
+    , mTimerId(0)
+    , mCompleteHandler(std::move(aCompleteHandler))
+    , mIdleHandler(std::move(aIdleHandler))
 {
 }
 
 Connection::~Connection(void)
 {
-    Disconnect();
+    if (mState != ConnectionState::kComplete)
+    {
+        MainloopManager::GetInstance().RemoveFd(mFd);
+        StopTimer();
+    }
+
+    close(mFd);
 }
 
-void Connection::Init(void)
+otbrError Connection::Init(void)
 {
+    otbrError error;
+
     mParser.Init();
+
+    // Initial state, read as soon as the request arrives.
+    error = MainloopManager::GetInstance().AddFd(mFd, MainloopManager::kEventReadable,
+                                                 [this](uint32_t aEvents) { HandleFdEvents(aEvents); });
+    SuccessOrExit(error);
+
+    StartTimer(kReadTimeout);
+
+exit:
+    return error;
 }
 
-void Connection::UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const
+void Connection::StartTimer(uint32_t aTimeout)
 {
-    if (mState == ConnectionState::kReadWait || mState == ConnectionState::kInit)
-    {
-        FD_SET(mFd, &aReadFdSet);
-        aMaxFd = aMaxFd < mFd ? mFd : aMaxFd;
-    }
+    StopTimer();
+    mTimerId = MainloopManager::GetInstance().AddTimer(duration_cast<Milliseconds>(microseconds(aTimeout)),
+                                                       [this]() { HandleTimeout(); });
 }
 
-void Connection::UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const
+void Connection::StopTimer(void)
 {
-    if (mState == ConnectionState::kWriteWait)
+    if (mTimerId != 0)
     {
-        FD_SET(mFd, &aWriteFdSet);
-        aMaxFd = aMaxFd < mFd ? mFd : aMaxFd;
+        MainloopManager::GetInstance().CancelTimer(mTimerId);
+        mTimerId = 0;
     }
 }
 
-void Connection::UpdateTimeout(timeval &aTimeout) const
+void Connection::HandleFdEvents(uint32_t aEvents)
 {
-    struct timeval timeout;
-    uint32_t       timeoutLen = kReadTimeout;
-    auto           duration   = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    OTBR_UNUSED_VARIABLE(aEvents);
 
     switch (mState)
     {
+    case ConnectionState::kInit:
     case ConnectionState::kReadWait:
-        timeoutLen = kReadTimeout;
-        break;
-    case ConnectionState::kCallbackWait:
-        timeoutLen = kCallbackCheckInterval;
+    case ConnectionState::kIdle:
+        if (mRequest.IsComplete())
+        {
+            // A pipelined request, the socket is writable for its response.
+            Handle();
+        }
+        else
+        {
+            ProcessWaitRead();
+        }
         break;
     case ConnectionState::kWriteWait:
-        timeoutLen = kWriteTimeout;
-        break;
-    case ConnectionState::kComplete:
-        timeoutLen = 0;
+        ProcessWaitWrite();
         break;
     default:
         break;
     }
-
-    if (duration <= timeoutLen)
-    {
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = timeoutLen - duration;
-    }
-    else
-    {
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = 0;
-    }
-
-    if (timercmp(&timeout, &aTimeout, <))
-    {
-        aTimeout = timeout;
-    }
 }
 
-void Connection::Update(MainloopContext &aMainloop)
+void Connection::HandleTimeout(void)
 {
-    UpdateTimeout(aMainloop.mTimeout);
-    UpdateReadFdSet(aMainloop.mReadFdSet, aMainloop.mMaxFd);
-    UpdateWriteFdSet(aMainloop.mWriteFdSet, aMainloop.mMaxFd);
-}
-
-void Connection::Disconnect(void)
-{
-    mState = ConnectionState::kComplete;
-
-    if (mFd != -1)
-    {
-        close(mFd);
-        mFd = -1;
-    }
-}
-
-void Connection::Process(const MainloopContext &aMainloop)
-{
-    otbrError error = OTBR_ERROR_NONE;
+    mTimerId = 0;
 
     switch (mState)
     {
-    // Initial state, directly read for the first time.
     case ConnectionState::kInit:
     case ConnectionState::kReadWait:
-        ProcessWaitRead(aMainloop.mReadFdSet);
+        // Reach a read timeout, send response about this timeout.
+        mKeepAlive = false;
+        mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusRequestTimeout);
+        Write();
+        break;
+    case ConnectionState::kIdle:
+        Disconnect();
         break;
     case ConnectionState::kCallbackWait:
-        //  Wait for Callback process.
         ProcessWaitCallback();
         break;
     case ConnectionState::kWriteWait:
-        ProcessWaitWrite(aMainloop.mWriteFdSet);
+        Disconnect();
         break;
     default:
-        assert(false);
+        break;
     }
+}
 
-    if (error != OTBR_ERROR_NONE)
-    {
-        Disconnect();
-    }
+void Connection::Disconnect(void)
+{
+    VerifyOrExit(mState != ConnectionState::kComplete);
+
+    mState = ConnectionState::kComplete;
+
+    MainloopManager::GetInstance().RemoveFd(mFd);
+    StopTimer();
+
+    // The socket is closed when the connection is freed, so that its
+    // file descriptor is not reused before.
+    shutdown(mFd, SHUT_RDWR);
+
+    mCompleteHandler();
+
+exit:
+    return;
 }
 
-void Connection::ProcessWaitRead(const fd_set &aReadFdSet)
+void Connection::ProcessWaitRead(void)
 {
     otbrError error    = OTBR_ERROR_NONE;
     int32_t   received = 0, err;
     char      buf[2048];
+    size_t    parsed;
     auto      duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
 
     // Reach a read timeout, will send response about this timeout later.
-    VerifyOrExit(duration <= kReadTimeout, error = OTBR_ERROR_REST);
-
-    // It will succeed either fd is set or it is in kInit state.
-    VerifyOrExit(FD_ISSET(mFd, &aReadFdSet) || mState == ConnectionState::kInit);
+    VerifyOrExit(mState == ConnectionState::kIdle || duration <= kReadTimeout, error = OTBR_ERROR_REST);
 
     do
     {
-        mState   = ConnectionState::kReadWait;
         received = read(mFd, buf, sizeof(buf));
         err      = errno;
         if (received > 0)
         {
-            mParser.Process(buf, received);
+            if (mState == ConnectionState::kIdle)
+            {
+                // The next request begins, it has to be received within the read timeout.
+                mTimeStamp = steady_clock::now();
+                StartTimer(kReadTimeout);
+            }
+
+            mState = ConnectionState::kReadWait;
+            parsed = mParser.Process(buf, static_cast<size_t>(received));
+
+            if (mRequest.IsComplete())
+            {
+                mReadBuffer.assign(buf + parsed, static_cast<size_t>(received) - parsed);
+            }
         }
-    } while ((received > 0 && !mRequest.IsComplete()) || err == EINTR);
+    } while ((received > 0 && !mRequest.IsComplete()) || (received < 0 && err == EINTR));
+
+    // The client closed the persistent connection between two requests.
+    VerifyOrExit(received != 0 || mState != ConnectionState::kIdle, Disconnect());
 
     if (mRequest.IsComplete())
     {
@@ -219,6 +247,8 @@ void Connection::ProcessWaitRead(const fd_set &aReadFdSet)
 exit:
     if (error != OTBR_ERROR_NONE)
     {
+        mKeepAlive = false;
+
         if (received < 0)
         {
             mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
@@ -236,9 +266,10 @@ void Connection::Handle(void)
 {
     otbrError error = OTBR_ERROR_NONE;
 
-    // Try to close server read side here, because we have started to handle the request and no longler read from
-    // socket.
-    VerifyOrExit((shutdown(mFd, SHUT_RD) == 0), error = OTBR_ERROR_REST);
+    mKeepAlive = mRequest.IsKeepAlive();
+
+    // Stop reading from the socket while the request is handled, the requests pipelined after it wait in the socket.
+    SuccessOrExit(error = MainloopManager::GetInstance().UpdateFd(mFd, 0));
 
     mResource->Handle(mRequest, mResponse);
 
@@ -246,6 +277,7 @@ void Connection::Handle(void)
     {
         mState     = ConnectionState::kCallbackWait;
         mTimeStamp = steady_clock::now();
+        StartTimer(kCallbackCheckInterval);
     }
     else
     {
@@ -257,11 +289,66 @@ exit:
 
     if (error != OTBR_ERROR_NONE)
     {
+        mKeepAlive = false;
         mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
         Write();
     }
 }
 
+void Connection::HandleNextRequest(void)
+{
+    otbrError   error = OTBR_ERROR_NONE;
+    std::string pipelined;
+    size_t      parsed;
+
+    mRequest  = Request();
+    mResponse = Response();
+    mWriteContent.clear();
+    mWriteOffset = 0;
+    mState       = ConnectionState::kIdle;
+    mTimeStamp   = steady_clock::now();
+
+    mParser.Resume();
+    pipelined.swap(mReadBuffer);
+
+    if (!pipelined.empty())
+    {
+        mState = ConnectionState::kReadWait;
+        parsed = mParser.Process(pipelined.data(), pipelined.size());
+
+        if (mRequest.IsComplete())
+        {
+            mReadBuffer.assign(pipelined, parsed, std::string::npos);
+        }
+    }
+
+    if (mRequest.IsComplete())
+    {
+        // Handle the pipelined request from the mainloop, so that a client does not hold it with many requests.
+        SuccessOrExit(error = MainloopManager::GetInstance().UpdateFd(mFd, MainloopManager::kEventWritable));
+        StartTimer(kReadTimeout);
+        ExitNow();
+    }
+
+    SuccessOrExit(error = MainloopManager::GetInstance().UpdateFd(mFd, MainloopManager::kEventReadable));
+
+    if (mState == ConnectionState::kIdle)
+    {
+        StartTimer(kIdleTimeout);
+        mIdleHandler();
+    }
+    else
+    {
+        StartTimer(kReadTimeout);
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        Disconnect();
+    }
+}
+
 void Connection::ProcessWaitCallback(void)
 {
     auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
@@ -272,26 +359,24 @@ void Connection::ProcessWaitCallback(void)
     {
         Write();
     }
+    else if (duration >= kCallbackTimeout)
+    {
+        mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
+        Write();
+    }
     else
     {
-        if (duration >= kCallbackTimeout)
-        {
-            mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
-            Write();
-        }
+        StartTimer(kCallbackCheckInterval);
     }
 }
 
-void Connection::ProcessWaitWrite(const fd_set &aWriteFdSet)
+void Connection::ProcessWaitWrite(void)
 {
     auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
 
     if (duration <= kWriteTimeout)
     {
-        if (FD_ISSET(mFd, &aWriteFdSet))
-        {
-            Write();
-        }
+        Write();
     }
     else
     {
@@ -301,50 +386,68 @@ void Connection::ProcessWaitWrite(const fd_set &aWriteFdSet)
 
 void Connection::Write(void)
 {
-    otbrError   error = OTBR_ERROR_NONE;
-    std::string errorCode;
-    int32_t     sendLength;
-    int32_t     err;
+    otbrError error = OTBR_ERROR_NONE;
+    bool      sent  = false;
+    ssize_t   sendLength;
 
     if (mState != ConnectionState::kWriteWait)
     {
         // Change its state when try write for the first time.
-        mState        = ConnectionState::kWriteWait;
-        mTimeStamp    = steady_clock::now();
+        mState = ConnectionState::kWriteWait;
+        mResponse.SetHeader("Connection", mKeepAlive ? "keep-alive" : "close");
         mWriteContent = mResponse.Serialize();
+        mWriteOffset  = 0;
+        mTimeStamp    = steady_clock::now();
+        sent          = true;
     }
 
-    // Check we do have something to write.
-    VerifyOrExit(mWriteContent.size() > 0, error = OTBR_ERROR_REST);
+    while (true)
+    {
+        if (mWriteOffset == mWriteContent.size())
+        {
+            // Serialize the next chunk of a streamed body, only once the previous one has been sent.
+            mResponse.SerializeChunk(mWriteContent);
+            mWriteOffset = 0;
+
+            if (mWriteContent.empty())
+            {
+                // Normal Exit
+                if (mKeepAlive)
+                {
+                    HandleNextRequest();
+                }
+                else
+                {
+                    Disconnect();
+                }
+                ExitNow();
+            }
+        }
 
-    sendLength = write(mFd, mWriteContent.c_str(), mWriteContent.size());
-    err        = errno;
+        sendLength = write(mFd, mWriteContent.data() + mWriteOffset, mWriteContent.size() - mWriteOffset);
 
-    // Write successfully
-    if (sendLength == static_cast<int32_t>(mWriteContent.size()))
-    {
-        // Normal Exit
-        Disconnect();
-    }
-    else if (sendLength > 0)
-    {
-        // Partly write
-        mWriteContent = mWriteContent.substr(sendLength);
-    }
-    else
-    {
-        if (errno == EINTR)
+        if (sendLength > 0)
         {
-            // Try again
-            Write();
+            // The write timeout restarts whenever some data is sent, a large body may take longer.
+            mWriteOffset += static_cast<size_t>(sendLength);
+            sent = true;
         }
-        else
+        else if (errno != EINTR)
         {
             // There is an error when we write, if this, we directly disconnect this connection.
-            VerifyOrExit(err == EAGAIN || err == EWOULDBLOCK, error = OTBR_ERROR_REST);
+            VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK, error = OTBR_ERROR_REST);
+            break;
         }
     }
 
+    // Wait for the socket to be writable again, at most the write timeout since the last data sent.
+    if (sent)
+    {
+        mTimeStamp = steady_clock::now();
+        StartTimer(kWriteTimeout);
+    }
+    SuccessOrExit(error = MainloopManager::GetInstance().UpdateFd(mFd, MainloopManager::kEventWritable));
+
 exit:
     if (error != OTBR_ERROR_NONE)
     {
@@ -37,50 +37,85 @@
 #include <string.h>
 #include <unistd.h>
 
-#include "common/mainloop.hpp"
+#include <functional>
+
+#include "common/mainloop_manager.hpp"
 #include "rest/parser.hpp"
 #include "rest/resource.hpp"
 
 using std::chrono::steady_clock;
 
+/**
+ * Timeout after which an idle persistent connection is closed (in seconds).
+ *
+ */
+#ifndef OTBR_REST_IDLE_TIMEOUT
+#define OTBR_REST_IDLE_TIMEOUT 30
+#endif
+
 namespace otbr {
 namespace rest {
 
 /**
  * This class implements a Connection class of each socket connection.
  *
+ * The socket is watched by the mainloop manager only for the events the
+ * current state waits for, and the timeout of the state runs on a timer.
+ *
+ * The connection persists after a response unless the client or an error
+ * closes it. Pipelined requests are answered in order, one at a time.
+ *
  */
-class Connection : public MainloopProcessor
+class Connection
 {
 public:
+    /**
+     * This type represents the handler called when a connection completes.
+     *
+     * The connection must not be freed from the handler.
+     *
+     */
+    typedef std::function<void(void)> CompleteHandler;
+
+    /**
+     * This type represents the handler called when a persistent connection becomes idle.
+     *
+     */
+    typedef std::function<void(void)> IdleHandler;
+
     /**
      * The constructor is to initialize a socket connection instance.
      *
-     * @param[in] aStartTime  The reference start time of a connection which
-     *                        is set when created for the first time and maybe
-     *                        reset when transfer to wait callback or wait write
-     *                        state.
-     * @param[in] aResource   A pointer to the resource handler.
-     * @param[in] aFd         The file descriptor for the connection.
+     * @param[in] aStartTime        The reference start time of a connection which
+     *                              is set when created for the first time and maybe
+     *                              reset when transfer to wait callback or wait write
+     *                              state.
+     * @param[in] aResource         A pointer to the resource handler.
+     * @param[in] aFd               The file descriptor for the connection.
+     * @param[in] aCompleteHandler  The handler called when the connection completes.
+     * @param[in] aIdleHandler      The handler called when the connection becomes idle.
      *
      */
-    Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd);
+    Connection(steady_clock::time_point aStartTime,
+               Resource                *aResource,
+               int                      aFd,
+               CompleteHandler          aCompleteHandler,
+               IdleHandler              aIdleHandler);
 
     /**
-     * The desctructor destroys the connection instance.
+     * The desctructor destroys the connection instance and closes its socket.
      *
      */
-    ~Connection(void) override;
+    ~Connection(void);
 
     /**
      * This method initializes the connection.
      *
+     * @retval OTBR_ERROR_NONE   Successfully initialized the connection.
+     * @retval OTBR_ERROR_ERRNO  Failed to watch the socket of the connection.
      *
      */
-    void Init(void);
-
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    otbrError Init(void);
 
     /**
      * This method indicates whether this connection no longer need to be processed.
@@ -91,15 +126,34 @@ public:
      */
     bool IsComplete(void) const;
 
+    /**
+     * This method indicates whether this connection waits for the next request, without any of it received.
+     *
+     * @retval TRUE   This connection is idle.
+     * @retval FALSE  This connection is serving a request.
+     *
+     */
+    bool IsIdle(void) const { return mState == ConnectionState::kIdle; }
+
+    /**
+     * This method returns the time this connection became idle.
+     *
+     * @returns The time this connection became idle, only meaningful when it is idle.
+     *
+     */
+    steady_clock::time_point GetIdleStartTime(void) const { return mTimeStamp; }
+
 private:
-    void UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const;
-    void UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const;
-    void UpdateTimeout(timeval &aTimeout) const;
-    void ProcessWaitRead(const fd_set &aReadFdSet);
+    void HandleFdEvents(uint32_t aEvents);
+    void HandleTimeout(void);
+    void StartTimer(uint32_t aTimeout);
+    void StopTimer(void);
+    void ProcessWaitRead(void);
     void ProcessWaitCallback(void);
-    void ProcessWaitWrite(const fd_set &aWriteFdSet);
+    void ProcessWaitWrite(void);
     void Write(void);
     void Handle(void);
+    void HandleNextRequest(void);
     void Disconnect(void);
 
     // Timestamp used for each check point of a connection
@@ -123,8 +177,26 @@ private:
     // Resource handler instance
     Resource *mResource;
 
+    // Data received after a complete request, the beginning of the pipelined requests
+    std::string mReadBuffer;
+
+    // Whether the connection persists after the current response
+    bool mKeepAlive;
+
     // Write buffer in case write multiple times
     std::string mWriteContent;
+
+    // The length of the write buffer already sent
+    size_t mWriteOffset;
+
+    // Timer of the timeout of the current state
+    TimerWheel::TimerId mTimerId;
+
+    // Handler called when the connection completes
+    CompleteHandler mCompleteHandler;
+
+    // Handler called when the connection becomes idle
+    IdleHandler mIdleHandler;
 };
 
 } // namespace rest
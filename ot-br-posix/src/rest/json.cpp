@@ -35,6 +35,8 @@ extern "C" {
 #include <cJSON.h>
 }
 
+#include <rapidjson/writer.h>
+
 namespace otbr {
 namespace rest {
 namespace Json {
@@ -49,6 +51,250 @@ static cJSON *Bytes2HexJson(const uint8_t *aBytes, uint8_t aLength)
     return cJSON_CreateString(hex);
 }
 
+namespace {
+
+// This class implements a rapidjson output stream appending to a string.
+class StringOutputStream
+{
+public:
+    typedef char Ch;
+
+    explicit StringOutputStream(std::string &aString)
+        : mString(aString)
+    {
+    }
+
+    void Put(char aChar) { mString.push_back(aChar); }
+    void Flush(void) {}
+
+private:
+    std::string &mString;
+};
+
+typedef rapidjson::Writer<StringOutputStream> DiagWriter;
+
+void WriteHex(DiagWriter &aWriter, const uint8_t *aBytes, uint8_t aLength)
+{
+    char hex[2 * OT_NETWORK_BASE_TLV_MAX_LENGTH + 1];
+
+    otbr::Utils::Bytes2Hex(aBytes, aLength, hex);
+    aWriter.String(hex, 2 * aLength);
+}
+
+void WriteIpAddr(DiagWriter &aWriter, const otIp6Address &aAddress)
+{
+    std::string addr = Ip6Address(aAddress.mFields.m8).ToString();
+
+    aWriter.String(addr.c_str(), static_cast<rapidjson::SizeType>(addr.size()));
+}
+
+void WriteMode(DiagWriter &aWriter, const otLinkModeConfig &aMode)
+{
+    aWriter.StartObject();
+    aWriter.Key("RxOnWhenIdle");
+    aWriter.Uint(aMode.mRxOnWhenIdle);
+    aWriter.Key("DeviceType");
+    aWriter.Uint(aMode.mDeviceType);
+    aWriter.Key("NetworkData");
+    aWriter.Uint(aMode.mNetworkData);
+    aWriter.EndObject();
+}
+
+void WriteConnectivity(DiagWriter &aWriter, const otNetworkDiagConnectivity &aConnectivity)
+{
+    aWriter.StartObject();
+    aWriter.Key("ParentPriority");
+    aWriter.Int(aConnectivity.mParentPriority);
+    aWriter.Key("LinkQuality3");
+    aWriter.Uint(aConnectivity.mLinkQuality3);
+    aWriter.Key("LinkQuality2");
+    aWriter.Uint(aConnectivity.mLinkQuality2);
+    aWriter.Key("LinkQuality1");
+    aWriter.Uint(aConnectivity.mLinkQuality1);
+    aWriter.Key("LeaderCost");
+    aWriter.Uint(aConnectivity.mLeaderCost);
+    aWriter.Key("IdSequence");
+    aWriter.Uint(aConnectivity.mIdSequence);
+    aWriter.Key("ActiveRouters");
+    aWriter.Uint(aConnectivity.mActiveRouters);
+    aWriter.Key("SedBufferSize");
+    aWriter.Uint(aConnectivity.mSedBufferSize);
+    aWriter.Key("SedDatagramCount");
+    aWriter.Uint(aConnectivity.mSedDatagramCount);
+    aWriter.EndObject();
+}
+
+void WriteRoute(DiagWriter &aWriter, const otNetworkDiagRoute &aRoute)
+{
+    aWriter.StartObject();
+    aWriter.Key("IdSequence");
+    aWriter.Uint(aRoute.mIdSequence);
+    aWriter.Key("RouteData");
+    aWriter.StartArray();
+    for (uint16_t i = 0; i < aRoute.mRouteCount; ++i)
+    {
+        const otNetworkDiagRouteData &routeData = aRoute.mRouteData[i];
+
+        aWriter.StartObject();
+        aWriter.Key("RouteId");
+        aWriter.Uint(routeData.mRouterId);
+        aWriter.Key("LinkQualityOut");
+        aWriter.Uint(routeData.mLinkQualityOut);
+        aWriter.Key("LinkQualityIn");
+        aWriter.Uint(routeData.mLinkQualityIn);
+        aWriter.Key("RouteCost");
+        aWriter.Uint(routeData.mRouteCost);
+        aWriter.EndObject();
+    }
+    aWriter.EndArray();
+    aWriter.EndObject();
+}
+
+void WriteLeaderData(DiagWriter &aWriter, const otLeaderData &aLeaderData)
+{
+    aWriter.StartObject();
+    aWriter.Key("PartitionId");
+    aWriter.Uint(aLeaderData.mPartitionId);
+    aWriter.Key("Weighting");
+    aWriter.Uint(aLeaderData.mWeighting);
+    aWriter.Key("DataVersion");
+    aWriter.Uint(aLeaderData.mDataVersion);
+    aWriter.Key("StableDataVersion");
+    aWriter.Uint(aLeaderData.mStableDataVersion);
+    aWriter.Key("LeaderRouterId");
+    aWriter.Uint(aLeaderData.mLeaderRouterId);
+    aWriter.EndObject();
+}
+
+void WriteMacCounters(DiagWriter &aWriter, const otNetworkDiagMacCounters &aMacCounters)
+{
+    aWriter.StartObject();
+    aWriter.Key("IfInUnknownProtos");
+    aWriter.Uint(aMacCounters.mIfInUnknownProtos);
+    aWriter.Key("IfInErrors");
+    aWriter.Uint(aMacCounters.mIfInErrors);
+    aWriter.Key("IfOutErrors");
+    aWriter.Uint(aMacCounters.mIfOutErrors);
+    aWriter.Key("IfInUcastPkts");
+    aWriter.Uint(aMacCounters.mIfInUcastPkts);
+    aWriter.Key("IfInBroadcastPkts");
+    aWriter.Uint(aMacCounters.mIfInBroadcastPkts);
+    aWriter.Key("IfInDiscards");
+    aWriter.Uint(aMacCounters.mIfInDiscards);
+    aWriter.Key("IfOutUcastPkts");
+    aWriter.Uint(aMacCounters.mIfOutUcastPkts);
+    aWriter.Key("IfOutBroadcastPkts");
+    aWriter.Uint(aMacCounters.mIfOutBroadcastPkts);
+    aWriter.Key("IfOutDiscards");
+    aWriter.Uint(aMacCounters.mIfOutDiscards);
+    aWriter.EndObject();
+}
+
+void WriteChildTable(DiagWriter &aWriter, const otNetworkDiagChildEntry *aTable, uint8_t aCount)
+{
+    aWriter.StartArray();
+    for (uint16_t i = 0; i < aCount; ++i)
+    {
+        const otNetworkDiagChildEntry &childEntry = aTable[i];
+
+        aWriter.StartObject();
+        aWriter.Key("ChildId");
+        aWriter.Uint(childEntry.mChildId);
+        aWriter.Key("Timeout");
+        aWriter.Uint(childEntry.mTimeout);
+        aWriter.Key("Mode");
+        WriteMode(aWriter, childEntry.mMode);
+        aWriter.EndObject();
+    }
+    aWriter.EndArray();
+}
+
+} // namespace
+
+void AppendDiag2Json(const std::vector<otNetworkDiagTlv> &aDiag, std::string &aOutput)
+{
+    StringOutputStream stream(aOutput);
+    DiagWriter         writer(stream);
+
+    writer.StartObject();
+
+    for (const otNetworkDiagTlv &diagTlv : aDiag)
+    {
+        switch (diagTlv.mType)
+        {
+        case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
+            writer.Key("ExtAddress");
+            WriteHex(writer, diagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
+            writer.Key("Rloc16");
+            writer.Uint(diagTlv.mData.mAddr16);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
+            writer.Key("Mode");
+            WriteMode(writer, diagTlv.mData.mMode);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
+            writer.Key("Timeout");
+            writer.Uint(diagTlv.mData.mTimeout);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
+            writer.Key("Connectivity");
+            WriteConnectivity(writer, diagTlv.mData.mConnectivity);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
+            writer.Key("Route");
+            WriteRoute(writer, diagTlv.mData.mRoute);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
+            writer.Key("LeaderData");
+            WriteLeaderData(writer, diagTlv.mData.mLeaderData);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
+            writer.Key("NetworkData");
+            WriteHex(writer, diagTlv.mData.mNetworkData.m8, diagTlv.mData.mNetworkData.mCount);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
+            writer.Key("IP6AddressList");
+            writer.StartArray();
+            for (uint16_t i = 0; i < diagTlv.mData.mIp6AddrList.mCount; ++i)
+            {
+                WriteIpAddr(writer, diagTlv.mData.mIp6AddrList.mList[i]);
+            }
+            writer.EndArray();
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
+            writer.Key("MACCounters");
+            WriteMacCounters(writer, diagTlv.mData.mMacCounters);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
+            writer.Key("BatteryLevel");
+            writer.Uint(diagTlv.mData.mBatteryLevel);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
+            writer.Key("SupplyVoltage");
+            writer.Uint(diagTlv.mData.mSupplyVoltage);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
+            writer.Key("ChildTable");
+            WriteChildTable(writer, diagTlv.mData.mChildTable.mTable, diagTlv.mData.mChildTable.mCount);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
+            writer.Key("ChannelPages");
+            WriteHex(writer, diagTlv.mData.mChannelPages.m8, diagTlv.mData.mChannelPages.mCount);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
+            writer.Key("MaxChildTimeout");
+            writer.Uint(diagTlv.mData.mMaxChildTimeout);
+            break;
+        default:
+            break;
+        }
+    }
+
+    writer.EndObject();
+}
+
 std::string String2JsonString(const std::string &aString)
 {
     std::string ret;
@@ -237,127 +483,17 @@ std::string Node2JsonString(const NodeInfo &aNode)
 
 std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet)
 {
-    cJSON      *diagInfo          = cJSON_CreateArray();
-    cJSON      *diagInfoOfOneNode = nullptr;
-    cJSON      *addrList          = nullptr;
-    cJSON      *tableList         = nullptr;
-    std::string ret;
-    uint64_t    timeout;
+    std::string ret = "[";
 
-    for (auto diagItem : aDiagSet)
+    for (const std::vector<otNetworkDiagTlv> &diag : aDiagSet)
     {
-        diagInfoOfOneNode = cJSON_CreateObject();
-        for (auto diagTlv : diagItem)
+        if (ret.size() > 1)
         {
-            switch (diagTlv.mType)
-            {
-            case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "ExtAddress",
-                                      Bytes2HexJson(diagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Rloc16", cJSON_CreateNumber(diagTlv.mData.mAddr16));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Mode", Mode2Json(diagTlv.mData.mMode));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
-
-                timeout = static_cast<uint64_t>(diagTlv.mData.mTimeout);
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Timeout", cJSON_CreateNumber(timeout));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Connectivity",
-                                      Connectivity2Json(diagTlv.mData.mConnectivity));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Route", Route2Json(diagTlv.mData.mRoute));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "LeaderData", LeaderData2Json(diagTlv.mData.mLeaderData));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "NetworkData",
-                                      Bytes2HexJson(diagTlv.mData.mNetworkData.m8, diagTlv.mData.mNetworkData.mCount));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
-
-                addrList = cJSON_CreateArray();
-
-                for (uint16_t i = 0; i < diagTlv.mData.mIp6AddrList.mCount; ++i)
-                {
-                    cJSON_AddItemToArray(addrList, IpAddr2Json(diagTlv.mData.mIp6AddrList.mList[i]));
-                }
-                cJSON_AddItemToObject(diagInfoOfOneNode, "IP6AddressList", addrList);
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "MACCounters", MacCounters2Json(diagTlv.mData.mMacCounters));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "BatteryLevel",
-                                      cJSON_CreateNumber(diagTlv.mData.mBatteryLevel));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "SupplyVoltage",
-                                      cJSON_CreateNumber(diagTlv.mData.mSupplyVoltage));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
-
-                tableList = cJSON_CreateArray();
-
-                for (uint16_t i = 0; i < diagTlv.mData.mChildTable.mCount; ++i)
-                {
-                    cJSON_AddItemToArray(tableList, ChildTableEntry2Json(diagTlv.mData.mChildTable.mTable[i]));
-                }
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "ChildTable", tableList);
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
-
-                cJSON_AddItemToObject(
-                    diagInfoOfOneNode, "ChannelPages",
-                    Bytes2HexJson(diagTlv.mData.mChannelPages.m8, diagTlv.mData.mChannelPages.mCount));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "MaxChildTimeout",
-                                      cJSON_CreateNumber(diagTlv.mData.mMaxChildTimeout));
-
-                break;
-            default:
-                break;
-            }
+            ret += ',';
         }
-        cJSON_AddItemToArray(diagInfo, diagInfoOfOneNode);
+        AppendDiag2Json(diag, ret);
     }
-
-    ret = Json2String(diagInfo);
-
-    cJSON_Delete(diagInfo);
+    ret += ']';
 
     return ret;
 }
@@ -482,6 +618,95 @@ std::string Error2JsonString(HttpStatusCode aErrorCode, std::string aErrorMessag
     return ret;
 }
 
+static cJSON *TrafficCounters2Json(cJSON *aObject, const MUD::TrafficCounters &aCounters)
+{
+    cJSON_AddItemToObject(aObject, "Packets", cJSON_CreateNumber(aCounters.mPackets));
+    cJSON_AddItemToObject(aObject, "Bytes", cJSON_CreateNumber(aCounters.mBytes));
+
+    return aObject;
+}
+
+static cJSON *Histogram2Json(const MUD::Histogram &aHistogram)
+{
+    cJSON *histogram = cJSON_CreateObject();
+    cJSON *buckets   = cJSON_CreateArray();
+
+    // Bucket 0 counts the zero values, and bucket i the values in [2^(i-1), 2^i).
+    for (uint8_t i = 0; i < MUD::Histogram::kNumBuckets; i++)
+    {
+        cJSON_AddItemToArray(buckets, cJSON_CreateNumber(aHistogram.GetBucket(i)));
+    }
+
+    cJSON_AddItemToObject(histogram, "Count", cJSON_CreateNumber(aHistogram.GetCount()));
+    cJSON_AddItemToObject(histogram, "Sum", cJSON_CreateNumber(aHistogram.GetSum()));
+    cJSON_AddItemToObject(histogram, "Max", cJSON_CreateNumber(aHistogram.GetMax()));
+    cJSON_AddItemToObject(histogram, "Buckets", buckets);
+
+    return histogram;
+}
+
+std::string MudDevices2JsonString(const std::vector<MUD::MudStatistics::Device> &aDevices)
+{
+    std::string ret;
+    cJSON      *devices = cJSON_CreateArray();
+
+    for (const MUD::MudStatistics::Device &device : aDevices)
+    {
+        cJSON *deviceJson = cJSON_CreateObject();
+
+        cJSON_AddItemToObject(deviceJson, "ExtAddress", cJSON_CreateString(device.mExtAddress.c_str()));
+        cJSON_AddItemToObject(deviceJson, "Policy", cJSON_CreateString(device.mPolicyName.c_str()));
+        cJSON_AddItemToObject(deviceJson, "MudUrl", cJSON_CreateString(device.mUrl.c_str()));
+        cJSON_AddItemToArray(devices, TrafficCounters2Json(deviceJson, device.mCounters));
+    }
+
+    ret = Json2String(devices);
+    cJSON_Delete(devices);
+
+    return ret;
+}
+
+std::string MudAces2JsonString(const std::vector<MUD::MudStatistics::Rule> &aRules)
+{
+    std::string ret;
+    cJSON      *aces = cJSON_CreateArray();
+
+    for (const MUD::MudStatistics::Rule &rule : aRules)
+    {
+        cJSON *ace = cJSON_CreateObject();
+
+        cJSON_AddItemToObject(ace, "Policy", cJSON_CreateString(rule.mPolicyName.c_str()));
+        cJSON_AddItemToObject(ace, "Acl", cJSON_CreateString(rule.mAclName.c_str()));
+        cJSON_AddItemToObject(ace, "Ace", cJSON_CreateString(rule.mAceName.c_str()));
+        cJSON_AddItemToObject(
+            ace, "Direction",
+            cJSON_CreateString(rule.mDirection == MUD::PolicyRule::kToDevice ? "to-device" : "from-device"));
+        cJSON_AddItemToArray(aces, TrafficCounters2Json(ace, rule.mCounters));
+    }
+
+    ret = Json2String(aces);
+    cJSON_Delete(aces);
+
+    return ret;
+}
+
+std::string MudHistograms2JsonString(const MUD::MudStatistics &aStatistics)
+{
+    std::string ret;
+    cJSON      *histograms = cJSON_CreateObject();
+
+    cJSON_AddItemToObject(histograms, "FetchLatency", Histogram2Json(aStatistics.mFetchLatency));
+    cJSON_AddItemToObject(histograms, "ParseLatency", Histogram2Json(aStatistics.mParseLatency));
+    cJSON_AddItemToObject(histograms, "CompileLatency", Histogram2Json(aStatistics.mCompileLatency));
+    cJSON_AddItemToObject(histograms, "InstallLatency", Histogram2Json(aStatistics.mInstallLatency));
+    cJSON_AddItemToObject(histograms, "QueueDepth", Histogram2Json(aStatistics.mQueueDepth));
+
+    ret = Json2String(histograms);
+    cJSON_Delete(histograms);
+
+    return ret;
+}
+
 } // namespace Json
 } // namespace rest
 } // namespace otbr
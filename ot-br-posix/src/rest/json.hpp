@@ -37,6 +37,7 @@
 #include "openthread/link.h"
 #include "openthread/thread_ftd.h"
 
+#include "mud_manager/mud_statistics.hpp"
 #include "rest/types.hpp"
 #include "utils/hex.hpp"
 
@@ -122,6 +123,18 @@ std::string Node2JsonString(const NodeInfo &aNode);
  */
 std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet);
 
+/**
+ * This method serializes the diagnostic TLVs of a node to a Json object, appended to a string.
+ *
+ * The object is written straight from the diagnostic TLVs, without building an intermediate Json tree, so that a
+ * large diagnostics array can be streamed one node at a time.
+ *
+ * @param[in]     aDiag    The diagnostic TLVs of a node.
+ * @param[in,out] aOutput  The string the Json object is appended to.
+ *
+ */
+void AppendDiag2Json(const std::vector<otNetworkDiagTlv> &aDiag, std::string &aOutput);
+
 /**
  * This method formats an Ipv6Address to a Json string and serialize it to a string.
  *
@@ -213,6 +226,37 @@ std::string ChildTableEntry2JsonString(const otNetworkDiagChildEntry &aChildEntr
  */
 std::string Error2JsonString(HttpStatusCode aErrorCode, std::string aErrorMessage);
 
+/**
+ * This method formats the traffic counters of the MUD devices to a Json array and serialize it to a string.
+ *
+ * @param[in] aDevices  The traffic counters of the MUD devices.
+ *
+ * @returns A string of serialized Json array.
+ *
+ */
+std::string MudDevices2JsonString(const std::vector<MUD::MudStatistics::Device> &aDevices);
+
+/**
+ * This method formats the traffic counters of the MUD ACEs to a Json array and serialize it to a string.
+ *
+ * @param[in] aRules  The traffic counters of the rules compiled from the MUD ACEs.
+ *
+ * @returns A string of serialized Json array.
+ *
+ */
+std::string MudAces2JsonString(const std::vector<MUD::MudStatistics::Rule> &aRules);
+
+/**
+ * This method formats the latency and queue depth histograms of the MUD Manager to a Json object and serialize it
+ * to a string.
+ *
+ * @param[in] aStatistics  The statistics of the MUD Manager.
+ *
+ * @returns A string of serialized Json object.
+ *
+ */
+std::string MudHistograms2JsonString(const MUD::MudStatistics &aStatistics);
+
 }; // namespace Json
 
 } // namespace rest
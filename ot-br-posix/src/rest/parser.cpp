@@ -58,12 +58,33 @@ static int OnBody(http_parser *parser, const char *at, size_t len)
     return 0;
 }
 
+static int OnHeaderField(http_parser *parser, const char *at, size_t len)
+{
+    Request *request = reinterpret_cast<Request *>(parser->data);
+
+    request->AddHeaderField(at, len);
+
+    return 0;
+}
+
+static int OnHeaderValue(http_parser *parser, const char *at, size_t len)
+{
+    Request *request = reinterpret_cast<Request *>(parser->data);
+
+    request->AddHeaderValue(at, len);
+
+    return 0;
+}
+
 static int OnMessageComplete(http_parser *parser)
 {
     Request *request = reinterpret_cast<Request *>(parser->data);
 
     request->SetReadComplete();
 
+    // Stop at the end of the request, the requests pipelined after it are parsed once it has been answered.
+    http_parser_pause(parser, 1);
+
     return 0;
 }
 
@@ -79,6 +100,7 @@ static int OnHeaderComplete(http_parser *parser)
 {
     Request *request = reinterpret_cast<Request *>(parser->data);
     request->SetMethod(parser->method);
+    request->SetKeepAlive(http_should_keep_alive(parser) != 0);
     return 0;
 }
 
@@ -97,17 +119,22 @@ void Parser::Init(void)
     mSettings.on_message_begin    = OnMessageBegin;
     mSettings.on_url              = OnUrl;
     mSettings.on_status           = OnHandlerData;
-    mSettings.on_header_field     = OnHandlerData;
-    mSettings.on_header_value     = OnHandlerData;
+    mSettings.on_header_field     = OnHeaderField;
+    mSettings.on_header_value     = OnHeaderValue;
     mSettings.on_body             = OnBody;
     mSettings.on_headers_complete = OnHeaderComplete;
     mSettings.on_message_complete = OnMessageComplete;
     http_parser_init(&mParser, HTTP_REQUEST);
 }
 
-void Parser::Process(const char *aBuf, size_t aLength)
+size_t Parser::Process(const char *aBuf, size_t aLength)
+{
+    return http_parser_execute(&mParser, &mSettings, aBuf, aLength);
+}
+
+void Parser::Resume(void)
 {
-    http_parser_execute(&mParser, &mSettings, aBuf, aLength);
+    http_parser_pause(&mParser, 0);
 }
 
 } // namespace rest
@@ -71,11 +71,21 @@ public:
     /**
      * This method performs a parse process.
      *
+     * The parser stops at the end of a complete request, until it is resumed.
+     *
      * @param[in] aBuf     A pointer pointing to read buffer.
      * @param[in] aLength  An integer indicates how much data is to be processed by parser.
      *
+     * @returns The length of the data parsed.
+     *
+     */
+    size_t Process(const char *aBuf, size_t aLength);
+
+    /**
+     * This method resumes the parser after a complete request, to parse the next request of the connection.
+     *
      */
-    void Process(const char *aBuf, size_t aLength);
+    void Resume(void);
 
 private:
     http_parser          mParser;
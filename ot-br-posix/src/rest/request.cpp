@@ -28,11 +28,23 @@
 
 #include "rest/request.hpp"
 
+#include <algorithm>
+#include <ctype.h>
+
 namespace otbr {
 namespace rest {
 
+static std::string ToLower(std::string aString)
+{
+    std::transform(aString.begin(), aString.end(), aString.begin(), [](unsigned char aChar) { return tolower(aChar); });
+
+    return aString;
+}
+
 Request::Request(void)
     : mComplete(false)
+    , mKeepAlive(false)
+    , mHeaderValueParsed(false)
 {
 }
 
@@ -46,6 +58,23 @@ void Request::SetBody(const char *aString, size_t aLength)
     mBody += std::string(aString, aLength);
 }
 
+void Request::AddHeaderField(const char *aString, size_t aLength)
+{
+    if (mHeaderValueParsed)
+    {
+        mHeaderField.clear();
+        mHeaderValueParsed = false;
+    }
+
+    mHeaderField += ToLower(std::string(aString, aLength));
+}
+
+void Request::AddHeaderValue(const char *aString, size_t aLength)
+{
+    mHeaders[mHeaderField] += std::string(aString, aLength);
+    mHeaderValueParsed = true;
+}
+
 void Request::SetContentLength(size_t aContentLength)
 {
     mContentLength = aContentLength;
@@ -56,6 +85,11 @@ void Request::SetMethod(int32_t aMethod)
     mMethod = aMethod;
 }
 
+void Request::SetKeepAlive(bool aKeepAlive)
+{
+    mKeepAlive = aKeepAlive;
+}
+
 HttpMethod Request::GetMethod() const
 {
     return static_cast<HttpMethod>(mMethod);
@@ -66,6 +100,13 @@ std::string Request::GetBody() const
     return mBody;
 }
 
+std::string Request::GetHeader(const std::string &aField) const
+{
+    auto it = mHeaders.find(ToLower(aField));
+
+    return it != mHeaders.end() ? it->second : std::string();
+}
+
 std::string Request::GetUrl(void) const
 {
     std::string url = mUrl;
@@ -102,5 +143,10 @@ bool Request::IsComplete(void) const
     return mComplete;
 }
 
+bool Request::IsKeepAlive(void) const
+{
+    return mKeepAlive;
+}
+
 } // namespace rest
 } // namespace otbr
@@ -34,6 +34,7 @@
 #ifndef OTBR_REST_REQUEST_HPP_
 #define OTBR_REST_REQUEST_HPP_
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -74,6 +75,26 @@ public:
      */
     void SetBody(const char *aString, size_t aLength);
 
+    /**
+     * This method appends to the name of the header field being parsed.
+     *
+     * The name of a header field may be parsed in several pieces, a piece following a value starts a new field.
+     *
+     * @param[in] aString  A pointer points to the piece of the header field name.
+     * @param[in] aLength  Length of the piece.
+     *
+     */
+    void AddHeaderField(const char *aString, size_t aLength);
+
+    /**
+     * This method appends to the value of the header field being parsed.
+     *
+     * @param[in] aString  A pointer points to the piece of the header field value.
+     * @param[in] aLength  Length of the piece.
+     *
+     */
+    void AddHeaderValue(const char *aString, size_t aLength);
+
     /**
      * This method sets the content-length field of a request.
      *
@@ -90,6 +111,14 @@ public:
      */
     void SetMethod(int32_t aMethod);
 
+    /**
+     * This method sets whether the connection of the parsed request persists after the response.
+     *
+     * @param[in] aKeepAlive  TRUE if the connection persists, FALSE if it closes after the response.
+     *
+     */
+    void SetKeepAlive(bool aKeepAlive);
+
     /**
      * This method labels the request as complete which means it no longer need to be parsed one more time .
      *
@@ -116,6 +145,15 @@ public:
      */
     std::string GetBody() const;
 
+    /**
+     * This method returns the value of a header field of this request.
+     *
+     * @param[in] aField  The name of the header field, case insensitive.
+     *
+     * @returns A string contains the value of the header field, empty if the request does not have this field.
+     */
+    std::string GetHeader(const std::string &aField) const;
+
     /**
      * This method returns the url for this request.
      *
@@ -130,12 +168,26 @@ public:
      */
     bool IsComplete(void) const;
 
+    /**
+     * This method indicates whether the connection of this request persists after the response.
+     *
+     * @returns TRUE if the client keeps the connection alive, FALSE if it closes after the response.
+     *
+     */
+    bool IsKeepAlive(void) const;
+
 private:
     int32_t     mMethod;
     size_t      mContentLength;
     std::string mUrl;
     std::string mBody;
     bool        mComplete;
+    bool        mKeepAlive;
+
+    // The header fields keyed by lowercase name.
+    std::map<std::string, std::string> mHeaders;
+    std::string                        mHeaderField;
+    bool                               mHeaderValueParsed;
 };
 
 } // namespace rest
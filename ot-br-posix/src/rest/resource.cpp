@@ -30,6 +30,14 @@
 
 #include "rest/resource.hpp"
 
+#include <algorithm>
+
+#include <stdlib.h>
+
+#if OTBR_ENABLE_MUD_MANAGER
+#include "mud_manager/mud_manager.hpp"
+#endif
+
 #include "string.h"
 
 #define OT_PSKC_MAX_LENGTH 16
@@ -46,6 +54,9 @@
 #define OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER "/node/num-of-router"
 #define OT_REST_RESOURCE_PATH_NODE_EXTPANID "/node/ext-panid"
 #define OT_REST_RESOURCE_PATH_NODE_ACTIVE_DATASET_TLVS "/node/active-dataset-tlvs"
+#define OT_REST_RESOURCE_PATH_MUD_DEVICES "/mud/devices"
+#define OT_REST_RESOURCE_PATH_MUD_ACES "/mud/aces"
+#define OT_REST_RESOURCE_PATH_MUD_HISTOGRAMS "/mud/histograms"
 #define OT_REST_RESOURCE_PATH_NETWORK "/networks"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT "/networks/current"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_COMMISSION "/networks/commission"
@@ -53,6 +64,7 @@
 
 #define OT_REST_HTTP_STATUS_200 "200 OK"
 #define OT_REST_HTTP_STATUS_202 "202 Accepted"
+#define OT_REST_HTTP_STATUS_304 "304 Not Modified"
 #define OT_REST_HTTP_STATUS_400 "400 Bad Request"
 #define OT_REST_HTTP_STATUS_404 "404 Not Found"
 #define OT_REST_HTTP_STATUS_405 "405 Method Not Allowed"
@@ -69,17 +81,67 @@ using std::placeholders::_2;
 namespace otbr {
 namespace rest {
 
-// MulticastAddr
-static const char *kMulticastAddrAllRouters = "ff03::2";
+// Maximum time (in seconds) a request waits for the diagnostics to change
+static const uint32_t kDiagMaxWaitTime = 25;
 
-// Default TlvTypes for Diagnostic inforamtion
-static const uint8_t kAllTlvTypes[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 14, 15, 16, 17, 19};
+// Size (in bytes) from which the diagnostics of the next nodes are written in another chunk
+static const size_t kDiagChunkSize = 4096;
 
-// Timeout (in Microseconds) for deleting outdated diagnostics
-static const uint32_t kDiagResetTimeout = 3000000;
+/**
+ * This class streams the diagnostics of the nodes as a Json array, a few nodes per chunk.
+ *
+ * Each chunk is written from the snapshot of the collector at that time, the nodes are written in the order of their
+ * RLOC16 so that the snapshot may change in between chunks without copying it.
+ *
+ */
+class DiagnosticBodyWriter
+{
+public:
+    explicit DiagnosticBodyWriter(const agent::DiagCollector &aDiagCollector)
+        : mDiagCollector(&aDiagCollector)
+        , mNextRloc16(0)
+        , mNumNodes(0)
+        , mStarted(false)
+    {
+    }
 
-// Timeout (in Microseconds) for collecting diagnostics
-static const uint32_t kDiagCollectTimeout = 2000000;
+    bool operator()(std::string &aOutput)
+    {
+        const agent::DiagCollector::NodeDiagMap &nodeDiags = mDiagCollector->GetNodeDiags();
+        size_t                                   chunkEnd  = aOutput.size() + kDiagChunkSize;
+        auto it = (mNextRloc16 <= UINT16_MAX) ? nodeDiags.lower_bound(static_cast<uint16_t>(mNextRloc16))
+                                              : nodeDiags.end();
+
+        if (!mStarted)
+        {
+            aOutput += '[';
+            mStarted = true;
+        }
+
+        for (; it != nodeDiags.end() && aOutput.size() < chunkEnd; ++it)
+        {
+            if (mNumNodes++ > 0)
+            {
+                aOutput += ',';
+            }
+            Json::AppendDiag2Json(it->second.mTlvs, aOutput);
+            mNextRloc16 = it->first + 1u;
+        }
+
+        if (it == nodeDiags.end())
+        {
+            aOutput += ']';
+        }
+
+        return it == nodeDiags.end();
+    }
+
+private:
+    const agent::DiagCollector *mDiagCollector;
+    uint32_t                    mNextRloc16;
+    uint32_t                    mNumNodes;
+    bool                        mStarted;
+};
 
 static std::string GetHttpStatus(HttpStatusCode aErrorCode)
 {
@@ -93,6 +155,9 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
     case HttpStatusCode::kStatusAccepted:
         httpStatus = OT_REST_HTTP_STATUS_202;
         break;
+    case HttpStatusCode::kStatusNotModified:
+        httpStatus = OT_REST_HTTP_STATUS_304;
+        break;
     case HttpStatusCode::kStatusBadRequest:
         httpStatus = OT_REST_HTTP_STATUS_400;
         break;
@@ -116,6 +181,10 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
 Resource::Resource(ControllerOpenThread *aNcp)
     : mInstance(nullptr)
     , mNcp(aNcp)
+    , mDiagCollector(nullptr)
+#if OTBR_ENABLE_MUD_MANAGER
+    , mMudManager(nullptr)
+#endif
 {
     // Resource Handler
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOSTICS, &Resource::Diagnostic);
@@ -129,6 +198,11 @@ Resource::Resource(ControllerOpenThread *aNcp)
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_EXTPANID, &Resource::ExtendedPanId);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_ACTIVE_DATASET_TLVS, &Resource::ActiveDatasetTlvs);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_RLOC, &Resource::Rloc);
+#if OTBR_ENABLE_MUD_MANAGER
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_MUD_DEVICES, &Resource::MudDevices);
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_MUD_ACES, &Resource::MudAces);
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_MUD_HISTOGRAMS, &Resource::MudHistograms);
+#endif
 
     // Resource callback handler
     mResourceCallbackMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOSTICS, &Resource::HandleDiagnosticCallback);
@@ -169,27 +243,19 @@ void Resource::HandleCallback(Request &aRequest, Response &aResponse)
 
 void Resource::HandleDiagnosticCallback(const Request &aRequest, Response &aResponse)
 {
-    OT_UNUSED_VARIABLE(aRequest);
-    std::vector<std::vector<otNetworkDiagTlv>> diagContentSet;
-    std::string                                body;
-    std::string                                errorCode;
+    uint32_t duration =
+        static_cast<uint32_t>(duration_cast<seconds>(steady_clock::now() - aResponse.GetStartTime()).count());
 
-    auto duration = duration_cast<microseconds>(steady_clock::now() - aResponse.GetStartTime()).count();
-    if (duration >= kDiagCollectTimeout)
-    {
-        DeleteOutDatedDiagnostic();
+    // Waiting requests keep the collector refreshing, and restart it after a reset of the NCP.
+    mDiagCollector->NotifyRead();
 
-        for (auto it = mDiagSet.begin(); it != mDiagSet.end(); ++it)
-        {
-            diagContentSet.push_back(it->second.mDiagContent);
-        }
+    VerifyOrExit(mDiagCollector->IsReady());
+    VerifyOrExit(duration >= GetDiagnosticWaitTime(aRequest));
 
-        body      = Json::Diag2JsonString(diagContentSet);
-        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
-        aResponse.SetResponsCode(errorCode);
-        aResponse.SetBody(body);
-        aResponse.SetComplete();
-    }
+    GetDiagnostic(aRequest, aResponse);
+
+exit:
+    return;
 }
 
 void Resource::ErrorHandler(Response &aResponse, HttpStatusCode aErrorCode) const
@@ -568,102 +634,144 @@ void Resource::ActiveDatasetTlvs(const Request &aRequest, Response &aResponse) c
     }
 }
 
-void Resource::DeleteOutDatedDiagnostic(void)
+#if OTBR_ENABLE_MUD_MANAGER
+bool Resource::GetMudStatistics(const Request &aRequest, Response &aResponse, MUD::MudStatistics &aStatistics) const
+{
+    std::string errorCode;
+    bool        ret = false;
+
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet,
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed));
+    VerifyOrExit(mMudManager != nullptr, ErrorHandler(aResponse, HttpStatusCode::kStatusResourceNotFound));
+
+    mMudManager->GetStatistics(aStatistics);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    ret = true;
+
+exit:
+    return ret;
+}
+
+void Resource::MudDevices(const Request &aRequest, Response &aResponse) const
 {
-    auto eraseIt = mDiagSet.begin();
-    for (eraseIt = mDiagSet.begin(); eraseIt != mDiagSet.end();)
+    MUD::MudStatistics statistics;
+    std::string        body;
+
+    if (GetMudStatistics(aRequest, aResponse, statistics))
     {
-        auto diagInfo = eraseIt->second;
-        auto duration = duration_cast<microseconds>(steady_clock::now() - diagInfo.mStartTime).count();
+        body = Json::MudDevices2JsonString(statistics.mDevices);
+        aResponse.SetBody(body);
+    }
+}
 
-        if (duration >= kDiagResetTimeout)
-        {
-            eraseIt = mDiagSet.erase(eraseIt);
-        }
-        else
-        {
-            eraseIt++;
-        }
+void Resource::MudAces(const Request &aRequest, Response &aResponse) const
+{
+    MUD::MudStatistics statistics;
+    std::string        body;
+
+    if (GetMudStatistics(aRequest, aResponse, statistics))
+    {
+        body = Json::MudAces2JsonString(statistics.mRules);
+        aResponse.SetBody(body);
     }
 }
 
-void Resource::UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag)
+void Resource::MudHistograms(const Request &aRequest, Response &aResponse) const
 {
-    DiagInfo value;
+    MUD::MudStatistics statistics;
+    std::string        body;
 
-    value.mStartTime = steady_clock::now();
-    value.mDiagContent.assign(aDiag.begin(), aDiag.end());
-    mDiagSet[aKey] = value;
+    if (GetMudStatistics(aRequest, aResponse, statistics))
+    {
+        body = Json::MudHistograms2JsonString(statistics);
+        aResponse.SetBody(body);
+    }
 }
+#endif // OTBR_ENABLE_MUD_MANAGER
 
 void Resource::Diagnostic(const Request &aRequest, Response &aResponse) const
 {
-    otbrError error = OTBR_ERROR_NONE;
-    OT_UNUSED_VARIABLE(aRequest);
-    struct otIp6Address rloc16address = *otThreadGetRloc(mInstance);
-    struct otIp6Address multicastAddress;
-
-    VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &rloc16address, kAllTlvTypes, sizeof(kAllTlvTypes),
-                                           &Resource::DiagnosticResponseHandler,
-                                           const_cast<Resource *>(this)) == OT_ERROR_NONE,
-                 error = OTBR_ERROR_REST);
-    VerifyOrExit(otIp6AddressFromString(kMulticastAddrAllRouters, &multicastAddress) == OT_ERROR_NONE,
-                 error = OTBR_ERROR_REST);
-    VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &multicastAddress, kAllTlvTypes, sizeof(kAllTlvTypes),
-                                           &Resource::DiagnosticResponseHandler,
-                                           const_cast<Resource *>(this)) == OT_ERROR_NONE,
-                 error = OTBR_ERROR_REST);
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet,
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed));
+    VerifyOrExit(mDiagCollector != nullptr, ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError));
 
-exit:
+    mDiagCollector->NotifyRead();
 
-    if (error == OTBR_ERROR_NONE)
+    if (mDiagCollector->IsReady() && GetDiagnosticWaitTime(aRequest) == 0)
+    {
+        GetDiagnostic(aRequest, aResponse);
+    }
+    else
     {
+        // Wait for the first refresh to complete, or for the diagnostics to change.
         aResponse.SetStartTime(steady_clock::now());
         aResponse.SetCallback();
     }
+
+exit:
+    return;
+}
+
+void Resource::GetDiagnostic(const Request &aRequest, Response &aResponse) const
+{
+    std::string etag = GetDiagnosticETag();
+    std::string errorCode;
+
+    VerifyOrExit(mDiagCollector->GetLastError() == OTBR_ERROR_NONE || !mDiagCollector->GetNodeDiags().empty(),
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError));
+
+    aResponse.SetHeader("ETag", etag);
+    aResponse.SetHeader("Access-Control-Expose-Headers", "ETag");
+
+    if (aRequest.GetHeader("If-None-Match") == etag)
+    {
+        std::string body;
+
+        aResponse.SetBody(body);
+        errorCode = GetHttpStatus(HttpStatusCode::kStatusNotModified);
+    }
     else
     {
-        ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError);
+        aResponse.SetBodyWriter(DiagnosticBodyWriter(*mDiagCollector));
+        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     }
+
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetComplete();
+
+exit:
+    return;
 }
 
-void Resource::DiagnosticResponseHandler(otError              aError,
-                                         otMessage           *aMessage,
-                                         const otMessageInfo *aMessageInfo,
-                                         void                *aContext)
+std::string Resource::GetDiagnosticETag(void) const
 {
-    static_cast<Resource *>(aContext)->DiagnosticResponseHandler(aError, aMessage, aMessageInfo);
+    // The entity tag covers the whole snapshot, it starts with the topology version which waiting requests wait for.
+    return GetDiagnosticETagPrefix() + std::to_string(mDiagCollector->GetVersion()) + "\"";
 }
 
-void Resource::DiagnosticResponseHandler(otError aError, const otMessage *aMessage, const otMessageInfo *aMessageInfo)
+std::string Resource::GetDiagnosticETagPrefix(void) const
 {
-    std::vector<otNetworkDiagTlv> diagSet;
-    otNetworkDiagTlv              diagTlv;
-    otNetworkDiagIterator         iterator = OT_NETWORK_DIAGNOSTIC_ITERATOR_INIT;
-    otError                       error;
-    char                          rloc[7];
-    std::string                   keyRloc = "0xffee";
+    return "\"" + std::to_string(mDiagCollector->GetTopologyVersion()) + ".";
+}
 
-    SuccessOrExit(aError);
+uint32_t Resource::GetDiagnosticWaitTime(const Request &aRequest) const
+{
+    // A request only waits for a change of the topology it already has, e.g. "Prefer: wait=10". The volatile TLVs,
+    // such as the MAC counters, are served up to date once the wait is over.
+    std::string prefer      = aRequest.GetHeader("Prefer");
+    std::string etag        = aRequest.GetHeader("If-None-Match");
+    std::string topologyTag = GetDiagnosticETagPrefix();
+    size_t      pos         = prefer.find("wait=");
+    uint32_t    waitTime;
 
-    OTBR_UNUSED_VARIABLE(aMessageInfo);
+    VerifyOrExit(pos != std::string::npos && etag.compare(0, topologyTag.size(), topologyTag) == 0, waitTime = 0);
 
-    while ((error = otThreadGetNextDiagnosticTlv(aMessage, &iterator, &diagTlv)) == OT_ERROR_NONE)
-    {
-        if (diagTlv.mType == OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS)
-        {
-            snprintf(rloc, sizeof(rloc), "0x%04x", diagTlv.mData.mAddr16);
-            keyRloc = Json::CString2JsonString(rloc);
-        }
-        diagSet.push_back(diagTlv);
-    }
-    UpdateDiag(keyRloc, diagSet);
+    waitTime = static_cast<uint32_t>(strtoul(prefer.c_str() + pos + sizeof("wait=") - 1, nullptr, 10));
+    waitTime = std::min(waitTime, kDiagMaxWaitTime);
 
 exit:
-    if (aError != OT_ERROR_NONE)
-    {
-        otbrLogWarning("Failed to get diagnostic data: %s", otThreadErrorToString(aError));
-    }
+    return waitTime;
 }
 
 } // namespace rest
@@ -42,9 +42,17 @@
 #include "rest/json.hpp"
 #include "rest/request.hpp"
 #include "rest/response.hpp"
+#include "utils/diag_collector.hpp"
 #include "utils/thread_helper.hpp"
 
 using otbr::Ncp::ControllerOpenThread;
+
+namespace otbr {
+namespace MUD {
+class MudManager;
+}
+} // namespace otbr
+
 using std::chrono::steady_clock;
 
 namespace otbr {
@@ -101,6 +109,24 @@ public:
      */
     void ErrorHandler(Response &aResponse, HttpStatusCode aErrorCode) const;
 
+    /**
+     * This method sets the collector whose network diagnostics are served.
+     *
+     * @param[in] aDiagCollector  A pointer to the diagnostics collector.
+     *
+     */
+    void SetDiagCollector(agent::DiagCollector *aDiagCollector) { mDiagCollector = aDiagCollector; }
+
+#if OTBR_ENABLE_MUD_MANAGER
+    /**
+     * This method sets the MUD Manager whose statistics are served.
+     *
+     * @param[in] aMudManager  A pointer to the MUD Manager.
+     *
+     */
+    void SetMudManager(MUD::MudManager *aMudManager) { mMudManager = aMudManager; }
+#endif
+
 private:
     typedef void (Resource::*ResourceHandler)(const Request &aRequest, Response &aResponse) const;
     typedef void (Resource::*ResourceCallbackHandler)(const Request &aRequest, Response &aResponse);
@@ -116,6 +142,11 @@ private:
     void ActiveDatasetTlvs(const Request &aRequest, Response &aResponse) const;
     void Diagnostic(const Request &aRequest, Response &aResponse) const;
     void HandleDiagnosticCallback(const Request &aRequest, Response &aResponse);
+#if OTBR_ENABLE_MUD_MANAGER
+    void MudDevices(const Request &aRequest, Response &aResponse) const;
+    void MudAces(const Request &aRequest, Response &aResponse) const;
+    void MudHistograms(const Request &aRequest, Response &aResponse) const;
+#endif
 
     void GetNodeInfo(Response &aResponse) const;
     void GetDataExtendedAddr(Response &aResponse) const;
@@ -128,23 +159,24 @@ private:
     void GetDataRloc(Response &aResponse) const;
     void GetActiveDatasetTlvs(Response &aResponse) const;
     void SetActiveDatasetTlvs(const Request &aRequest, Response &aResponse) const;
+#if OTBR_ENABLE_MUD_MANAGER
+    bool GetMudStatistics(const Request &aRequest, Response &aResponse, MUD::MudStatistics &aStatistics) const;
+#endif
 
-    void DeleteOutDatedDiagnostic(void);
-    void UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag);
-
-    static void DiagnosticResponseHandler(otError              aError,
-                                          otMessage           *aMessage,
-                                          const otMessageInfo *aMessageInfo,
-                                          void                *aContext);
-    void        DiagnosticResponseHandler(otError aError, const otMessage *aMessage, const otMessageInfo *aMessageInfo);
+    void        GetDiagnostic(const Request &aRequest, Response &aResponse) const;
+    std::string GetDiagnosticETag(void) const;
+    std::string GetDiagnosticETagPrefix(void) const;
+    uint32_t    GetDiagnosticWaitTime(const Request &aRequest) const;
 
     otInstance           *mInstance;
     ControllerOpenThread *mNcp;
+    agent::DiagCollector *mDiagCollector;
+#if OTBR_ENABLE_MUD_MANAGER
+    MUD::MudManager *mMudManager;
+#endif
 
     std::unordered_map<std::string, ResourceHandler>         mResourceMap;
     std::unordered_map<std::string, ResourceCallbackHandler> mResourceCallbackMap;
-
-    std::unordered_map<std::string, DiagInfo> mDiagSet;
 };
 
 } // namespace rest
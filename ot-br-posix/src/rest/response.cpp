@@ -30,19 +30,25 @@
 
 #include <stdio.h>
 
+#include "common/code_utils.hpp"
+
 #define OT_REST_RESPONSE_CONTENT_TYPE_JSON "application/json"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_ORIGIN "*"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_HEADERS                                                              \
     "Access-Control-Allow-Headers, Origin,Accept, X-Requested-With, Content-Type, Access-Control-Request-Method, " \
-    "Access-Control-Request-Headers"
+    "Access-Control-Request-Headers, If-None-Match, Prefer"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_METHOD "GET"
 
 namespace otbr {
 namespace rest {
 
+// The length of the chunk size, which is written before the content of a chunk is known.
+static constexpr size_t kChunkSizeLength = 8;
+
 Response::Response(void)
     : mCallback(false)
     , mComplete(false)
+    , mBodyWritten(false)
 {
     // HTTP protocol
     mProtocol = "HTTP/1.1";
@@ -79,6 +85,11 @@ void Response::SetResponsCode(std::string &aCode)
     mCode = aCode;
 }
 
+void Response::SetHeader(const std::string &aField, const std::string &aValue)
+{
+    mHeaders[aField] = aValue;
+}
+
 void Response::SetCallback(void)
 {
     mCallback = true;
@@ -89,6 +100,13 @@ void Response::SetBody(std::string &aBody)
     mBody = aBody;
 }
 
+void Response::SetBodyWriter(BodyWriter aBodyWriter)
+{
+    mBody.clear();
+    mBodyWriter  = std::move(aBodyWriter);
+    mBodyWritten = false;
+}
+
 std::string Response::GetBody(void) const
 {
     return mBody;
@@ -108,11 +126,54 @@ std::string Response::Serialize(void) const
     {
         ret += (spacer + header.first + ": " + header.second);
     }
-    ret += spacer + "Content-Length: " + std::to_string(mBody.size());
+
+    if (mBodyWriter)
+    {
+        ret += spacer + "Transfer-Encoding: chunked";
+    }
+    else
+    {
+        ret += spacer + "Content-Length: " + std::to_string(mBody.size());
+    }
     ret += (spacer + spacer + mBody);
 
     return ret;
 }
 
+void Response::SerializeChunk(std::string &aChunk)
+{
+    char   chunkSize[kChunkSizeLength + 1];
+    size_t length;
+
+    aChunk.clear();
+    VerifyOrExit(mBodyWriter && !mBodyWritten);
+
+    // The chunk size may have leading zeros, it is reserved with a fixed length so that the body is written in place.
+    aChunk.assign(kChunkSizeLength, '0');
+    aChunk += "\r\n";
+    mBodyWritten = mBodyWriter(aChunk);
+    length       = aChunk.size() - kChunkSizeLength - 2;
+
+    if (length > 0)
+    {
+        snprintf(chunkSize, sizeof(chunkSize), "%08x", static_cast<uint32_t>(length));
+        aChunk.replace(0, kChunkSizeLength, chunkSize, kChunkSizeLength);
+        aChunk += "\r\n";
+    }
+    else
+    {
+        aChunk.clear();
+    }
+
+    if (mBodyWritten)
+    {
+        // The last chunk.
+        aChunk += "0\r\n\r\n";
+    }
+
+exit:
+    return;
+}
+
 } // namespace rest
 } // namespace otbr
@@ -35,6 +35,7 @@
 #define OTBR_REST_RESPONSE_HPP_
 
 #include <chrono>
+#include <functional>
 #include <map>
 #include <string>
 
@@ -56,6 +57,15 @@ namespace rest {
 class Response
 {
 public:
+    /**
+     * This type represents a writer of a streamed body.
+     *
+     * The writer is called each time the connection is ready to send more of the body. It appends the next part of
+     * the body to the string, and returns whether the whole body has been written.
+     *
+     */
+    typedef std::function<bool(std::string &aOutput)> BodyWriter;
+
     /**
      * The constructor to initialize a response instance.
      *
@@ -71,6 +81,16 @@ public:
      */
     void SetBody(std::string &aBody);
 
+    /**
+     * This method sets a writer streaming the response body, instead of a body set at once.
+     *
+     * The body is then sent with the chunked transfer coding, so that its whole content is never held in memory.
+     *
+     * @param[in] aBodyWriter  The writer of the body.
+     *
+     */
+    void SetBodyWriter(BodyWriter aBodyWriter);
+
     /**
      * This method return a string contains the body field of this response.
      *
@@ -86,6 +106,15 @@ public:
      */
     void SetResponsCode(std::string &aCode);
 
+    /**
+     * This method sets a header field of the response, replacing any previous value.
+     *
+     * @param[in] aField  The name of the header field.
+     * @param[in] aValue  The value of the header field.
+     *
+     */
+    void SetHeader(const std::string &aField, const std::string &aValue);
+
     /**
      * This method labels the response as need callback.
      *
@@ -135,6 +164,15 @@ public:
      */
     std::string Serialize(void) const;
 
+    /**
+     * This method serializes the next chunk of a streamed body.
+     *
+     * @param[out] aChunk  A string replaced by the next chunk, in the chunked transfer coding. It is left empty when
+     *                     the whole body has been serialized or the body is not streamed.
+     *
+     */
+    void SerializeChunk(std::string &aChunk);
+
 private:
     bool                               mCallback;
     std::map<std::string, std::string> mHeaders;
@@ -143,6 +181,8 @@ private:
     std::string                        mBody;
     bool                               mComplete;
     steady_clock::time_point           mStartTime;
+    BodyWriter                         mBodyWriter;
+    bool                               mBodyWritten;
 };
 
 } // namespace rest
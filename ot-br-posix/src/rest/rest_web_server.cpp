@@ -34,6 +34,7 @@
 #include <cerrno>
 
 #include <fcntl.h>
+#include <netinet/tcp.h>
 
 #include "utils/socket_utils.hpp"
 
@@ -45,7 +46,7 @@ namespace otbr {
 namespace rest {
 
 // Maximum number of connection a server support at the same time.
-static const uint32_t kMaxServeNum = 500;
+static const uint32_t kMaxServeNum = OTBR_REST_MAX_CONNECTIONS;
 // Port number used by Rest server.
 static const uint32_t kPortNumber = 8081;
 
@@ -67,8 +68,11 @@ RestWebServer::RestWebServer(ControllerOpenThread &aNcp, const std::string &aRes
 
 RestWebServer::~RestWebServer(void)
 {
+    mConnectionSet.clear();
+
     if (mListenFd != -1)
     {
+        MainloopManager::GetInstance().RemoveFd(mListenFd);
         close(mListenFd);
     }
 }
@@ -79,48 +83,73 @@ void RestWebServer::Init(void)
     InitializeListenFd();
 }
 
-void RestWebServer::Update(MainloopContext &aMainloop)
+void RestWebServer::HandleListenFdEvents(void)
 {
-    FD_SET(mListenFd, &aMainloop.mReadFdSet);
-    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mListenFd);
+    otbrError error;
+
+    if (mConnectionSet.size() >= kMaxServeNum && !ReapIdleConnection())
+    {
+        // Leave new connections in the backlog until a connection is erased or becomes idle.
+        MainloopManager::GetInstance().UpdateFd(mListenFd, 0);
+        ExitNow();
+    }
+
+    error = Accept(mListenFd);
 
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to accept new connection: %s", otbrErrorString(error));
+    }
+
+exit:
     return;
 }
 
-void RestWebServer::Process(const MainloopContext &aMainloop)
+void RestWebServer::HandleConnectionComplete(int32_t aFd)
 {
-    UpdateConnections(aMainloop.mReadFdSet);
+    // A connection completes from its own handlers, erase it from the mainloop once they return.
+    MainloopManager::GetInstance().AddTimer(Milliseconds::zero(), [this, aFd]() { EraseConnection(aFd); });
 }
 
-void RestWebServer::UpdateConnections(const fd_set &aReadFdSet)
+void RestWebServer::HandleConnectionIdle(void)
 {
-    otbrError error   = OTBR_ERROR_NONE;
-    auto      eraseIt = mConnectionSet.begin();
+    // An idle connection can be reaped for a new connection waiting in the backlog.
+    MainloopManager::GetInstance().UpdateFd(mListenFd, MainloopManager::kEventReadable);
+}
 
-    // Erase useless connections
-    for (eraseIt = mConnectionSet.begin(); eraseIt != mConnectionSet.end();)
-    {
-        Connection *connection = eraseIt->second.get();
+bool RestWebServer::ReapIdleConnection(void)
+{
+    bool reaped = false;
+    auto oldest = mConnectionSet.end();
 
-        if (connection->IsComplete())
-        {
-            eraseIt = mConnectionSet.erase(eraseIt);
-        }
-        else
+    for (auto it = mConnectionSet.begin(); it != mConnectionSet.end(); ++it)
+    {
+        if (it->second->IsIdle() &&
+            (oldest == mConnectionSet.end() ||
+             it->second->GetIdleStartTime() < oldest->second->GetIdleStartTime()))
         {
-            eraseIt++;
+            oldest = it;
         }
     }
 
-    // Create new connection if listenfd is set
-    if (FD_ISSET(mListenFd, &aReadFdSet) && mConnectionSet.size() < kMaxServeNum)
-    {
-        error = Accept(mListenFd);
-    }
+    VerifyOrExit(oldest != mConnectionSet.end());
 
-    if (error != OTBR_ERROR_NONE)
+    // The connection is not serving any request, it is closed without handlers.
+    otbrLogDebug("Close idle connection %d for a new connection", oldest->first);
+    mConnectionSet.erase(oldest);
+    reaped = true;
+
+exit:
+    return reaped;
+}
+
+void RestWebServer::EraseConnection(int32_t aFd)
+{
+    mConnectionSet.erase(aFd);
+
+    if (mConnectionSet.size() < kMaxServeNum)
     {
-        otbrLogWarning("Failed to accept new connection: %s", otbrErrorString(error));
+        MainloopManager::GetInstance().UpdateFd(mListenFd, MainloopManager::kEventReadable);
     }
 }
 
@@ -166,6 +195,10 @@ void RestWebServer::InitializeListenFd(void)
     ret = listen(mListenFd, 5);
     VerifyOrExit(ret >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "listen");
 
+    VerifyOrExit(MainloopManager::GetInstance().AddFd(mListenFd, MainloopManager::kEventReadable,
+                                                      [this](uint32_t) { HandleListenFdEvents(); }) == OTBR_ERROR_NONE,
+                 err = errno, error = OTBR_ERROR_REST, errorMessage = "watch");
+
 exit:
 
     if (error != OTBR_ERROR_NONE)
@@ -182,6 +215,7 @@ otbrError RestWebServer::Accept(int aListenFd)
     otbrError   error = OTBR_ERROR_NONE;
     int32_t     err;
     int32_t     fd;
+    int32_t     yes = 1;
     sockaddr_in tmp;
     socklen_t   addrlen = sizeof(tmp);
 
@@ -192,6 +226,10 @@ otbrError RestWebServer::Accept(int aListenFd)
 
     VerifyOrExit(SetFdNonblocking(fd), err = errno, error = OTBR_ERROR_REST; errorMessage = "set nonblock");
 
+    // The responses of pipelined requests are written one after the other, they must not wait for acknowledgements.
+    VerifyOrExit(setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<char *>(&yes), sizeof(yes)) == 0,
+                 err = errno, error = OTBR_ERROR_REST, errorMessage = "sock opt nodelay");
+
     CreateNewConnection(fd);
 
 exit:
@@ -210,18 +248,25 @@ exit:
 
 void RestWebServer::CreateNewConnection(int &aFd)
 {
-    auto it =
-        mConnectionSet.emplace(aFd, std::unique_ptr<Connection>(new Connection(steady_clock::now(), &mResource, aFd)));
+    int32_t fd = aFd;
+    auto    it = mConnectionSet.emplace(
+        aFd, std::unique_ptr<Connection>(new Connection(
+                 steady_clock::now(), &mResource, aFd, [this, fd]() { HandleConnectionComplete(fd); },
+                 [this]() { HandleConnectionIdle(); })));
 
     if (it.second == true)
     {
         Connection *connection = it.first->second.get();
-        connection->Init();
+
+        if (connection->Init() != OTBR_ERROR_NONE)
+        {
+            mConnectionSet.erase(it.first);
+            aFd = -1;
+        }
     }
     else
     {
-        // failure on inserting new connection
-        close(aFd);
+        // failure on inserting new connection, the connection closes the socket
         aFd = -1;
     }
 }
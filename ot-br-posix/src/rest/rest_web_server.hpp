@@ -38,12 +38,22 @@
 #include <netinet/ip.h>
 #include <sys/socket.h>
 
-#include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
 #include "rest/connection.hpp"
 
 using otbr::Ncp::ControllerOpenThread;
 using std::chrono::steady_clock;
 
+/**
+ * Maximum number of connections the REST server serves at the same time.
+ *
+ * When the limit is reached, the connection idle for the longest time is closed for a new connection.
+ *
+ */
+#ifndef OTBR_REST_MAX_CONNECTIONS
+#define OTBR_REST_MAX_CONNECTIONS 500
+#endif
+
 namespace otbr {
 namespace rest {
 
@@ -51,7 +61,7 @@ namespace rest {
  * This class implements a REST server.
  *
  */
-class RestWebServer : public MainloopProcessor
+class RestWebServer : private NonCopyable
 {
 public:
     /**
@@ -66,7 +76,7 @@ public:
      * The destructor destroys the server instance.
      *
      */
-    ~RestWebServer(void) override;
+    ~RestWebServer(void);
 
     /**
      * This method initializes the REST server.
@@ -74,11 +84,30 @@ public:
      */
     void Init(void);
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    /**
+     * This method sets the collector whose network diagnostics are served.
+     *
+     * @param[in] aDiagCollector  A reference to the diagnostics collector.
+     *
+     */
+    void SetDiagCollector(agent::DiagCollector &aDiagCollector) { mResource.SetDiagCollector(&aDiagCollector); }
+
+#if OTBR_ENABLE_MUD_MANAGER
+    /**
+     * This method sets the MUD Manager whose statistics are served.
+     *
+     * @param[in] aMudManager  A reference to the MUD Manager.
+     *
+     */
+    void SetMudManager(MUD::MudManager &aMudManager) { mResource.SetMudManager(&aMudManager); }
+#endif
 
 private:
-    void      UpdateConnections(const fd_set &aReadFdSet);
+    void      HandleListenFdEvents(void);
+    void      HandleConnectionComplete(int32_t aFd);
+    void      HandleConnectionIdle(void);
+    bool      ReapIdleConnection(void);
+    void      EraseConnection(int32_t aFd);
     void      CreateNewConnection(int32_t &aFd);
     otbrError Accept(int32_t aListenFd);
     bool      ParseListenAddress(const std::string listenAddress, struct in6_addr *sin6_addr);
@@ -60,6 +60,7 @@ enum class HttpStatusCode : std::uint16_t
 {
     kStatusOk                  = 200,
     kStatusAccepted            = 202,
+    kStatusNotModified         = 304,
     kStatusBadRequest          = 400,
     kStatusResourceNotFound    = 404,
     kStatusMethodNotAllowed    = 405,
@@ -84,6 +85,7 @@ enum class ConnectionState : std::uint8_t
     kWriteTimeout  = 5, ///< Reach write timeout
     kInternalError = 6, ///< Occur internal call error
     kComplete      = 7, ///< No longer need to be processed
+    kIdle          = 8, ///< Wait for the next request of a persistent connection
 
 };
 struct NodeInfo
@@ -98,12 +100,6 @@ struct NodeInfo
     std::string    mNetworkName;
 };
 
-struct DiagInfo
-{
-    steady_clock::time_point      mStartTime;
-    std::vector<otNetworkDiagTlv> mDiagContent;
-};
-
 } // namespace rest
 } // namespace otbr
 
@@ -96,6 +96,7 @@ static otError OtbrErrorToOtError(otbrError aError)
 AdvertisingProxy::AdvertisingProxy(Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher)
     : mNcp(aNcp)
     , mPublisher(aPublisher)
+    , mBatchStarted(false)
 {
     mNcp.RegisterResetHandler(
         [this]() { otSrpServerSetServiceUpdateHandler(GetInstance(), AdvertisingHandler, this); });
@@ -141,43 +142,59 @@ void AdvertisingProxy::AdvertisingHandler(otSrpServerServiceUpdateId aId,
     OutstandingUpdate *update = nullptr;
     otbrError          error  = OTBR_ERROR_NONE;
 
-    mOutstandingUpdates.emplace_back();
-    update      = &mOutstandingUpdates.back();
+    // The SRP server may deliver many updates in one mainloop iteration (e.g. when all the SRP clients re-register
+    // after a restart). They are published right away, as `aHost` may be freed once this handler returns, but
+    // committed to the mDNS daemon together when the iteration is over.
+    if (!mBatchStarted)
+    {
+        mBatchStarted = true;
+        mPublisher.BeginBatch();
+        mTaskRunner.Post([this]() {
+            mBatchStarted = false;
+            mPublisher.EndBatch();
+        });
+    }
+
+    update      = &mOutstandingUpdates[aId];
     update->mId = aId;
 
     error = PublishHostAndItsServices(aHost, update);
 
-    if (error != OTBR_ERROR_NONE || update->mCallbackCount == 0)
+    if (error != OTBR_ERROR_NONE)
     {
-        mOutstandingUpdates.pop_back();
-        otSrpServerHandleServiceUpdateResult(GetInstance(), aId, OtbrErrorToOtError(error));
+        // Look the update up again, it's already erased if a publishing callback has reported the result.
+        auto it = mOutstandingUpdates.find(aId);
+
+        if (it != mOutstandingUpdates.end())
+        {
+            mOutstandingUpdates.erase(it);
+            otSrpServerHandleServiceUpdateResult(GetInstance(), aId, OtbrErrorToOtError(error));
+        }
     }
 }
 
 void AdvertisingProxy::OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId, otbrError aError)
 {
-    for (auto update = mOutstandingUpdates.begin(); update != mOutstandingUpdates.end(); ++update)
-    {
-        if (update->mId != aUpdateId)
-        {
-            continue;
-        }
+    auto update = mOutstandingUpdates.find(aUpdateId);
 
-        if (aError != OTBR_ERROR_NONE || update->mCallbackCount == 1)
-        {
-            // Erase before notifying OpenThread, because there are chances that new
-            // elements may be added to `otSrpServerHandleServiceUpdateResult` and
-            // the iterator will be invalidated.
-            mOutstandingUpdates.erase(update);
-            otSrpServerHandleServiceUpdateResult(GetInstance(), aUpdateId, OtbrErrorToOtError(aError));
-        }
-        else
-        {
-            --update->mCallbackCount;
-            otbrLogInfo("Waiting for more publishing callbacks %d", update->mCallbackCount);
-        }
-        break;
+    VerifyOrExit(update != mOutstandingUpdates.end());
+
+    if (aError != OTBR_ERROR_NONE || update->second.mCallbackCount == 1)
+    {
+        // Erase before notifying OpenThread, because there are chances that new
+        // elements may be added to `otSrpServerHandleServiceUpdateResult` and
+        // the iterator will be invalidated.
+        mOutstandingUpdates.erase(update);
+        otSrpServerHandleServiceUpdateResult(GetInstance(), aUpdateId, OtbrErrorToOtError(aError));
     }
+    else
+    {
+        --update->second.mCallbackCount;
+        otbrLogInfo("Waiting for more publishing callbacks %d", update->second.mCallbackCount);
+    }
+
+exit:
+    return;
 }
 
 std::vector<Ip6Address> AdvertisingProxy::GetEligibleAddresses(const otIp6Address *aHostAddresses,
@@ -212,10 +229,12 @@ void AdvertisingProxy::PublishAllHostsAndServices(void)
     VerifyOrExit(mPublisher.IsStarted(), mPublisher.Start());
 
     otbrLogInfo("Publish all hosts and services");
+    mPublisher.BeginBatch();
     while ((host = otSrpServerGetNextHost(GetInstance(), host)))
     {
         PublishHostAndItsServices(host, nullptr);
     }
+    mPublisher.EndBatch();
 
 exit:
     return;
@@ -38,6 +38,8 @@
 
 #include <stdint.h>
 
+#include <map>
+
 #include <openthread/instance.h>
 #include <openthread/srp_server.h>
 
@@ -127,8 +129,11 @@ private:
     // A reference to the mDNS publisher, has no ownership.
     Mdns::Publisher &mPublisher;
 
-    // A vector that tracks outstanding updates.
-    std::vector<OutstandingUpdate> mOutstandingUpdates;
+    // A map that tracks outstanding updates by their IDs.
+    std::map<otSrpServerServiceUpdateId, OutstandingUpdate> mOutstandingUpdates;
+
+    // Whether the updates of the current mainloop iteration are being published in a batch.
+    bool mBatchStarted;
 
     // Task runner for running tasks in the context of the main thread.
     TaskRunner mTaskRunner;
@@ -0,0 +1,311 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "DIAG"
+
+#include "utils/diag_collector.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include <openthread/message.h>
+#include <openthread/thread.h>
+
+#include "common/logging.hpp"
+#include "ncp/ncp_openthread.hpp"
+
+namespace otbr {
+namespace agent {
+
+// The multicast address of all the routers.
+static const char *kMulticastAddrAllRouters = "ff03::2";
+
+// The diagnostic TLVs queried from the nodes.
+static const uint8_t kAllTlvTypes[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 14, 15, 16, 17, 19};
+
+// The RLOC16 of an answer without the Short Address TLV.
+static constexpr uint16_t kInvalidRloc16 = 0xfffe;
+
+// The diagnostic TLVs which change on every refresh without any change of the topology, e.g. the MAC counters and the
+// link quality counts of the Connectivity TLV. They are refreshed without changing the topology version.
+static const uint8_t kVolatileTlvTypes[] = {
+    OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY,
+    OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS,
+    OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL,
+    OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE,
+};
+
+// The length of a TLV header, and of the header of a TLV with an extended length.
+static constexpr size_t  kTlvHeaderLength         = 2;
+static constexpr size_t  kExtendedTlvHeaderLength = 4;
+static constexpr uint8_t kExtendedLength          = 0xff;
+
+static bool IsVolatileTlv(uint8_t aType)
+{
+    return std::find(std::begin(kVolatileTlvTypes), std::end(kVolatileTlvTypes), aType) != std::end(kVolatileTlvTypes);
+}
+
+// Returns the raw TLVs without the volatile ones, what the topology version tracks.
+static std::vector<uint8_t> GetStableTlvs(const std::vector<uint8_t> &aRawTlvs)
+{
+    std::vector<uint8_t> stableTlvs;
+    size_t               offset = 0;
+
+    while (offset + kTlvHeaderLength <= aRawTlvs.size())
+    {
+        uint8_t type   = aRawTlvs[offset];
+        size_t  length = aRawTlvs[offset + 1];
+        size_t  size   = kTlvHeaderLength + length;
+
+        if (length == kExtendedLength)
+        {
+            VerifyOrExit(offset + kExtendedTlvHeaderLength <= aRawTlvs.size());
+            length = static_cast<size_t>((aRawTlvs[offset + 2] << 8) | aRawTlvs[offset + 3]);
+            size   = kExtendedTlvHeaderLength + length;
+        }
+
+        size = std::min(size, aRawTlvs.size() - offset);
+
+        if (!IsVolatileTlv(type))
+        {
+            stableTlvs.insert(stableTlvs.end(), aRawTlvs.begin() + offset, aRawTlvs.begin() + offset + size);
+        }
+
+        offset += size;
+    }
+
+exit:
+    return stableTlvs;
+}
+
+static_assert(OTBR_DIAG_REFRESH_INTERVAL * 1000 > DiagCollector::kCollectTimeout,
+              "The refresh interval must be longer than the collect timeout");
+
+DiagCollector::DiagCollector(Ncp::ControllerOpenThread &aNcp)
+    : mNcp(aNcp)
+    , mVersion(0)
+    , mTopologyVersion(0)
+    , mRunning(false)
+    , mReady(false)
+    , mLastError(OTBR_ERROR_NONE)
+    , mTimerId(0)
+{
+}
+
+DiagCollector::~DiagCollector(void)
+{
+    StopTimer();
+}
+
+void DiagCollector::Init(void)
+{
+    // Start from the wall clock so that the versions are not reused after a restart of the agent.
+    mVersion = static_cast<uint64_t>(
+        std::chrono::duration_cast<Milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+    mTopologyVersion = mVersion;
+
+    mNcp.RegisterResetHandler([this]() {
+        Stop();
+
+        if (!mNodeDiags.empty())
+        {
+            mNodeDiags.clear();
+            mVersion++;
+            mTopologyVersion++;
+        }
+    });
+}
+
+void DiagCollector::NotifyRead(void)
+{
+    mLastReadTime = std::chrono::steady_clock::now();
+
+    if (!mRunning)
+    {
+        otbrLogInfo("Start refreshing the network diagnostics");
+        mRunning = true;
+        mReady   = false;
+        StartRefresh();
+    }
+}
+
+void DiagCollector::StartRefresh(void)
+{
+    otbrError    error    = OTBR_ERROR_NONE;
+    otInstance  *instance = mNcp.GetThreadHelper()->GetInstance();
+    otIp6Address rlocAddress;
+    otIp6Address multicastAddress;
+
+    rlocAddress = *otThreadGetRloc(instance);
+
+    VerifyOrExit(otThreadSendDiagnosticGet(instance, &rlocAddress, kAllTlvTypes, sizeof(kAllTlvTypes),
+                                           &DiagCollector::HandleDiagnosticResponse, this) == OT_ERROR_NONE,
+                 error = OTBR_ERROR_REST);
+    VerifyOrExit(otIp6AddressFromString(kMulticastAddrAllRouters, &multicastAddress) == OT_ERROR_NONE,
+                 error = OTBR_ERROR_REST);
+    VerifyOrExit(otThreadSendDiagnosticGet(instance, &multicastAddress, kAllTlvTypes, sizeof(kAllTlvTypes),
+                                           &DiagCollector::HandleDiagnosticResponse, this) == OT_ERROR_NONE,
+                 error = OTBR_ERROR_REST);
+
+exit:
+    if (error != OTBR_ERROR_NONE && mLastError == OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to send the diagnostic queries");
+    }
+
+    mLastError = error;
+    StartTimer(kCollectTimeout, &DiagCollector::HandleCollectTimer);
+}
+
+void DiagCollector::HandleCollectTimer(void)
+{
+    DropStaleDiags();
+    mReady = true;
+
+    StartTimer(OTBR_DIAG_REFRESH_INTERVAL * 1000 - kCollectTimeout, &DiagCollector::HandleRefreshTimer);
+}
+
+void DiagCollector::HandleRefreshTimer(void)
+{
+    if (std::chrono::steady_clock::now() - mLastReadTime >= std::chrono::seconds(OTBR_DIAG_STALE_TIMEOUT))
+    {
+        otbrLogInfo("Stop refreshing the network diagnostics, no reader");
+        Stop();
+    }
+    else
+    {
+        StartRefresh();
+    }
+}
+
+void DiagCollector::DropStaleDiags(void)
+{
+    auto now = std::chrono::steady_clock::now();
+
+    for (auto it = mNodeDiags.begin(); it != mNodeDiags.end();)
+    {
+        if (now - it->second.mUpdateTime >= std::chrono::seconds(OTBR_DIAG_STALE_TIMEOUT))
+        {
+            otbrLogInfo("Drop the stale diagnostics of node 0x%04x", it->first);
+            it = mNodeDiags.erase(it);
+            mVersion++;
+            mTopologyVersion++;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void DiagCollector::Stop(void)
+{
+    StopTimer();
+    mRunning = false;
+    mReady   = false;
+}
+
+void DiagCollector::StartTimer(uint32_t aDelay, void (DiagCollector::*aHandler)(void))
+{
+    StopTimer();
+    mTimerId = MainloopManager::GetInstance().AddTimer(Milliseconds(aDelay), [this, aHandler]() {
+        mTimerId = 0;
+        (this->*aHandler)();
+    });
+}
+
+void DiagCollector::StopTimer(void)
+{
+    if (mTimerId != 0)
+    {
+        MainloopManager::GetInstance().CancelTimer(mTimerId);
+        mTimerId = 0;
+    }
+}
+
+void DiagCollector::HandleDiagnosticResponse(otError              aError,
+                                             otMessage           *aMessage,
+                                             const otMessageInfo *aMessageInfo,
+                                             void                *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aMessageInfo);
+
+    static_cast<DiagCollector *>(aContext)->HandleDiagnosticResponse(aError, aMessage);
+}
+
+void DiagCollector::HandleDiagnosticResponse(otError aError, const otMessage *aMessage)
+{
+    NodeDiag              diag;
+    otNetworkDiagTlv      diagTlv;
+    otNetworkDiagIterator iterator = OT_NETWORK_DIAGNOSTIC_ITERATOR_INIT;
+    uint16_t              rloc16   = kInvalidRloc16;
+    uint16_t              offset;
+
+    SuccessOrExit(aError);
+
+    while (otThreadGetNextDiagnosticTlv(aMessage, &iterator, &diagTlv) == OT_ERROR_NONE)
+    {
+        if (diagTlv.mType == OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS)
+        {
+            rloc16 = diagTlv.mData.mAddr16;
+        }
+        diag.mTlvs.push_back(diagTlv);
+    }
+
+    VerifyOrExit(rloc16 != kInvalidRloc16, otbrLogWarning("Ignore diagnostics without RLOC16"));
+
+    offset = otMessageGetOffset(aMessage);
+    diag.mRawTlvs.resize(otMessageGetLength(aMessage) - offset);
+    otMessageRead(aMessage, offset, diag.mRawTlvs.data(), static_cast<uint16_t>(diag.mRawTlvs.size()));
+    diag.mUpdateTime = std::chrono::steady_clock::now();
+
+    {
+        auto it = mNodeDiags.find(rloc16);
+
+        if (it == mNodeDiags.end() || GetStableTlvs(it->second.mRawTlvs) != GetStableTlvs(diag.mRawTlvs))
+        {
+            mVersion++;
+            mTopologyVersion++;
+        }
+        else if (it->second.mRawTlvs != diag.mRawTlvs)
+        {
+            mVersion++;
+        }
+
+        mNodeDiags[rloc16] = std::move(diag);
+    }
+
+exit:
+    if (aError != OT_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to get diagnostic data: %s", otThreadErrorToString(aError));
+    }
+}
+
+} // namespace agent
+} // namespace otbr
@@ -0,0 +1,199 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the collector of the Thread network diagnostics.
+ */
+
+#ifndef OTBR_UTILS_DIAG_COLLECTOR_HPP_
+#define OTBR_UTILS_DIAG_COLLECTOR_HPP_
+
+#include <chrono>
+#include <map>
+#include <vector>
+
+#include <openthread/netdiag.h>
+
+#include "common/code_utils.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/types.hpp"
+
+/**
+ * Interval between two refreshes of the network diagnostics (in seconds).
+ *
+ */
+#ifndef OTBR_DIAG_REFRESH_INTERVAL
+#define OTBR_DIAG_REFRESH_INTERVAL 10
+#endif
+
+/**
+ * Time after which the diagnostics of a node which stopped answering are dropped (in seconds).
+ *
+ * The refreshes also stop when the diagnostics have not been read for this time.
+ *
+ */
+#ifndef OTBR_DIAG_STALE_TIMEOUT
+#define OTBR_DIAG_STALE_TIMEOUT 60
+#endif
+
+namespace otbr {
+namespace Ncp {
+class ControllerOpenThread;
+}
+} // namespace otbr
+
+namespace otbr {
+namespace agent {
+
+/**
+ * This class implements a collector of the Thread network diagnostics.
+ *
+ * The collector periodically queries the diagnostics of all the routers and keeps the latest answer of each node, so
+ * that any number of readers is served from the same snapshot without additional traffic in the Thread network. The
+ * refreshes only run while the diagnostics are being read.
+ *
+ */
+class DiagCollector : private NonCopyable
+{
+public:
+    /**
+     * This structure represents the diagnostics of a node.
+     *
+     */
+    struct NodeDiag
+    {
+        std::chrono::steady_clock::time_point mUpdateTime; ///< The time the diagnostics were received.
+        std::vector<otNetworkDiagTlv>         mTlvs;       ///< The parsed diagnostic TLVs.
+        std::vector<uint8_t>                  mRawTlvs;    ///< The diagnostic TLVs as received.
+    };
+
+    typedef std::map<uint16_t, NodeDiag> NodeDiagMap; ///< The diagnostics of the nodes, keyed by RLOC16.
+
+    /**
+     * The constructor of the collector.
+     *
+     * @param[in] aNcp  A reference to the NCP controller.
+     *
+     */
+    explicit DiagCollector(Ncp::ControllerOpenThread &aNcp);
+
+    ~DiagCollector(void);
+
+    /**
+     * This method initializes the collector.
+     *
+     */
+    void Init(void);
+
+    /**
+     * This method notifies the collector that the diagnostics are being read.
+     *
+     * A refresh is started right away if the collector was idle.
+     *
+     */
+    void NotifyRead(void);
+
+    /**
+     * This method indicates whether the snapshot reflects at least one refresh since the collector was started.
+     *
+     * @returns TRUE if the snapshot is ready, FALSE if the first refresh is still collecting answers.
+     *
+     */
+    bool IsReady(void) const { return mReady; }
+
+    /**
+     * This method returns the error of the last refresh.
+     *
+     * @retval OTBR_ERROR_NONE  The diagnostic queries of the last refresh were sent.
+     * @retval OTBR_ERROR_REST  Failed to send the diagnostic queries of the last refresh.
+     *
+     */
+    otbrError GetLastError(void) const { return mLastError; }
+
+    /**
+     * This method returns the version of the snapshot.
+     *
+     * The version changes whenever the diagnostics of a node are added, changed or dropped.
+     *
+     * @returns The version of the snapshot.
+     *
+     */
+    uint64_t GetVersion(void) const { return mVersion; }
+
+    /**
+     * This method returns the version of the topology in the snapshot.
+     *
+     * The topology version changes like the version of the snapshot, except when only the TLVs which change without
+     * any change of the topology, such as the MAC counters, are refreshed.
+     *
+     * @returns The version of the topology.
+     *
+     */
+    uint64_t GetTopologyVersion(void) const { return mTopologyVersion; }
+
+    /**
+     * This method returns the snapshot of the diagnostics.
+     *
+     * @returns The diagnostics of the nodes.
+     *
+     */
+    const NodeDiagMap &GetNodeDiags(void) const { return mNodeDiags; }
+
+    static constexpr uint32_t kCollectTimeout = 2000; ///< Time (in milliseconds) to collect the answers of a refresh.
+
+private:
+    void StartRefresh(void);
+    void HandleRefreshTimer(void);
+    void HandleCollectTimer(void);
+    void DropStaleDiags(void);
+    void Stop(void);
+    void StartTimer(uint32_t aDelay, void (DiagCollector::*aHandler)(void));
+    void StopTimer(void);
+
+    static void HandleDiagnosticResponse(otError              aError,
+                                         otMessage           *aMessage,
+                                         const otMessageInfo *aMessageInfo,
+                                         void                *aContext);
+    void        HandleDiagnosticResponse(otError aError, const otMessage *aMessage);
+
+    Ncp::ControllerOpenThread            &mNcp;
+    NodeDiagMap                           mNodeDiags;
+    uint64_t                              mVersion;
+    uint64_t                              mTopologyVersion;
+    bool                                  mRunning;
+    bool                                  mReady;
+    otbrError                             mLastError;
+    std::chrono::steady_clock::time_point mLastReadTime;
+    TimerWheel::TimerId                   mTimerId;
+};
+
+} // namespace agent
+} // namespace otbr
+
+#endif // OTBR_UTILS_DIAG_COLLECTOR_HPP_
@@ -30,12 +30,15 @@
 #include <errno.h>
 #include <limits.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
 #include <netinet/in.h>
 #include <signal.h>
 
+#include <chrono>
+#include <string>
 #include <vector>
 
 #include "common/code_utils.hpp"
@@ -48,15 +51,24 @@ using namespace otbr;
 
 static struct Context
 {
-    Mdns::Publisher *mPublisher;
-    bool             mUpdate;
+    Mdns::Publisher                      *mPublisher;
+    bool                                  mUpdate;
+    bool                                  mQuit;
+    bool                                  mBatched;
+    uint32_t                              mHostCount;
+    uint32_t                              mPendingCount;
+    uint32_t                              mErrorCount;
+    std::chrono::steady_clock::time_point mStartTime;
 } sContext;
 
+// The number of publications of each SRP host: the host itself and two services.
+static constexpr uint32_t kSrpPublicationsPerHost = 3;
+
 int RunMainloop(void)
 {
     int rval = 0;
 
-    while (true)
+    while (!sContext.mQuit)
     {
         MainloopContext mainloop;
 
@@ -261,6 +273,67 @@ void PublishServiceSubTypes(void *aContext)
         [](otbrError aError) { SuccessOrDie(aError, "ServiceWithSubTypes._meshcop._udp."); });
 }
 
+void HandleSrpPublishResult(otbrError aError)
+{
+    if (aError != OTBR_ERROR_NONE)
+    {
+        ++sContext.mErrorCount;
+    }
+
+    if (--sContext.mPendingCount == 0)
+    {
+        auto elapsed = std::chrono::steady_clock::now() - sContext.mStartTime;
+
+        printf("Published %u SRP hosts (%s) in %lld ms, %u errors\n", sContext.mHostCount,
+               sContext.mBatched ? "batched" : "one by one",
+               static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()),
+               sContext.mErrorCount);
+        sContext.mQuit = true;
+    }
+}
+
+void PublishSrpHosts(void *aContext, Mdns::Publisher::State aState)
+{
+    VerifyOrDie(aContext == &sContext, "unexpected context");
+    VerifyOrExit(aState == Mdns::Publisher::State::kReady);
+
+    // Replays the SRP hosts re-registering all at once, as the Advertising Proxy publishes them after a restart.
+    sContext.mStartTime    = std::chrono::steady_clock::now();
+    sContext.mPendingCount = sContext.mHostCount * kSrpPublicationsPerHost;
+    sContext.mErrorCount   = 0;
+
+    if (sContext.mBatched)
+    {
+        sContext.mPublisher->BeginBatch();
+    }
+
+    for (uint32_t i = 0; i < sContext.mHostCount; i++)
+    {
+        uint8_t     hostAddr[OTBR_IP6_ADDRESS_SIZE] = {0x20, 0x02};
+        std::string hostName                        = "srp-host-" + std::to_string(i);
+        std::string serviceName                     = "srp-service-" + std::to_string(i);
+
+        hostAddr[14] = static_cast<uint8_t>(i >> 8);
+        hostAddr[15] = static_cast<uint8_t>(i);
+
+        sContext.mPublisher->PublishService(hostName, serviceName, "_srpbench._udp", {"_sub1"},
+                                            static_cast<uint16_t>(10000 + i), {{"id", hostName.c_str()}},
+                                            [](otbrError aError) { HandleSrpPublishResult(aError); });
+        sContext.mPublisher->PublishService(hostName, serviceName, "_srpbench._tcp", {}, 12345, {},
+                                            [](otbrError aError) { HandleSrpPublishResult(aError); });
+        sContext.mPublisher->PublishHost(hostName, {Ip6Address(hostAddr)},
+                                         [](otbrError aError) { HandleSrpPublishResult(aError); });
+    }
+
+    if (sContext.mBatched)
+    {
+        sContext.mPublisher->EndBatch();
+    }
+
+exit:
+    return;
+}
+
 otbrError TestSingleServiceWithCustomHost(void)
 {
     otbrError error = OTBR_ERROR_NONE;
@@ -377,6 +450,27 @@ exit:
     return ret;
 }
 
+otbrError TestMassRegistration(bool aBatched, uint32_t aHostCount)
+{
+    otbrError ret = OTBR_ERROR_NONE;
+
+    // Keep the logs of each publication out of the measurement.
+    otbrLogSetLevel(OTBR_LOG_WARNING);
+
+    Mdns::Publisher *pub =
+        Mdns::Publisher::Create([](Mdns::Publisher::State aState) { PublishSrpHosts(&sContext, aState); });
+    sContext.mPublisher = pub;
+    sContext.mBatched   = aBatched;
+    sContext.mHostCount = aHostCount;
+    SuccessOrExit(ret = pub->Start());
+    RunMainloop();
+    VerifyOrExit(sContext.mQuit && sContext.mErrorCount == 0, ret = OTBR_ERROR_MDNS);
+
+exit:
+    Mdns::Publisher::Destroy(pub);
+    return ret;
+}
+
 void RecoverSignal(int aSignal)
 {
     if (aSignal == SIGUSR1)
@@ -455,6 +549,10 @@ int main(int argc, char *argv[])
         ret = TestStopService();
         break;
 
+    case 'r':
+        ret = TestMassRegistration(argv[1][1] != 's', argc > 2 ? static_cast<uint32_t>(atoi(argv[2])) : 100);
+        break;
+
     default:
         ret = 1;
         break;
@@ -0,0 +1,702 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a benchmark of the MUD Manager flooded with the MUD requests of joining devices.
+ *
+ * MUD files are served by a local HTTP fixture server and the policies are installed into a dry-run firewall, so
+ * that only the MUD Manager is measured: request handling, downloads, parsing, compilation and bookkeeping.
+ */
+
+#include <errno.h>
+#include <ftw.h>
+#include <getopt.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/resource.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <openthread/platform/misc.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/time.hpp"
+#include "mud_manager/mud_firewall.hpp"
+#include "mud_manager/mud_manager.hpp"
+
+using namespace otbr;
+using namespace otbr::MUD;
+
+namespace {
+
+struct Options
+{
+    uint32_t mDevices      = 1000; // The number of joining devices.
+    uint32_t mUrls         = 16;   // The number of distinct MUD URLs.
+    uint32_t mPathological = 10;   // The percentage of MUD URLs serving a pathological MUD file.
+    uint32_t mDelay        = 0;    // The response delay of the MUD server (in milliseconds).
+    uint32_t mBurst        = OTBR_MUD_MAX_PENDING_REQUESTS; // The MUD requests received per mainloop iteration.
+    uint32_t mTimeout      = 60; // The time given to the devices to be bound (in seconds).
+};
+
+/**
+ * This class implements a minimal HTTP/1.1 server standing in for the MUD hosts.
+ *
+ * The file of index `n` is served at `/mud/<n>.json`, connections are kept alive and served by their own thread.
+ *
+ */
+class FixtureServer
+{
+public:
+    FixtureServer(const std::vector<std::string> &aFiles, uint32_t aDelay)
+        : mFiles(aFiles)
+        , mDelay(aDelay)
+        , mListenFd(-1)
+        , mStopFd{-1, -1}
+        , mPort(0)
+        , mRequestCount(0)
+    {
+    }
+
+    ~FixtureServer(void) { Stop(); }
+
+    bool Start(void)
+    {
+        bool        ret = false;
+        sockaddr_in address;
+        socklen_t   length = sizeof(address);
+        int         one    = 1;
+
+        memset(&address, 0, sizeof(address));
+        address.sin_family      = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        VerifyOrExit(pipe(mStopFd) == 0);
+        VerifyOrExit((mListenFd = socket(AF_INET, SOCK_STREAM, 0)) >= 0);
+        setsockopt(mListenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        VerifyOrExit(bind(mListenFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0);
+        VerifyOrExit(listen(mListenFd, SOMAXCONN) == 0);
+        VerifyOrExit(getsockname(mListenFd, reinterpret_cast<sockaddr *>(&address), &length) == 0);
+
+        mPort   = ntohs(address.sin_port);
+        mThread = std::thread(&FixtureServer::Run, this);
+        ret     = true;
+
+    exit:
+        if (!ret)
+        {
+            perror("fixture server");
+        }
+        return ret;
+    }
+
+    void Stop(void)
+    {
+        // The stop pipe is never read, it stays readable for all the threads.
+        if (mStopFd[1] >= 0)
+        {
+            VerifyOrDie(write(mStopFd[1], "", 1) == 1, strerror(errno));
+        }
+
+        if (mThread.joinable())
+        {
+            mThread.join();
+        }
+
+        for (std::thread &connection : mConnections)
+        {
+            connection.join();
+        }
+
+        mConnections.clear();
+
+        for (int *fd : {&mListenFd, &mStopFd[0], &mStopFd[1]})
+        {
+            if (*fd >= 0)
+            {
+                close(*fd);
+                *fd = -1;
+            }
+        }
+    }
+
+    uint16_t GetPort(void) const { return mPort; }
+
+    uint32_t GetRequestCount(void) const { return mRequestCount; }
+
+private:
+    // Waits for @p aFd to be readable, returns false when the server stops.
+    bool WaitReadable(int aFd) const
+    {
+        pollfd fds[2] = {{aFd, POLLIN, 0}, {mStopFd[0], POLLIN, 0}};
+
+        while (poll(fds, 2, -1) < 0)
+        {
+            VerifyOrDie(errno == EINTR, strerror(errno));
+        }
+
+        return (fds[1].revents & POLLIN) == 0;
+    }
+
+    void Run(void)
+    {
+        while (WaitReadable(mListenFd))
+        {
+            int fd = accept(mListenFd, nullptr, nullptr);
+
+            if (fd >= 0)
+            {
+                mConnections.emplace_back(&FixtureServer::Serve, this, fd);
+            }
+        }
+    }
+
+    void Serve(int aFd)
+    {
+        std::string request;
+        char        buffer[1024];
+
+        while (WaitReadable(aFd))
+        {
+            ssize_t received = recv(aFd, buffer, sizeof(buffer), 0);
+            size_t  end;
+
+            if (received <= 0)
+            {
+                break;
+            }
+
+            request.append(buffer, static_cast<size_t>(received));
+
+            while ((end = request.find("\r\n\r\n")) != std::string::npos)
+            {
+                if (!Respond(aFd, request.substr(0, request.find("\r\n"))))
+                {
+                    ExitNow();
+                }
+
+                request.erase(0, end + 4);
+            }
+        }
+
+    exit:
+        close(aFd);
+    }
+
+    bool Respond(int aFd, const std::string &aRequestLine)
+    {
+        const std::string *file = nullptr;
+        unsigned int       index;
+        char               header[256];
+        std::string        response;
+        size_t             sent = 0;
+
+        mRequestCount++;
+
+        if (sscanf(aRequestLine.c_str(), "GET /mud/%u.json HTTP/1.1", &index) == 1 && index < mFiles.size())
+        {
+            file = &mFiles[index];
+        }
+
+        if (mDelay > 0)
+        {
+            usleep(mDelay * 1000);
+        }
+
+        snprintf(header, sizeof(header),
+                 "HTTP/1.1 %s\r\nContent-Type: application/mud+json\r\nContent-Length: %zu\r\nETag: \"%u\"\r\n\r\n",
+                 file != nullptr ? "200 OK" : "404 Not Found", file != nullptr ? file->size() : 0, index);
+        response = header;
+
+        if (file != nullptr)
+        {
+            response += *file;
+        }
+
+        while (sent < response.size())
+        {
+            ssize_t rval = send(aFd, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+
+            if (rval < 0)
+            {
+                return false;
+            }
+
+            sent += static_cast<size_t>(rval);
+        }
+
+        return true;
+    }
+
+    const std::vector<std::string> &mFiles;
+    uint32_t                        mDelay;
+    int                             mListenFd;
+    int                             mStopFd[2];
+    uint16_t                        mPort;
+    std::atomic<uint32_t>           mRequestCount;
+    std::thread                     mThread;
+    std::vector<std::thread>        mConnections;
+};
+
+/**
+ * This class implements a firewall which only takes note of the time the devices are bound.
+ *
+ */
+class DryRunFirewall : public Firewall
+{
+public:
+    explicit DryRunFirewall(const std::string &aDirectory)
+        : Firewall(aDirectory)
+        , mPolicyCount(0)
+        , mRuleCount(0)
+    {
+    }
+
+    bool InstallPolicy(const Policy &aPolicy) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mPolicyCount++;
+        mRuleCount += aPolicy.mRules.size();
+
+        return true;
+    }
+
+    void RemovePolicy(const Policy &aPolicy) override { OTBR_UNUSED_VARIABLE(aPolicy); }
+
+    bool BindDevice(const Policy &aPolicy, const std::string &aAddress) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        OTBR_UNUSED_VARIABLE(aPolicy);
+        mBindTimes.emplace(aAddress, Clock::now());
+
+        return true;
+    }
+
+    void UnbindDevice(const Policy &aPolicy, const std::string &aAddress) override
+    {
+        OTBR_UNUSED_VARIABLE(aPolicy);
+        OTBR_UNUSED_VARIABLE(aAddress);
+    }
+
+    bool UpdateDnsName(const std::string &aName, const AddressSet &aAddresses) override
+    {
+        OTBR_UNUSED_VARIABLE(aName);
+        OTBR_UNUSED_VARIABLE(aAddresses);
+
+        return true;
+    }
+
+    bool Restore(const std::vector<Policy> &aPolicies, const std::map<std::string, AddressSet> &aDevices) override
+    {
+        OTBR_UNUSED_VARIABLE(aPolicies);
+        OTBR_UNUSED_VARIABLE(aDevices);
+
+        return true;
+    }
+
+    bool GetCounters(const Policy                           &aPolicy,
+                     std::vector<TrafficCounters>           &aRules,
+                     std::map<std::string, TrafficCounters> &aDevices) override
+    {
+        aRules.assign(aPolicy.mRules.size(), TrafficCounters());
+        aDevices.clear();
+
+        return true;
+    }
+
+    size_t GetBoundCount(void) const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return mBindTimes.size();
+    }
+
+    size_t GetPolicyCount(void) const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return mPolicyCount;
+    }
+
+    size_t GetRuleCount(void) const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return mRuleCount;
+    }
+
+    std::map<std::string, Timepoint> GetBindTimes(void) const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return mBindTimes;
+    }
+
+private:
+    mutable std::mutex               mMutex;
+    size_t                           mPolicyCount;
+    size_t                           mRuleCount;
+    std::map<std::string, Timepoint> mBindTimes;
+};
+
+std::string MakeAce(const std::string &aName,
+                    bool               aFromDevice,
+                    uint8_t            aProtocol,
+                    uint16_t           aPort,
+                    const std::string &aDnsName)
+{
+    std::string ace = "{\"name\": \"" + aName + "\", \"matches\": {\"ipv6\": {";
+
+    if (!aDnsName.empty())
+    {
+        ace += std::string("\"ietf-acldns:") + (aFromDevice ? "dst" : "src") + "-dnsname\": \"" + aDnsName + "\", ";
+    }
+
+    ace += "\"protocol\": " + std::to_string(aProtocol) + "}, ";
+    ace += std::string(aProtocol == 6 ? "\"tcp\"" : "\"udp\"") + ": {";
+
+    if (aProtocol == 6)
+    {
+        ace += "\"ietf-mud:direction-initiated\": \"from-device\", ";
+    }
+
+    ace += std::string(aFromDevice ? "\"destination-port\"" : "\"source-port\"") +
+           ": {\"operator\": \"eq\", \"port\": " + std::to_string(aPort) + "}}}, ";
+    ace += "\"actions\": {\"forwarding\": \"accept\"}}";
+
+    return ace;
+}
+
+std::string MakeAcl(const std::string &aName, bool aFromDevice, uint32_t aFile, uint32_t aAceCount, bool aPathological)
+{
+    std::string acl = "{\"name\": \"" + aName + "\", \"type\": \"ipv6-acl-type\", \"aces\": {\"ace\": [";
+
+    for (uint32_t i = 0; i < aAceCount; i++)
+    {
+        // Devices usually reach their own cloud service and CoAP peers, pathological files
+        // match hundreds of distinct endpoints.
+        bool        tcp = aPathological ? (i % 2 == 0) : (i == 0);
+        std::string dnsName;
+
+        if (tcp && (!aPathological || i % 16 == 0))
+        {
+            dnsName = "svc" + std::to_string(i) + ".vendor" + std::to_string(aFile) + ".example.invalid";
+        }
+
+        acl += (i == 0 ? "" : ", ") + MakeAce("ace" + std::to_string(i), aFromDevice, tcp ? 6 : 17,
+                                              static_cast<uint16_t>(tcp ? 443 + i : 5683 + i), dnsName);
+    }
+
+    acl += "]}}";
+
+    return acl;
+}
+
+std::string MakeMudFile(uint32_t aFile, bool aPathological)
+{
+    // A pathological file comes close to the limits of the MUD parser.
+    uint32_t    aceCount = aPathological ? MudParser::kMaxAces / 2 : 3;
+    std::string from     = "mud-" + std::to_string(aFile) + "-v6fr";
+    std::string to       = "mud-" + std::to_string(aFile) + "-v6to";
+    std::string url      = "https://vendor" + std::to_string(aFile) + ".example.invalid/device.json";
+
+    return "{\"ietf-mud:mud\": {\"mud-version\": 1, \"mud-url\": \"" + url +
+           "\", \"last-update\": \"2023-01-01T00:00:00+00:00\", \"cache-validity\": 48, \"is-supported\": true, "
+           "\"systeminfo\": \"Benchmark device\", \"mfg-name\": \"Example\", \"model-name\": \"device" +
+           std::to_string(aFile) + "\", \"from-device-policy\": {\"access-lists\": {\"access-list\": [{\"name\": \"" + from +
+           "\"}]}}, \"to-device-policy\": {\"access-lists\": {\"access-list\": [{\"name\": \"" + to +
+           "\"}]}}}, \"ietf-access-control-list:acls\": {\"acl\": [" +
+           MakeAcl(from, true, aFile, aceCount, aPathological) + ", " +
+           MakeAcl(to, false, aFile, aceCount, aPathological) + "]}}";
+}
+
+void RunMainloop(Microseconds aMaxTimeout)
+{
+    MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = ToTimeval(aMaxTimeout);
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    MainloopManager::GetInstance().Update(mainloop);
+
+    if (MainloopManager::GetInstance().Poll(mainloop) < 0)
+    {
+        VerifyOrDie(errno == EINTR, strerror(errno));
+        return;
+    }
+
+    MainloopManager::GetInstance().Process(mainloop);
+}
+
+void MakeRequest(uint32_t aDevice, const std::string &aUrl, otThreadMudRequestInfo &aInfo, std::string &aAddress)
+{
+    char address[INET6_ADDRSTRLEN];
+
+    memset(&aInfo, 0, sizeof(aInfo));
+
+    // Each device has its own extended address and link-local address.
+    aInfo.mPeerAddress.mFields.m8[0] = 0xfe;
+    aInfo.mPeerAddress.mFields.m8[1] = 0x80;
+    aInfo.mExtAddress.m8[0]          = 0x1e;
+
+    for (uint8_t i = 0; i < sizeof(aDevice); i++)
+    {
+        uint8_t byte = static_cast<uint8_t>((aDevice + 1) >> (8 * (sizeof(aDevice) - 1 - i)));
+
+        aInfo.mPeerAddress.mFields.m8[12 + i] = byte;
+        aInfo.mExtAddress.m8[4 + i]           = byte;
+    }
+
+    aInfo.mRloc16    = 0xfffe;
+    aInfo.mTimestamp = static_cast<uint32_t>(
+        std::chrono::duration_cast<Milliseconds>(Clock::now().time_since_epoch()).count());
+    aInfo.mUrlLength = static_cast<uint8_t>(aUrl.copy(aInfo.mUrl, OT_THREAD_MUD_URL_MAX_LENGTH));
+
+    inet_ntop(AF_INET6, aInfo.mPeerAddress.mFields.m8, address, sizeof(address));
+    aAddress = address;
+}
+
+double ToMilliseconds(Microseconds aDuration)
+{
+    return aDuration.count() / 1000.0;
+}
+
+double GetMean(const Histogram &aHistogram)
+{
+    return aHistogram.GetCount() == 0 ? 0 : aHistogram.GetSum() / 1000.0 / aHistogram.GetCount();
+}
+
+int RemoveEntry(const char *aPath, const struct stat *aStat, int aFlag, struct FTW *aFtw)
+{
+    OTBR_UNUSED_VARIABLE(aStat);
+    OTBR_UNUSED_VARIABLE(aFlag);
+    OTBR_UNUSED_VARIABLE(aFtw);
+
+    return remove(aPath);
+}
+
+void PrintUsage(const char *aProgram)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  -n, --devices N        number of joining devices (default 1000)\n"
+            "  -m, --urls M           number of distinct MUD URLs (default 16)\n"
+            "  -p, --pathological P   percentage of MUD URLs serving a pathological file (default 10)\n"
+            "  -d, --delay MS         response delay of the MUD server in milliseconds (default 0)\n"
+            "  -b, --burst B          MUD requests received per mainloop iteration (default %d)\n"
+            "  -t, --timeout S        time given to the devices to be bound in seconds (default 60)\n",
+            aProgram, OTBR_MUD_MAX_PENDING_REQUESTS);
+}
+
+bool ParseOptions(int argc, char *argv[], Options &aOptions)
+{
+    const struct option kOptions[] = {
+        {"devices", required_argument, nullptr, 'n'}, {"urls", required_argument, nullptr, 'm'},
+        {"pathological", required_argument, nullptr, 'p'}, {"delay", required_argument, nullptr, 'd'},
+        {"burst", required_argument, nullptr, 'b'}, {"timeout", required_argument, nullptr, 't'},
+        {nullptr, 0, nullptr, 0},
+    };
+    int opt;
+
+    while ((opt = getopt_long(argc, argv, "n:m:p:d:b:t:", kOptions, nullptr)) != -1)
+    {
+        uint32_t *value;
+
+        switch (opt)
+        {
+        case 'n':
+            value = &aOptions.mDevices;
+            break;
+        case 'm':
+            value = &aOptions.mUrls;
+            break;
+        case 'p':
+            value = &aOptions.mPathological;
+            break;
+        case 'd':
+            value = &aOptions.mDelay;
+            break;
+        case 'b':
+            value = &aOptions.mBurst;
+            break;
+        case 't':
+            value = &aOptions.mTimeout;
+            break;
+        default:
+            return false;
+        }
+
+        *value = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+    }
+
+    return optind == argc && aOptions.mDevices > 0 && aOptions.mUrls > 0 && aOptions.mPathological <= 100 &&
+           aOptions.mBurst > 0 && aOptions.mBurst <= OTBR_MUD_MAX_PENDING_REQUESTS;
+}
+
+} // namespace
+
+void otPlatReset(otInstance *aInstance)
+{
+    // The MUD Manager is linked with the OpenThread controller, which is never started here.
+    OTBR_UNUSED_VARIABLE(aInstance);
+    VerifyOrDie(false, "unexpected reset");
+}
+
+int main(int argc, char *argv[])
+{
+    Options                          options;
+    std::vector<std::string>         files;
+    std::vector<std::string>         urls;
+    std::map<std::string, Timepoint> submitTimes;
+    std::vector<Microseconds>        latencies;
+    char                             directory[] = "/tmp/otbr-mud-benchmark.XXXXXX";
+    uint32_t                         pathological;
+    uint32_t                         submitted = 0;
+    Timepoint                        start;
+    Timepoint                        end;
+    Timepoint                        deadline;
+    MudStatistics                    statistics;
+    struct rusage                    usage;
+    int                              ret = EXIT_FAILURE;
+
+    if (!ParseOptions(argc, argv, options))
+    {
+        PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    otbrLogInit("otbr-mud-benchmark", OTBR_LOG_ERR, true);
+    VerifyOrDie(mkdtemp(directory) != nullptr, strerror(errno));
+
+    {
+        FixtureServer   server(files, options.mDelay);
+        DryRunFirewall *firewall = new DryRunFirewall(directory);
+        MudManager      mudManager(directory, firewall, /* aRequireHttps */ false);
+
+        VerifyOrExit(server.Start());
+
+        pathological = (options.mUrls * options.mPathological + 99) / 100;
+
+        for (uint32_t i = 0; i < options.mUrls; i++)
+        {
+            urls.push_back("http://127.0.0.1:" + std::to_string(server.GetPort()) + "/mud/" + std::to_string(i) +
+                           ".json");
+            files.push_back(MakeMudFile(i, i < pathological));
+        }
+
+        mudManager.Init();
+
+        start    = Clock::now();
+        deadline = start + Seconds(options.mTimeout);
+
+        // The devices join in bursts, one burst of Parent Requests per mainloop iteration.
+        while (firewall->GetBoundCount() < options.mDevices && Clock::now() < deadline)
+        {
+            for (uint32_t i = 0; i < options.mBurst && submitted < options.mDevices; i++, submitted++)
+            {
+                otThreadMudRequestInfo info;
+                std::string            address;
+
+                MakeRequest(submitted, urls[submitted % urls.size()], info, address);
+                submitTimes[address] = Clock::now();
+                mudManager.HandleMudRequest(info);
+            }
+
+            RunMainloop(Milliseconds(10));
+        }
+
+        mudManager.GetStatistics(statistics);
+        mudManager.Deinit();
+
+        for (const auto &bindTime : firewall->GetBindTimes())
+        {
+            auto submitTime = submitTimes.find(bindTime.first);
+
+            if (submitTime != submitTimes.end())
+            {
+                latencies.push_back(std::chrono::duration_cast<Microseconds>(bindTime.second - submitTime->second));
+                end = std::max(end, bindTime.second);
+            }
+        }
+
+        std::sort(latencies.begin(), latencies.end());
+        getrusage(RUSAGE_SELF, &usage);
+
+        printf("MUD join storm: %u devices, %u MUD URLs (%u pathological), %u requests per burst\n", options.mDevices,
+               options.mUrls, pathological, options.mBurst);
+        printf("  bound devices:    %zu/%u\n", latencies.size(), options.mDevices);
+        printf("  MUD files:        %u downloaded, %zu policies with %zu rules installed\n", server.GetRequestCount(),
+               firewall->GetPolicyCount(), firewall->GetRuleCount());
+
+        if (!latencies.empty())
+        {
+            printf("  throughput:       %.1f requests/s\n",
+                   latencies.size() / std::chrono::duration_cast<std::chrono::duration<double>>(end - start).count());
+            printf("  install latency:  p50 %.3f ms, p99 %.3f ms, max %.3f ms\n",
+                   ToMilliseconds(latencies[latencies.size() / 2]),
+                   ToMilliseconds(latencies[latencies.size() * 99 / 100]), ToMilliseconds(latencies.back()));
+        }
+
+        printf("  mean stage time:  fetch %.3f ms, parse %.3f ms, compile %.3f ms, install %.3f ms\n",
+               GetMean(statistics.mFetchLatency), GetMean(statistics.mParseLatency),
+               GetMean(statistics.mCompileLatency), GetMean(statistics.mInstallLatency));
+        printf("  peak RSS:         %ld KiB\n", usage.ru_maxrss);
+
+        if (latencies.size() == options.mDevices)
+        {
+            ret = EXIT_SUCCESS;
+        }
+    }
+
+exit:
+    nftw(directory, RemoveEntry, 16, FTW_DEPTH | FTW_PHYS);
+    return ret;
+}
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2023, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+# Benchmark client of the otbr rest server.
+#
+# Each client sends its requests either on a new connection per request
+# (close), one after the other on a persistent connection (keep-alive), or
+# in batches on a persistent connection (pipeline).
+#
+#   python3 bench_rest.py --mode keep-alive --clients 8 --requests 1000
+#
+
+import argparse
+import socket
+import time
+from threading import Thread
+
+
+class ResponseReader:
+
+    def __init__(self, sock):
+        self.sock = sock
+        self.buffer = b""
+
+    def fill(self):
+        data = self.sock.recv(65536)
+        if not data:
+            raise ConnectionError("connection closed by the server")
+        self.buffer += data
+
+    def read_until(self, delimiter):
+        while delimiter not in self.buffer:
+            self.fill()
+        data, self.buffer = self.buffer.split(delimiter, 1)
+        return data
+
+    def read_exactly(self, length):
+        while len(self.buffer) < length:
+            self.fill()
+        data, self.buffer = self.buffer[:length], self.buffer[length:]
+        return data
+
+    def read_response(self):
+        lines = self.read_until(b"\r\n\r\n").split(b"\r\n")
+        status = int(lines[0].split()[1])
+        headers = {}
+        for line in lines[1:]:
+            field, value = line.split(b":", 1)
+            headers[field.strip().lower()] = value.strip()
+
+        if headers.get(b"transfer-encoding") == b"chunked":
+            while True:
+                length = int(self.read_until(b"\r\n"), 16)
+                self.read_exactly(length + 2)
+                if length == 0:
+                    break
+        else:
+            self.read_exactly(int(headers.get(b"content-length", b"0")))
+
+        return status
+
+
+def build_request(args, close):
+    request = "GET " + args.path + " HTTP/1.1\r\nHost: " + args.host + "\r\n"
+    if close:
+        request += "Connection: close\r\n"
+    return (request + "\r\n").encode()
+
+
+def run_client(args, latencies, errors, index):
+    batch = args.depth if args.mode == "pipeline" else 1
+    sock = None
+    reader = None
+    sent = 0
+
+    try:
+        while sent < args.requests:
+            count = min(batch, args.requests - sent)
+
+            if sock is None:
+                sock = socket.create_connection((args.host, args.port))
+                sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+                reader = ResponseReader(sock)
+
+            start = time.perf_counter()
+            sock.sendall(build_request(args, args.mode == "close") * count)
+
+            for _ in range(count):
+                if reader.read_response() != 200:
+                    errors[index] += 1
+                latencies[index].append(time.perf_counter() - start)
+
+            sent += count
+
+            if args.mode == "close":
+                sock.close()
+                sock = None
+    except (ConnectionError, OSError):
+        errors[index] += args.requests - sent
+    finally:
+        if sock is not None:
+            sock.close()
+
+
+def percentile(values, ratio):
+    return values[min(len(values) - 1, int(len(values) * ratio))]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Benchmark the otbr rest server")
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=8081)
+    parser.add_argument("--path", default="/node/state")
+    parser.add_argument("--mode", choices=["close", "keep-alive", "pipeline"], default="keep-alive")
+    parser.add_argument("--clients", type=int, default=4, help="number of concurrent clients")
+    parser.add_argument("--requests", type=int, default=500, help="number of requests of each client")
+    parser.add_argument("--depth", type=int, default=8, help="number of requests of a pipelined batch")
+    args = parser.parse_args()
+
+    latencies = [[] for _ in range(args.clients)]
+    errors = [0] * args.clients
+    threads = [Thread(target=run_client, args=(args, latencies, errors, i)) for i in range(args.clients)]
+
+    start = time.perf_counter()
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    elapsed = time.perf_counter() - start
+
+    values = sorted(latency for client in latencies for latency in client)
+    print("mode %s, %d clients, %d requests, %d errors" % (args.mode, args.clients, len(values), sum(errors)))
+
+    if values:
+        print("%.1f requests/s, latency p50 %.2f ms, p99 %.2f ms, max %.2f ms" %
+              (len(values) / elapsed, percentile(values, 0.5) * 1000, percentile(values, 0.99) * 1000,
+               values[-1] * 1000))
+
+    return 1 if sum(errors) else 0
+
+
+if __name__ == '__main__':
+    exit(main())
@@ -29,9 +29,11 @@
 
 import urllib.request
 import urllib.error
+import http.client
 import ipaddress
 import json
 import re
+import socket
 from threading import Thread
 
 rest_api_addr = "http://0.0.0.0:8081"
@@ -428,6 +430,78 @@ def diagnostics_test(thread_num):
         thread_num, has_content, valid))
 
 
+def diagnostics_etag_test():
+    url = rest_api_addr + "/diagnostics"
+
+    response = urllib.request.urlopen(urllib.request.Request(url))
+    etag = response.headers["ETag"]
+    data = json.loads(response.read())
+    assert etag is not None
+    assert diagnostics_check(data) != 0
+
+    # The snapshot is unchanged, the client already has it.
+    try:
+        urllib.request.urlopen(
+            urllib.request.Request(url, headers={"If-None-Match": etag}))
+        assert False
+    except urllib.error.HTTPError as e:
+        assert e.code == 304
+        assert e.headers["ETag"] == etag
+
+    # A stale tag gets the whole snapshot.
+    response = urllib.request.urlopen(
+        urllib.request.Request(url, headers={"If-None-Match": '"0"'}))
+    assert response.status == 200
+    assert diagnostics_check(json.loads(response.read())) != 0
+
+    print(" /diagnostics ETag : valid")
+
+
+def keep_alive_test():
+    connection = http.client.HTTPConnection("127.0.0.1", 8081)
+
+    # The requests are sent over the same connection.
+    for _ in range(5):
+        connection.request("GET", "/node/state")
+        response = connection.getresponse()
+        assert response.status == 200
+        assert response.headers["Connection"] == "keep-alive"
+        assert node_state_check(json.loads(response.read())) != 0
+        sock = connection.sock
+        assert sock is not None
+
+    connection.request("GET", "/node/rloc16")
+    response = connection.getresponse()
+    assert node_rloc16_check(json.loads(response.read())) != 0
+    assert connection.sock is sock
+    connection.close()
+
+    # The pipelined requests are answered in order, the last one closes the connection.
+    urls = ["/node/state", "/node/rloc16", "/nonexistent", "/node/state"]
+    requests = ""
+    for index, url in enumerate(urls):
+        requests += "GET " + url + " HTTP/1.1\r\nHost: 127.0.0.1\r\n"
+        if index == len(urls) - 1:
+            requests += "Connection: close\r\n"
+        requests += "\r\n"
+
+    sock = socket.create_connection(("127.0.0.1", 8081))
+    sock.sendall(requests.encode())
+    received = b""
+    while True:
+        data = sock.recv(4096)
+        if not data:
+            break
+        received += data
+    sock.close()
+
+    statuses = re.findall(rb"HTTP/1.1 (\d+) ", received)
+    assert statuses == [b"200", b"200", b"404", b"200"]
+    assert received.count(b"Connection: close") == 1
+
+    print(" keep-alive and pipelining : valid")
+
+
 def error_test(thread_num):
     url = rest_api_addr + "/hello"
 
@@ -451,6 +525,8 @@ def main():
     node_num_of_router_test(200)
     node_ext_panid_test(200)
     diagnostics_test(20)
+    diagnostics_etag_test()
+    keep_alive_test()
     error_test(10)
 
     return 0
@@ -0,0 +1,228 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "common/mainloop_manager.hpp"
+#include "common/timer_wheel.hpp"
+
+#include <string>
+#include <unistd.h>
+
+#include <CppUTest/TestHarness.h>
+
+static void RunMainloop(otbr::MainloopManager &aMainloopManager, time_t aTimeout)
+{
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {aTimeout, 0};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    aMainloopManager.Update(mainloop);
+    CHECK_TRUE(aMainloopManager.Poll(mainloop) >= 0);
+    aMainloopManager.Process(mainloop);
+}
+
+TEST_GROUP(TimerWheel){};
+
+TEST(TimerWheel, TestTimersOrder)
+{
+    otbr::TimerWheel          timerWheel;
+    otbr::Timepoint           now = otbr::Clock::now();
+    std::string               str;
+    otbr::TimerWheel::TimerId cancelled;
+
+    CHECK_TRUE(timerWheel.GetTimeout(now) == otbr::Milliseconds::max());
+
+    timerWheel.Add(otbr::Milliseconds(30), [&]() { str.push_back('c'); });
+    timerWheel.Add(otbr::Milliseconds(10), [&]() { str.push_back('a'); });
+    cancelled = timerWheel.Add(otbr::Milliseconds(20), [&]() { str.push_back('x'); });
+    timerWheel.Add(otbr::Milliseconds(20), [&]() { str.push_back('b'); });
+
+    // Beyond one turn of the wheel.
+    timerWheel.Add(otbr::Milliseconds(10000), [&]() { str.push_back('d'); });
+
+    timerWheel.Cancel(cancelled);
+    CHECK_TRUE(timerWheel.GetTimeout(now) <= otbr::Milliseconds(10));
+
+    timerWheel.Process(now);
+    STRCMP_EQUAL("", str.c_str());
+
+    timerWheel.Process(now + otbr::Milliseconds(25));
+    STRCMP_EQUAL("ab", str.c_str());
+
+    timerWheel.Process(now + otbr::Milliseconds(5200));
+    STRCMP_EQUAL("abc", str.c_str());
+    CHECK_TRUE(timerWheel.GetTimeout(now + otbr::Milliseconds(5200)) <= otbr::Milliseconds(4800));
+
+    timerWheel.Process(now + otbr::Milliseconds(10020));
+    STRCMP_EQUAL("abcd", str.c_str());
+    CHECK_TRUE(timerWheel.GetTimeout(now) == otbr::Milliseconds::max());
+}
+
+TEST(TimerWheel, TestAddInHandler)
+{
+    otbr::TimerWheel timerWheel;
+    otbr::Timepoint  now     = otbr::Clock::now();
+    int              counter = 0;
+
+    timerWheel.Add(otbr::Milliseconds(0), [&]() {
+        ++counter;
+        timerWheel.Add(otbr::Milliseconds(0), [&]() { ++counter; });
+    });
+
+    // Timers added by a handler are not called before the next processing.
+    timerWheel.Process(now + otbr::Milliseconds(10));
+    CHECK_EQUAL(1, counter);
+
+    timerWheel.Process(now + otbr::Milliseconds(20));
+    CHECK_EQUAL(2, counter);
+}
+
+TEST_GROUP(MainloopManager){};
+
+TEST(MainloopManager, TestWatchFd)
+{
+    otbr::MainloopManager mainloopManager;
+    int                   fds[2];
+    uint32_t              events  = 0;
+    int                   counter = 0;
+    char                  byte    = 'a';
+
+    CHECK_EQUAL(0, pipe(fds));
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, mainloopManager.AddFd(fds[0], otbr::MainloopManager::kEventReadable,
+                                                        [&](uint32_t aEvents) {
+                                                            events = aEvents;
+                                                            ++counter;
+                                                        }));
+    CHECK_EQUAL(OTBR_ERROR_NONE, mainloopManager.AddFd(fds[1], otbr::MainloopManager::kEventWritable,
+                                                        [&](uint32_t aEvents) {
+                                                            CHECK_TRUE(aEvents & otbr::MainloopManager::kEventWritable);
+                                                            CHECK_EQUAL(1, write(fds[1], &byte, 1));
+                                                            mainloopManager.RemoveFd(fds[1]);
+                                                        }));
+
+    // The write end is writable, the read end is readable once it is written.
+    RunMainloop(mainloopManager, 1);
+    RunMainloop(mainloopManager, 1);
+    CHECK_EQUAL(1, counter);
+    CHECK_TRUE(events & otbr::MainloopManager::kEventReadable);
+
+    // The read end is still readable.
+    RunMainloop(mainloopManager, 1);
+    CHECK_EQUAL(2, counter);
+
+    // Stop watching until the events are changed.
+    CHECK_EQUAL(OTBR_ERROR_NONE, mainloopManager.UpdateFd(fds[0], 0));
+    mainloopManager.AddTimer(otbr::Milliseconds(0), []() {});
+    RunMainloop(mainloopManager, 1);
+    CHECK_EQUAL(2, counter);
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, mainloopManager.UpdateFd(fds[0], otbr::MainloopManager::kEventReadable));
+    RunMainloop(mainloopManager, 1);
+    CHECK_EQUAL(3, counter);
+
+    mainloopManager.RemoveFd(fds[0]);
+    CHECK_EQUAL(OTBR_ERROR_NOT_FOUND, mainloopManager.UpdateFd(fds[0], otbr::MainloopManager::kEventReadable));
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(MainloopManager, TestRemoveFdInHandler)
+{
+    otbr::MainloopManager mainloopManager;
+    int                   fds[2];
+    int                   counter = 0;
+    char                  byte    = 'a';
+
+    CHECK_EQUAL(0, pipe(fds));
+    CHECK_EQUAL(1, write(fds[1], &byte, 1));
+
+    // Both ends are ready at once, whichever handler is called first removes the other end.
+    CHECK_EQUAL(OTBR_ERROR_NONE, mainloopManager.AddFd(fds[0], otbr::MainloopManager::kEventReadable,
+                                                        [&](uint32_t) {
+                                                            ++counter;
+                                                            mainloopManager.RemoveFd(fds[1]);
+                                                        }));
+    CHECK_EQUAL(OTBR_ERROR_NONE, mainloopManager.AddFd(fds[1], otbr::MainloopManager::kEventWritable,
+                                                        [&](uint32_t) {
+                                                            ++counter;
+                                                            mainloopManager.RemoveFd(fds[0]);
+                                                        }));
+
+    RunMainloop(mainloopManager, 1);
+    CHECK_EQUAL(1, counter);
+
+    mainloopManager.RemoveFd(fds[0]);
+    mainloopManager.RemoveFd(fds[1]);
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(MainloopManager, TestTimer)
+{
+    otbr::MainloopManager     mainloopManager;
+    otbr::Timepoint           start   = otbr::Clock::now();
+    int                       counter = 0;
+    otbr::TimerWheel::TimerId cancelled;
+
+    mainloopManager.AddTimer(otbr::Milliseconds(50), [&]() { ++counter; });
+    cancelled = mainloopManager.AddTimer(otbr::Milliseconds(20), [&]() { counter += 10; });
+    mainloopManager.CancelTimer(cancelled);
+
+    // The timeout of the mainloop is lowered to the timer.
+    while (counter == 0)
+    {
+        RunMainloop(mainloopManager, 10);
+    }
+
+    CHECK_EQUAL(1, counter);
+    CHECK_TRUE(otbr::Clock::now() - start >= otbr::Milliseconds(50));
+    CHECK_TRUE(otbr::Clock::now() - start < otbr::Milliseconds(1000));
+}
+
+TEST(MainloopManager, TestTimeoutWithoutTimer)
+{
+    otbr::MainloopManager mainloopManager;
+    otbr::MainloopContext mainloop;
+    otbr::Timepoint       start = otbr::Clock::now();
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {0, 10000};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    // The timeout of the mainloop is kept when there is no timer.
+    CHECK_EQUAL(0, mainloopManager.Poll(mainloop));
+    CHECK_TRUE(otbr::Clock::now() - start < otbr::Milliseconds(1000));
+}
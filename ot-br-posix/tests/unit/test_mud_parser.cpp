@@ -0,0 +1,231 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include <CppUTest/TestHarness.h>
+
+#include "mud_manager/mud_parser.hpp"
+
+using otbr::MUD::MudAce;
+using otbr::MUD::MudAcl;
+using otbr::MUD::MudFile;
+using otbr::MUD::MudParser;
+
+static const char kMudFile[] = R"({
+  "ietf-mud:mud": {
+    "mud-version": 1,
+    "mud-url": "https://example.com/lightbulb2000.json",
+    "last-update": "2019-01-28T11:20:51+01:00",
+    "cache-validity": 100,
+    "is-supported": true,
+    "systeminfo": "The BMS Example Light Bulb",
+    "mfg-name": "Example",
+    "documentation": "https://example.com/lightbulb2000",
+    "model-name": "lightbulb2000",
+    "extensions": ["ol"],
+    "from-device-policy": {
+      "access-lists": {
+        "access-list": [{"name": "mud-76100-v6fr"}]
+      }
+    },
+    "to-device-policy": {
+      "access-lists": {
+        "access-list": [{"name": "mud-76100-v6to"}]
+      }
+    }
+  },
+  "ietf-access-control-list:acls": {
+    "acl": [
+      {
+        "name": "mud-76100-v6to",
+        "type": "ipv6-acl-type",
+        "aces": {
+          "ace": [
+            {
+              "name": "cl0-todev",
+              "matches": {
+                "ipv6": {
+                  "ietf-acldns:src-dnsname": "test.example.com",
+                  "protocol": 6
+                },
+                "tcp": {
+                  "ietf-mud:direction-initiated": "from-device",
+                  "source-port": {"operator": "eq", "port": 443}
+                }
+              },
+              "actions": {"forwarding": "accept"}
+            }
+          ]
+        }
+      },
+      {
+        "name": "mud-76100-v6fr",
+        "type": "ipv6-acl-type",
+        "aces": {
+          "ace": [
+            {
+              "name": "cl0-frdev",
+              "matches": {
+                "ipv6": {
+                  "ietf-acldns:dst-dnsname": "test.example.com",
+                  "protocol": 6
+                },
+                "tcp": {
+                  "ietf-mud:direction-initiated": "from-device",
+                  "destination-port": {"operator": "eq", "port": 443}
+                }
+              },
+              "actions": {"forwarding": "accept"}
+            },
+            {
+              "name": "cl1-frdev",
+              "matches": {
+                "ipv6": {"protocol": 17},
+                "udp": {"destination-port": {"operator": "eq", "port": 5683}},
+                "ietf-mud:mud": {"controller": "urn:ietf:params:mud:dns"}
+              },
+              "actions": {"forwarding": "ietf-access-control-list:accept"}
+            }
+          ]
+        }
+      }
+    ]
+  }
+})";
+
+static otbrError ParseReplaced(const std::string &aFrom, const std::string &aTo)
+{
+    std::string content = kMudFile;
+    MudFile     mudFile;
+
+    content.replace(content.find(aFrom), aFrom.size(), aTo);
+
+    return MudParser::Parse(content, mudFile);
+}
+
+TEST_GROUP(MudParser){};
+
+TEST(MudParser, TestParseValidFile)
+{
+    MudFile       mudFile;
+    const MudAcl *acl;
+    std::string   content = kMudFile;
+
+    LONGS_EQUAL(OTBR_ERROR_NONE, MudParser::Parse(content, mudFile));
+
+    // The parsed file owns its strings.
+    content.assign(content.size(), ' ');
+
+    LONGS_EQUAL(1, mudFile.mVersion);
+    STRCMP_EQUAL("https://example.com/lightbulb2000.json", mudFile.mUrl.c_str());
+    STRCMP_EQUAL("2019-01-28T11:20:51+01:00", mudFile.mLastUpdate.c_str());
+    LONGS_EQUAL(100, mudFile.mCacheValidity);
+    CHECK_TRUE(mudFile.mIsSupported);
+    STRCMP_EQUAL("lightbulb2000", mudFile.mModelName.c_str());
+    LONGS_EQUAL(1, mudFile.mExtensions.size());
+    STRCMP_EQUAL("ol", mudFile.mExtensions[0].c_str());
+    LONGS_EQUAL(1, mudFile.mFromDevicePolicies.size());
+    STRCMP_EQUAL("mud-76100-v6fr", mudFile.mFromDevicePolicies[0].c_str());
+    LONGS_EQUAL(1, mudFile.mToDevicePolicies.size());
+    STRCMP_EQUAL("mud-76100-v6to", mudFile.mToDevicePolicies[0].c_str());
+    LONGS_EQUAL(2, mudFile.mAcls.size());
+
+    acl = mudFile.FindAcl("mud-76100-v6to");
+    CHECK(acl != nullptr);
+    LONGS_EQUAL(1, acl->mAces.size());
+    STRCMP_EQUAL("test.example.com", acl->mAces[0].mSrcDnsName.c_str());
+    LONGS_EQUAL(443, acl->mAces[0].mSrcPort);
+    LONGS_EQUAL(0, acl->mAces[0].mDstPort);
+
+    acl = mudFile.FindAcl("mud-76100-v6fr");
+    CHECK(acl != nullptr);
+    LONGS_EQUAL(2, acl->mAces.size());
+    LONGS_EQUAL(6, acl->mAces[0].mIpVersion);
+    LONGS_EQUAL(6, acl->mAces[0].mProtocol);
+    STRCMP_EQUAL("test.example.com", acl->mAces[0].mDstDnsName.c_str());
+    LONGS_EQUAL(443, acl->mAces[0].mDstPort);
+    STRCMP_EQUAL("from-device", acl->mAces[0].mDirectionInitiated.c_str());
+    LONGS_EQUAL(MudAce::kForwardingAccept, acl->mAces[0].mForwarding);
+    LONGS_EQUAL(17, acl->mAces[1].mProtocol);
+    LONGS_EQUAL(5683, acl->mAces[1].mDstPort);
+    STRCMP_EQUAL("urn:ietf:params:mud:dns", acl->mAces[1].mController.c_str());
+    LONGS_EQUAL(MudAce::kForwardingAccept, acl->mAces[1].mForwarding);
+
+    CHECK(mudFile.FindAcl("unknown") == nullptr);
+}
+
+TEST(MudParser, TestParseMalformedFile)
+{
+    MudFile     mudFile;
+    std::string nested = "1";
+
+    for (size_t i = 0; i <= MudParser::kMaxDepth; i++)
+    {
+        nested = "{\"a\": " + nested + "}";
+    }
+
+    LONGS_EQUAL(OTBR_ERROR_PARSE, MudParser::Parse("", mudFile));
+    LONGS_EQUAL(OTBR_ERROR_PARSE, MudParser::Parse("{\"ietf-mud:mud\": {", mudFile));
+    LONGS_EQUAL(OTBR_ERROR_PARSE, MudParser::Parse(std::string(kMudFile, sizeof(kMudFile) / 2), mudFile));
+    LONGS_EQUAL(OTBR_ERROR_PARSE, MudParser::Parse(nested, mudFile));
+}
+
+TEST(MudParser, TestParseInvalidFile)
+{
+    MudFile mudFile;
+
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS, MudParser::Parse("{}", mudFile));
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS, MudParser::Parse("[]", mudFile));
+
+    // Missing or ill-typed members.
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS, ParseReplaced("\"mud-version\": 1", "\"mud-version\": \"1\""));
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS, ParseReplaced("\"mud-version\": 1", "\"mud-version\": 2"));
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS, ParseReplaced("\"is-supported\": true", "\"is-supported\": 1"));
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS, ParseReplaced("\"is-supported\": true,", ""));
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS, ParseReplaced("\"last-update\": \"2019-01-28T11:20:51+01:00\",", ""));
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS, ParseReplaced("https://example.com/lightbulb2000.json", "example.com"));
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS, ParseReplaced("\"extensions\": [\"ol\"]", "\"extensions\": \"ol\""));
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS, ParseReplaced("\"actions\": {\"forwarding\": \"accept\"}", "\"actions\": 1"));
+
+    // Out of range values.
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS, ParseReplaced("\"cache-validity\": 100", "\"cache-validity\": 0"));
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS, ParseReplaced("\"cache-validity\": 100", "\"cache-validity\": 169"));
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS, ParseReplaced("\"port\": 443", "\"port\": 65536"));
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS, ParseReplaced("\"protocol\": 17", "\"protocol\": 256"));
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS, ParseReplaced("\"protocol\": 17", "\"protocol\": 6"));
+
+    // Unsupported or inconsistent entries.
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS, ParseReplaced("\"operator\": \"eq\"", "\"operator\": \"lte\""));
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS, ParseReplaced("\"forwarding\": \"accept\"", "\"forwarding\": \"allow\""));
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS, ParseReplaced("\"name\": \"mud-76100-v6fr\"}", "\"name\": \"unknown\"}"));
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS, ParseReplaced("\"name\": \"cl1-frdev\"", "\"name\": \"cl0-frdev\""));
+    LONGS_EQUAL(OTBR_ERROR_INVALID_ARGS,
+                ParseReplaced("\"from-device\",\n                  \"source-port\"",
+                              "\"sideways\",\n                  \"source-port\""));
+}
@@ -0,0 +1,88 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "mud_manager/mud_statistics.hpp"
+
+using otbr::MUD::Histogram;
+using otbr::MUD::TrafficCounters;
+
+TEST_GROUP(MudStatistics){};
+
+TEST(MudStatistics, TestHistogramBuckets)
+{
+    Histogram histogram;
+
+    LONGS_EQUAL(0, Histogram::GetBucketIndex(0));
+    LONGS_EQUAL(1, Histogram::GetBucketIndex(1));
+    LONGS_EQUAL(2, Histogram::GetBucketIndex(2));
+    LONGS_EQUAL(2, Histogram::GetBucketIndex(3));
+    LONGS_EQUAL(11, Histogram::GetBucketIndex(1024));
+    LONGS_EQUAL(Histogram::kNumBuckets - 1, Histogram::GetBucketIndex(UINT64_MAX));
+
+    histogram.Record(0);
+    histogram.Record(3);
+    histogram.Record(2);
+    histogram.Record(1000);
+
+    LONGS_EQUAL(4, histogram.GetCount());
+    LONGS_EQUAL(1005, histogram.GetSum());
+    LONGS_EQUAL(1000, histogram.GetMax());
+    LONGS_EQUAL(1, histogram.GetBucket(0));
+    LONGS_EQUAL(0, histogram.GetBucket(1));
+    LONGS_EQUAL(2, histogram.GetBucket(2));
+    LONGS_EQUAL(1, histogram.GetBucket(10));
+}
+
+TEST(MudStatistics, TestAccumulateCounters)
+{
+    TrafficCounters total;
+    TrafficCounters lastReading;
+    TrafficCounters reading;
+
+    reading.mPackets = 10;
+    reading.mBytes   = 1000;
+    total.Accumulate(reading, lastReading);
+    LONGS_EQUAL(10, total.mPackets);
+    LONGS_EQUAL(1000, total.mBytes);
+
+    reading.mPackets = 15;
+    reading.mBytes   = 1500;
+    total.Accumulate(reading, lastReading);
+    LONGS_EQUAL(15, total.mPackets);
+    LONGS_EQUAL(1500, total.mBytes);
+
+    // The firewall counters restarted from zero when the ruleset was reloaded.
+    reading.mPackets = 4;
+    reading.mBytes   = 400;
+    total.Accumulate(reading, lastReading);
+    LONGS_EQUAL(19, total.mPackets);
+    LONGS_EQUAL(1900, total.mBytes);
+    LONGS_EQUAL(4, lastReading.mPackets);
+}
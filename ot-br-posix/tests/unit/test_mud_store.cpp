@@ -0,0 +1,174 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include <CppUTest/TestHarness.h>
+
+#include "mud_manager/mud_store.hpp"
+
+using otbr::MUD::MudStore;
+using otbr::MUD::Policy;
+using otbr::MUD::PolicyRule;
+
+static std::string GetStorePath(void)
+{
+    return "/tmp/otbr-test-mud-store-" + std::to_string(getpid()) + ".bin";
+}
+
+static void FillState(MudStore::PolicyMap &aPolicies, MudStore::BindingMap &aBindings)
+{
+    Policy     &policy = aPolicies["0123456789abcdef"];
+    PolicyRule  rule;
+
+    policy.mName = "mud_0123456789abcdef";
+    policy.mUrl  = "https://example.com/lightbulb2000.json";
+
+    rule.mDirection  = PolicyRule::kFromDevice;
+    rule.mConnection = PolicyRule::kOriginal;
+    rule.mAclName    = "mud-76100-v6fr";
+    rule.mAceName    = "cl0-frdev";
+    rule.mProtocol   = 6;
+    rule.mSrcDnsName = "";
+    rule.mDstDnsName = "test.example.com";
+    rule.mSrcPort    = 0;
+    rule.mDstPort    = 443;
+    policy.mRules.push_back(rule);
+
+    rule.mDirection  = PolicyRule::kToDevice;
+    rule.mConnection = PolicyRule::kReply;
+    rule.mAceName    = "cl0-todev";
+    rule.mSrcDnsName = "test.example.com";
+    rule.mDstDnsName = "";
+    rule.mSrcPort    = 443;
+    rule.mDstPort    = 0;
+    policy.mRules.push_back(rule);
+
+    aBindings["1122334455667788"].mContentHash = "0123456789abcdef";
+    aBindings["1122334455667788"].mAddresses   = {"fe80::1322:3344:5566:7788", "fd00::1"};
+    aBindings["99aabbccddeeff00"].mContentHash = "0123456789abcdef";
+
+    // Bindings to unknown policies are not persisted.
+    aBindings["0000000000000001"].mContentHash = "unknown";
+}
+
+TEST_GROUP(MudStore)
+{
+    void teardown(void) { remove(GetStorePath().c_str()); }
+};
+
+TEST(MudStore, TestSaveAndLoad)
+{
+    MudStore             store(GetStorePath());
+    MudStore::PolicyMap  policies;
+    MudStore::BindingMap bindings;
+    MudStore::PolicyMap  loadedPolicies;
+    MudStore::BindingMap loadedBindings;
+
+    CHECK_FALSE(store.Load(loadedPolicies, loadedBindings));
+
+    FillState(policies, bindings);
+    CHECK_TRUE(store.Save(policies, bindings));
+    CHECK_TRUE(store.Load(loadedPolicies, loadedBindings));
+
+    LONGS_EQUAL(1, loadedPolicies.size());
+
+    const Policy &policy = loadedPolicies["0123456789abcdef"];
+
+    STRCMP_EQUAL("mud_0123456789abcdef", policy.mName.c_str());
+    STRCMP_EQUAL("https://example.com/lightbulb2000.json", policy.mUrl.c_str());
+    LONGS_EQUAL(2, policy.mRules.size());
+    LONGS_EQUAL(PolicyRule::kFromDevice, policy.mRules[0].mDirection);
+    LONGS_EQUAL(PolicyRule::kOriginal, policy.mRules[0].mConnection);
+    STRCMP_EQUAL("mud-76100-v6fr", policy.mRules[0].mAclName.c_str());
+    STRCMP_EQUAL("cl0-frdev", policy.mRules[0].mAceName.c_str());
+    LONGS_EQUAL(6, policy.mRules[0].mProtocol);
+    STRCMP_EQUAL("test.example.com", policy.mRules[0].mDstDnsName.c_str());
+    LONGS_EQUAL(443, policy.mRules[0].mDstPort);
+    LONGS_EQUAL(PolicyRule::kToDevice, policy.mRules[1].mDirection);
+    LONGS_EQUAL(PolicyRule::kReply, policy.mRules[1].mConnection);
+    STRCMP_EQUAL("test.example.com", policy.mRules[1].mSrcDnsName.c_str());
+    LONGS_EQUAL(443, policy.mRules[1].mSrcPort);
+
+    LONGS_EQUAL(2, loadedBindings.size());
+    STRCMP_EQUAL("0123456789abcdef", loadedBindings["1122334455667788"].mContentHash.c_str());
+    CHECK_TRUE(loadedBindings["1122334455667788"].mAddresses == bindings["1122334455667788"].mAddresses);
+    CHECK_TRUE(loadedBindings["99aabbccddeeff00"].mAddresses.empty());
+}
+
+TEST(MudStore, TestLoadInvalidState)
+{
+    MudStore             store(GetStorePath());
+    MudStore::PolicyMap  policies;
+    MudStore::BindingMap bindings;
+    std::string          content;
+
+    FillState(policies, bindings);
+    CHECK_TRUE(store.Save(policies, bindings));
+
+    {
+        std::ifstream file(GetStorePath(), std::ios::binary);
+
+        content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    // Corrupted payload.
+    {
+        std::string   corrupted = content;
+        std::ofstream file(GetStorePath(), std::ios::binary | std::ios::trunc);
+
+        corrupted[corrupted.size() - 1] ^= 0x01;
+        file << corrupted;
+    }
+    CHECK_FALSE(store.Load(policies, bindings));
+    CHECK_TRUE(policies.empty());
+    CHECK_TRUE(bindings.empty());
+
+    // Truncated file.
+    {
+        std::ofstream file(GetStorePath(), std::ios::binary | std::ios::trunc);
+
+        file << content.substr(0, content.size() - 1);
+    }
+    CHECK_FALSE(store.Load(policies, bindings));
+
+    // Another version.
+    {
+        std::string   other = content;
+        std::ofstream file(GetStorePath(), std::ios::binary | std::ios::trunc);
+
+        other[4] = static_cast<char>(MudStore::kVersion + 1);
+        file << other;
+    }
+    CHECK_FALSE(store.Load(policies, bindings));
+}
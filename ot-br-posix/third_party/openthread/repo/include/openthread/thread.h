@@ -723,8 +723,6 @@ uint32_t otThreadGetKeySwitchGuardTime(otInstance *aInstance);
  */
 void otThreadSetKeySwitchGuardTime(otInstance *aInstance, uint32_t aKeySwitchGuardTime);
 
-void otThreadSetMudQueuePointer(otInstance *aInstance, otMessageQueue* mqPointer);
-
 /**
  * Detach from the Thread network.
  *
@@ -973,6 +971,41 @@ void otThreadSetDiscoveryRequestCallback(otInstance                      *aInsta
                                          otThreadDiscoveryRequestCallback aCallback,
                                          void                            *aContext);
 
+#define OT_THREAD_MUD_URL_MAX_LENGTH 40 ///< Maximum length of a MUD URL in an MLE MUD URL TLV (excludes null char).
+
+/**
+ * This structure represents a MUD URL advertised by a device in an MLE Parent Request.
+ *
+ */
+typedef struct otThreadMudRequestInfo
+{
+    otIp6Address mPeerAddress; ///< Link-local IPv6 address the request was sent from.
+    otExtAddress mExtAddress;  ///< IEEE 802.15.4 Extended Address of the requester.
+    uint16_t     mRloc16;      ///< RLOC16 of the requester if it already is a child, otherwise `0xfffe`.
+    uint32_t     mTimestamp;   ///< Time the request was received (in milliseconds).
+    uint8_t      mUrlLength;   ///< Length of the MUD URL (excludes null char).
+    char         mUrl[OT_THREAD_MUD_URL_MAX_LENGTH + 1]; ///< The MUD URL (null-terminated).
+} otThreadMudRequestInfo;
+
+/**
+ * This function pointer is called every time an MLE Parent Request carrying a MUD URL TLV is received.
+ *
+ * @param[in]  aInfo     A pointer to the MUD request info data.
+ * @param[in]  aContext  A pointer to callback application-specific context.
+ *
+ */
+typedef void (*otThreadMudRequestCallback)(const otThreadMudRequestInfo *aInfo, void *aContext);
+
+/**
+ * This function sets a callback to receive the MUD URLs advertised in MLE Parent Requests.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aCallback  A pointer to a function that is called upon receiving a MUD URL, or NULL to disable.
+ * @param[in]  aContext   A pointer to callback application-specific context.
+ *
+ */
+void otThreadSetMudRequestCallback(otInstance *aInstance, otThreadMudRequestCallback aCallback, void *aContext);
+
 /**
  * This function pointer type defines the callback to notify the outcome of a `otThreadLocateAnycastDestination()`
  * request.
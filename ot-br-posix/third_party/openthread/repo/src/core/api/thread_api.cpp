@@ -287,11 +287,6 @@ void otThreadSetKeySwitchGuardTime(otInstance *aInstance, uint32_t aKeySwitchGua
     AsCoreType(aInstance).Get<KeyManager>().SetKeySwitchGuardTime(aKeySwitchGuardTime);
 }
 
-void otThreadSetMudQueuePointer(otInstance *aInstance, otMessageQueue* mqPointer)
-{
-    AsCoreType(aInstance).Get<Mle::MleRouter>().SetMudMessageQueue(mqPointer);
-}
-
 otError otThreadBecomeDetached(otInstance *aInstance)
 {
     return AsCoreType(aInstance).Get<Mle::MleRouter>().BecomeDetached();
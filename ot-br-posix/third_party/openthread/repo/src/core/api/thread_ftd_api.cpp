@@ -344,6 +344,11 @@ void otThreadSetDiscoveryRequestCallback(otInstance                      *aInsta
     AsCoreType(aInstance).Get<Mle::MleRouter>().SetDiscoveryRequestCallback(aCallback, aContext);
 }
 
+void otThreadSetMudRequestCallback(otInstance *aInstance, otThreadMudRequestCallback aCallback, void *aContext)
+{
+    AsCoreType(aInstance).Get<Mle::MleRouter>().SetMudRequestCallback(aCallback, aContext);
+}
+
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
 void otThreadSendAddressNotification(otInstance               *aInstance,
                                      otIp6Address             *aDestination,
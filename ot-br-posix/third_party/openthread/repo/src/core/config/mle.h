@@ -290,4 +290,44 @@
 #define OPENTHREAD_CONFIG_MLE_LINK_METRICS_MAX_SERIES_SUPPORTED OPENTHREAD_CONFIG_MLE_MAX_CHILDREN
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_MUD_REQUEST_TABLE_SIZE
+ *
+ * The number of devices for which the last reported MUD URL is remembered to suppress duplicate MUD requests.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_MUD_REQUEST_TABLE_SIZE
+#define OPENTHREAD_CONFIG_MLE_MUD_REQUEST_TABLE_SIZE 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_MUD_REQUEST_TTL
+ *
+ * The time (in seconds) during which a MUD URL is not reported again for the same device.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_MUD_REQUEST_TTL
+#define OPENTHREAD_CONFIG_MLE_MUD_REQUEST_TTL 300
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_MUD_REQUEST_MAX_BURST
+ *
+ * The maximum number of MUD requests reported back-to-back (token bucket depth).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_MUD_REQUEST_MAX_BURST
+#define OPENTHREAD_CONFIG_MLE_MUD_REQUEST_MAX_BURST 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_MUD_REQUEST_TOKEN_INTERVAL
+ *
+ * The interval (in milliseconds) at which one more MUD request may be reported once the burst is used up.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_MUD_REQUEST_TOKEN_INTERVAL
+#define OPENTHREAD_CONFIG_MLE_MUD_REQUEST_TOKEN_INTERVAL 1000
+#endif
+
 #endif // CONFIG_MLE_H_
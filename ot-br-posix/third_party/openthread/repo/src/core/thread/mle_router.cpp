@@ -44,6 +44,7 @@
 #include "common/random.hpp"
 #include "common/serial_number.hpp"
 #include "common/settings.hpp"
+#include "common/string.hpp"
 #include "mac/mac_types.hpp"
 #include "meshcop/meshcop.hpp"
 #include "net/icmp6.hpp"
@@ -60,8 +61,6 @@ namespace Mle {
 
 RegisterLogModule("Mle");
 
-otMessageQueue* mq;
-
 MleRouter::MleRouter(Instance &aInstance)
     : Mle(aInstance)
     , mAdvertiseTrickleTimer(aInstance, MleRouter::HandleAdvertiseTrickleTimer)
@@ -200,17 +199,6 @@ void MleRouter::SetLinkRequestTransmissionCounter(void)
     }
 }
 
-Error MleRouter::SetMudMessageQueue(otMessageQueue* mqPointer) {
-    Error error = kErrorNone;
-
-    VerifyOrExit(mqPointer != nullptr, error = kErrorInvalidArgs);
-
-    mq = mqPointer;
-
-exit:
-    return error;
-}
-
 Error MleRouter::BecomeRouter(ThreadStatusTlv::Status aStatus)
 {
     Error error = kErrorNone;
@@ -500,44 +488,12 @@ exit:
     return;
 }
 
-Error MleRouter::CreateMudMessage(char *mudUrl, const char *mudIp) {
-    Error        error = kErrorNone;
-    uint8_t      mudUrlLength = static_cast<uint8_t>(strlen(mudUrl));
-    uint8_t      mudIpLength = static_cast<uint8_t>(strlen(mudIp));
-
-    LogInfo("Creating MUD Message");
-    otMessage* msg = Get<MessagePool>().Allocate(Message::kTypeOther, 0,  Message::Settings::GetDefault());
-
-    VerifyOrExit(msg != NULL, error = kErrorInvalidArgs);
-    VerifyOrExit(otMessageSetLength(msg, strlen(mudUrl) + strlen(mudIp) + 16) == OT_ERROR_NONE, error = kErrorInvalidArgs);
-
-    LogInfo("OT URL: %s", mudUrl);
-    LogInfo("OT IP: %s", mudIp);
-
-    otMessageWrite(msg, 0, &mudUrlLength, 8);
-    otMessageWrite(msg, 8, mudUrl, strlen(mudUrl));
-    otMessageWrite(msg, strlen(mudUrl) + 8, &mudIpLength, 8);
-    otMessageWrite(msg, strlen(mudUrl) + 16, mudIp, strlen(mudIp));
-    otMessageQueueEnqueue(mq, msg);
-
-    LogInfo("Message with Length %d and Offset %d added to Queue", otMessageGetLength(msg), otMessageGetOffset(msg));
-
-exit:
-    return error;
-}
-
 void MleRouter::SendAdvertisement(void)
 {
     Error        error = kErrorNone;
     Ip6::Address destination;
     TxMessage   *message = nullptr;
 
-    // TODO Remove later
-    // char mudUrl[60] = "mud.codeflex.dev/files/demo/mud.json";
-    // const char *mudIp = "fde0:3771:b314:1:43e:979:b721:2663"; 
-
-    // MleRouter::CreateMudMessage(mudUrl, mudIp);
-
     // Suppress MLE Advertisements when trying to attach to a better partition.
     //
     // Without this suppression, a device may send an MLE Advertisement before receiving the MLE Child ID Response.
@@ -1421,22 +1377,10 @@ void MleRouter::HandleParentRequest(RxInfo &aRxInfo)
     Challenge       challenge;
     Child          *child;
     uint8_t         modeBitmask;
-    char            mudUrl[Tlv::kMaxMudUrlLength + 1];
     DeviceMode      mode;
 
     Log(kMessageReceive, kTypeParentRequest, aRxInfo.mMessageInfo.GetPeerAddr());
 
-    LogDebg("Checking for MUD URL in MLE Parent Request");
-
-    if (Tlv::Find<MudUrlTlv>(aRxInfo.mMessage, mudUrl) == kErrorNone) {
-        LogDebg("MUD URL Included in MLE Parent Request with length: %d", strlen(mudUrl));
-
-        MleRouter::CreateMudMessage(mudUrl, aRxInfo.mMessageInfo.GetPeerAddr().ToString().AsCString());
-
-    } else {
-        LogDebg("MUD URL not found in MLE Parent Request");
-    }
-
     VerifyOrExit(IsRouterEligible(), error = kErrorInvalidState);
 
     // A Router/REED MUST NOT send an MLE Parent Response if:
@@ -1462,6 +1406,10 @@ void MleRouter::HandleParentRequest(RxInfo &aRxInfo)
 
     aRxInfo.mMessageInfo.GetPeerAddr().GetIid().ConvertToExtAddress(extAddr);
 
+    // A device retransmits Parent Requests during each attach attempt, only
+    // report the MUD URL once we could become its parent.
+    HandleMudUrl(aRxInfo, extAddr);
+
     // Version
     SuccessOrExit(error = Tlv::Find<VersionTlv>(aRxInfo.mMessage, version));
     VerifyOrExit(version >= kThreadVersion1p1, error = kErrorParse);
@@ -1530,6 +1478,122 @@ exit:
     LogProcessError(kTypeParentRequest, error);
 }
 
+void MleRouter::HandleMudUrl(const RxInfo &aRxInfo, const Mac::ExtAddress &aExtAddress)
+{
+    static_assert(sizeof(otThreadMudRequestInfo::mUrl) == sizeof(MudUrlTlv::StringType),
+                  "mUrl does not match the MUD URL TLV length");
+
+    otThreadMudRequestInfo info;
+    const Child           *child;
+
+    VerifyOrExit(mMudRequestCallback.IsSet());
+    SuccessOrExit(Tlv::Find<MudUrlTlv>(aRxInfo.mMessage, info.mUrl));
+
+    if (!mMudRequestFilter.Accept(aExtAddress, info.mUrl))
+    {
+        LogDebg("Suppressed MUD URL %s from %s", info.mUrl, aExtAddress.ToString().AsCString());
+        ExitNow();
+    }
+
+    AsCoreType(&info.mPeerAddress) = aRxInfo.mMessageInfo.GetPeerAddr();
+    AsCoreType(&info.mExtAddress)  = aExtAddress;
+
+    child           = mChildTable.FindChild(aExtAddress, Child::kInStateValidOrRestoring);
+    info.mRloc16    = (child != nullptr) ? child->GetRloc16() : Mac::kShortAddrInvalid;
+    info.mTimestamp = TimerMilli::GetNow().GetValue();
+    info.mUrlLength = static_cast<uint8_t>(StringLength(info.mUrl, sizeof(info.mUrl)));
+
+    LogInfo("Received MUD URL %s from %s", info.mUrl, aExtAddress.ToString().AsCString());
+
+    mMudRequestCallback.Invoke(&info);
+
+exit:
+    return;
+}
+
+MleRouter::MudRequestFilter::MudRequestFilter(void)
+    : mTokens(kMaxBurst)
+    , mRefillTime(TimerMilli::GetNow())
+{
+    for (Entry &entry : mEntries)
+    {
+        entry.Clear();
+    }
+}
+
+bool MleRouter::MudRequestFilter::Accept(const Mac::ExtAddress &aExtAddress, const MudUrlTlv::StringType &aUrl)
+{
+    TimeMilli now      = TimerMilli::GetNow();
+    Entry    *entry    = nullptr;
+    bool      accepted = false;
+
+    for (Entry &candidate : mEntries)
+    {
+        if (candidate.IsInUse(now) && candidate.mExtAddress == aExtAddress)
+        {
+            entry = &candidate;
+            break;
+        }
+    }
+
+    VerifyOrExit(entry == nullptr || strcmp(entry->mUrl, aUrl) != 0);
+    VerifyOrExit(ConsumeToken(now));
+
+    if (entry == nullptr)
+    {
+        // Take a free entry, or evict the one closest to expiring.
+        entry = &mEntries[0];
+
+        for (Entry &candidate : mEntries)
+        {
+            if (!candidate.IsInUse(now))
+            {
+                entry = &candidate;
+                break;
+            }
+
+            if (candidate.mExpireTime < entry->mExpireTime)
+            {
+                entry = &candidate;
+            }
+        }
+    }
+
+    entry->mExtAddress = aExtAddress;
+    entry->mExpireTime = now + kTtl;
+    memcpy(entry->mUrl, aUrl, sizeof(entry->mUrl));
+    accepted = true;
+
+exit:
+    return accepted;
+}
+
+bool MleRouter::MudRequestFilter::ConsumeToken(TimeMilli aNow)
+{
+    uint32_t tokens = (aNow - mRefillTime) / kTokenInterval;
+    bool     consumed;
+
+    if (tokens >= static_cast<uint32_t>(kMaxBurst - mTokens))
+    {
+        mTokens     = kMaxBurst;
+        mRefillTime = aNow;
+    }
+    else
+    {
+        mTokens += static_cast<uint8_t>(tokens);
+        mRefillTime += tokens * kTokenInterval;
+    }
+
+    consumed = (mTokens > 0);
+
+    if (consumed)
+    {
+        mTokens--;
+    }
+
+    return consumed;
+}
+
 bool MleRouter::HasNeighborWithGoodLinkQuality(void) const
 {
     bool    haveNeighbor = true;
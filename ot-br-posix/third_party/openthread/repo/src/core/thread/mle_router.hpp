@@ -40,6 +40,8 @@
 
 #include "coap/coap_message.hpp"
 #include "common/callback.hpp"
+#include "common/clearable.hpp"
+#include "common/string.hpp"
 #include "common/time_ticker.hpp"
 #include "common/timer.hpp"
 #include "common/trickle_timer.hpp"
@@ -57,6 +59,9 @@
 #include "thread/topology.hpp"
 
 namespace ot {
+
+class UnitTester;
+
 namespace Mle {
 
 /**
@@ -80,6 +85,7 @@ class MleRouter : public Mle
     friend class ot::Instance;
     friend class ot::TimeTicker;
     friend class Tmf::Agent;
+    friend class ot::UnitTester;
 
 public:
     /**
@@ -122,27 +128,6 @@ public:
      */
     bool IsSingleton(void) const;
 
-    // struct otMudManagerEntry {
-    //     char url[41];
-    //     char ip[24];
-    // };
-
-     /**
-     * This method sets the pointer to the initialized message queue
-     * 
-     * @param[in]   mqPointer       Pointer to otMessageQueue
-     * 
-    */
-    Error SetMudMessageQueue(otMessageQueue* mqPointer);
-
-    /**
-     * This method creates a new OT Message including all other information
-     * After creation, puts it into MudManager Message Queue
-     * 
-     * @param[in]   mudUrl          The MUD URL
-    */
-    Error CreateMudMessage(char *mudUrl, const char *mudIp);
-
     /**
      * This method generates an Address Solicit request for a Router ID.
      *
@@ -497,6 +482,18 @@ public:
         mDiscoveryRequestCallback.Set(aCallback, aContext);
     }
 
+    /**
+     * This function sets the callback that is called when an MLE Parent Request carries a MUD URL.
+     *
+     * @param[in]  aCallback A pointer to a function that is called to deliver the MUD request data.
+     * @param[in]  aContext  A pointer to application-specific context.
+     *
+     */
+    void SetMudRequestCallback(otThreadMudRequestCallback aCallback, void *aContext)
+    {
+        mMudRequestCallback.Set(aCallback, aContext);
+    }
+
     /**
      * This method resets the MLE Advertisement Trickle timer interval.
      *
@@ -588,6 +585,7 @@ private:
     void  HandleLinkAcceptAndRequest(RxInfo &aRxInfo);
     Error HandleAdvertisement(RxInfo &aRxInfo, uint16_t aSourceAddress, const LeaderData &aLeaderData);
     void  HandleParentRequest(RxInfo &aRxInfo);
+    void  HandleMudUrl(const RxInfo &aRxInfo, const Mac::ExtAddress &aExtAddress);
     void  HandleChildIdRequest(RxInfo &aRxInfo);
     void  HandleChildUpdateRequest(RxInfo &aRxInfo);
     void  HandleChildUpdateResponse(RxInfo &aRxInfo);
@@ -647,6 +645,39 @@ private:
     bool ShouldDowngrade(uint8_t aNeighborId, const RouteTlv &aRouteTlv) const;
     bool NeighborHasComparableConnectivity(const RouteTlv &aRouteTlv, uint8_t aNeighborId) const;
 
+    // Suppresses the MUD URLs already reported for a device within the TTL,
+    // and rate limits the new ones with a token bucket.
+    class MudRequestFilter
+    {
+        friend class ot::UnitTester;
+
+    public:
+        MudRequestFilter(void);
+
+        bool Accept(const Mac::ExtAddress &aExtAddress, const MudUrlTlv::StringType &aUrl);
+
+    private:
+        static constexpr uint8_t  kTableSize     = OPENTHREAD_CONFIG_MLE_MUD_REQUEST_TABLE_SIZE;
+        static constexpr uint32_t kTtl           = Time::SecToMsec(OPENTHREAD_CONFIG_MLE_MUD_REQUEST_TTL);
+        static constexpr uint8_t  kMaxBurst      = OPENTHREAD_CONFIG_MLE_MUD_REQUEST_MAX_BURST;
+        static constexpr uint32_t kTokenInterval = OPENTHREAD_CONFIG_MLE_MUD_REQUEST_TOKEN_INTERVAL;
+
+        struct Entry : public Clearable<Entry>
+        {
+            bool IsInUse(TimeMilli aNow) const { return mUrl[0] != kNullChar && aNow < mExpireTime; }
+
+            Mac::ExtAddress       mExtAddress;
+            TimeMilli             mExpireTime;
+            MudUrlTlv::StringType mUrl;
+        };
+
+        bool ConsumeToken(TimeMilli aNow);
+
+        Entry     mEntries[kTableSize];
+        uint8_t   mTokens;
+        TimeMilli mRefillTime;
+    };
+
     static void HandleAdvertiseTrickleTimer(TrickleTimer &aTimer);
     void        HandleAdvertiseTrickleTimer(void);
     void        HandleTimeTick(void);
@@ -703,6 +734,8 @@ private:
 #endif
 
     Callback<otThreadDiscoveryRequestCallback> mDiscoveryRequestCallback;
+    Callback<otThreadMudRequestCallback>       mMudRequestCallback;
+    MudRequestFilter                           mMudRequestFilter;
 };
 
 DeclareTmfHandler(MleRouter, kUriAddressSolicit);
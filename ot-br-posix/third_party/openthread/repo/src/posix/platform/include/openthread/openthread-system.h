@@ -83,8 +83,7 @@ typedef struct otPlatformConfig
     uint32_t        mSpeedUpFactor;                                ///< Speed up factor.
     bool            mPersistentInterface;                          ///< Whether persistent the interface
     bool            mDryRun;                                       ///< If 'DryRun' is set, the posix daemon will exit
-    otMessageQueue *mMudQueue;                                 ///< Pointer to MUD Queue 
-                                                               ///< directly after initialization.
+                                                                   ///< directly after initialization.
 } otPlatformConfig;
 
 /**
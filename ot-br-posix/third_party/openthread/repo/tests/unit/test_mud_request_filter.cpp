@@ -0,0 +1,190 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "openthread-core-config.h"
+
+#include <string.h>
+
+#include "test_platform.h"
+#include "test_util.h"
+
+#include "common/code_utils.hpp"
+#include "thread/mle_router.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_FTD
+
+uint32_t sNow;
+
+extern "C" uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+class UnitTester
+{
+public:
+    typedef Mle::MleRouter::MudRequestFilter Filter;
+
+    static void InitExtAddress(Mac::ExtAddress &aExtAddress, uint8_t aId)
+    {
+        memset(aExtAddress.m8, 0, sizeof(aExtAddress.m8));
+        aExtAddress.m8[7] = aId;
+    }
+
+    static void InitUrl(Mle::MudUrlTlv::StringType &aUrl, const char *aString)
+    {
+        memset(aUrl, 0, sizeof(aUrl));
+        strcpy(aUrl, aString);
+    }
+
+    static void TestDuplicateSuppression(void)
+    {
+        Mac::ExtAddress            device1;
+        Mac::ExtAddress            device2;
+        Mle::MudUrlTlv::StringType urlA;
+        Mle::MudUrlTlv::StringType urlB;
+
+        printf("TestDuplicateSuppression");
+
+        sNow = 1000;
+
+        Filter filter;
+
+        InitExtAddress(device1, 1);
+        InitExtAddress(device2, 2);
+        InitUrl(urlA, "https://example.com/a.json");
+        InitUrl(urlB, "https://example.com/b.json");
+
+        // A repeated (device, URL) pair is suppressed.
+        VerifyOrQuit(filter.Accept(device1, urlA));
+        VerifyOrQuit(!filter.Accept(device1, urlA));
+
+        // The same URL from another device passes.
+        VerifyOrQuit(filter.Accept(device2, urlA));
+        VerifyOrQuit(!filter.Accept(device2, urlA));
+
+        // A new URL for the device passes, and replaces the previous one.
+        VerifyOrQuit(filter.Accept(device1, urlB));
+        VerifyOrQuit(!filter.Accept(device1, urlB));
+        VerifyOrQuit(filter.Accept(device1, urlA));
+
+        printf(" -- PASS\n");
+    }
+
+    static void TestExpiry(void)
+    {
+        Mac::ExtAddress            device;
+        Mle::MudUrlTlv::StringType url;
+
+        printf("TestExpiry");
+
+        sNow = 5000;
+
+        Filter filter;
+
+        InitExtAddress(device, 1);
+        InitUrl(url, "https://example.com/a.json");
+
+        VerifyOrQuit(filter.Accept(device, url));
+
+        sNow += Filter::kTtl - 1;
+        VerifyOrQuit(!filter.Accept(device, url));
+
+        // The entry expires after the TTL.
+        sNow += 1;
+        VerifyOrQuit(filter.Accept(device, url));
+        VerifyOrQuit(!filter.Accept(device, url));
+
+        printf(" -- PASS\n");
+    }
+
+    static void TestRateLimit(void)
+    {
+        Mac::ExtAddress            device;
+        Mle::MudUrlTlv::StringType url;
+        uint8_t                    id = 0;
+
+        printf("TestRateLimit");
+
+        sNow = 10000;
+
+        Filter filter;
+
+        InitUrl(url, "https://example.com/a.json");
+
+        // A burst of new requests is capped at the bucket depth.
+        for (uint8_t i = 0; i < Filter::kMaxBurst; i++)
+        {
+            InitExtAddress(device, ++id);
+            VerifyOrQuit(filter.Accept(device, url));
+        }
+
+        InitExtAddress(device, ++id);
+        VerifyOrQuit(!filter.Accept(device, url));
+
+        // One more request is allowed after each token interval.
+        sNow += Filter::kTokenInterval - 1;
+        VerifyOrQuit(!filter.Accept(device, url));
+
+        sNow += 1;
+        VerifyOrQuit(filter.Accept(device, url));
+
+        InitExtAddress(device, ++id);
+        VerifyOrQuit(!filter.Accept(device, url));
+
+        // The bucket refills up to the burst size.
+        sNow += Filter::kTokenInterval * (Filter::kMaxBurst + 2);
+
+        for (uint8_t i = 0; i < Filter::kMaxBurst; i++)
+        {
+            InitExtAddress(device, ++id);
+            VerifyOrQuit(filter.Accept(device, url));
+        }
+
+        InitExtAddress(device, ++id);
+        VerifyOrQuit(!filter.Accept(device, url));
+
+        printf(" -- PASS\n");
+    }
+};
+
+#endif // OPENTHREAD_FTD
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_FTD
+    ot::UnitTester::TestDuplicateSuppression();
+    ot::UnitTester::TestExpiry();
+    ot::UnitTester::TestRateLimit();
+    printf("All tests passed\n");
+#else
+    printf("MUD request filter is not enabled\n");
+#endif
+    return 0;
+}